@@ -15,6 +15,7 @@
 
 #import "AWSCloudWatchService.h"
 #import "AWSNetworking.h"
+#import "AWSNetworkingMetrics.h"
 #import "AWSCategory.h"
 #import "AWSNetworking.h"
 #import "AWSCocoaLumberjack.h"
@@ -24,6 +25,7 @@
 #import "AWSURLRequestRetryHandler.h"
 #import "AWSSynchronizedMutableDictionary.h"
 #import "AWSCloudWatchResources.h"
+#import "AWSNetworkingRequestCompressionInterceptor.h"
 
 static NSString *const AWSInfoCloudWatch = @"CloudWatch";
 NSString *const AWSCloudWatchSDKVersion = @"2.13.0";
@@ -94,9 +96,12 @@ static NSDictionary *errorCodeDictionary = nil;
 
     if (!*error && [responseObject isKindOfClass:[NSDictionary class]]) {
         if (self.outputClass) {
+            AWSNetworkingRequestMetrics *metrics = [AWSNetworkingRequestMetrics currentMetrics];
+            [metrics beginPhase:AWSNetworkingRequestPhaseModelMapping];
             responseObject = [AWSMTLJSONAdapter modelOfClass:self.outputClass
                                           fromJSONDictionary:responseObject
                                                        error:error];
+            [metrics endPhase:AWSNetworkingRequestPhaseModelMapping];
         }
     }
 
@@ -238,10 +243,18 @@ static AWSSynchronizedMutableDictionary *_serviceClients = nil;
         AWSSignatureV4Signer *signer = [[AWSSignatureV4Signer alloc] initWithCredentialsProvider:_configuration.credentialsProvider
                                                                                         endpoint:_configuration.endpoint];
         AWSNetworkingRequestInterceptor *baseInterceptor = [[AWSNetworkingRequestInterceptor alloc] initWithUserAgent:_configuration.userAgent];
-        _configuration.requestInterceptors = @[baseInterceptor, signer];
+        if (_configuration.isRequestCompressionEnabled) {
+            // Compressed before signing so the signature covers the body that is sent. The bundled model predates the
+            // requestcompression trait, so the operations that accept gzip are listed here.
+            AWSNetworkingRequestCompressionInterceptor *compressionInterceptor = [[AWSNetworkingRequestCompressionInterceptor alloc] initWithOperationNames:[NSSet setWithObject:@"PutMetricData"]];
+            _configuration.requestInterceptors = @[baseInterceptor, compressionInterceptor, signer];
+        } else {
+            _configuration.requestInterceptors = @[baseInterceptor, signer];
+        }
 
         _configuration.baseURL = _configuration.endpoint.URL;
-        _configuration.retryHandler = [[AWSCloudWatchRequestRetryHandler alloc] initWithMaximumRetryCount:_configuration.maxRetryCount];
+        _configuration.retryHandler = [[AWSCloudWatchRequestRetryHandler alloc] initWithMaximumRetryCount:_configuration.maxRetryCount
+                                                                                                retryMode:_configuration.retryMode];
          
 		
         _networking = [[AWSNetworking alloc] initWithConfiguration:_configuration];
@@ -263,18 +276,28 @@ static AWSSynchronizedMutableDictionary *_serviceClients = nil;
         }
 
         AWSNetworkingRequest *networkingRequest = request.internalRequest;
+        networkingRequest.metrics = [[AWSNetworkingRequestMetrics alloc] initWithServiceName:self.configuration.endpoint.serviceName
+                                                                               operationName:operationName];
         if (request) {
+            [networkingRequest.metrics beginPhase:AWSNetworkingRequestPhaseModelSerialization];
             networkingRequest.parameters = [[AWSMTLJSONAdapter JSONDictionaryFromModel:request] aws_removeNullValues];
+            [networkingRequest.metrics endPhase:AWSNetworkingRequestPhaseModelSerialization];
         } else {
             networkingRequest.parameters = @{};
         }
 
         networkingRequest.HTTPMethod = HTTPMethod;
-        networkingRequest.requestSerializer = [[AWSQueryStringRequestSerializer alloc] initWithJSONDefinition:[[AWSCloudWatchResources sharedInstance] JSONObject]
-                                                                                                   actionName:operationName];
-        networkingRequest.responseSerializer = [[AWSCloudWatchResponseSerializer alloc] initWithJSONDefinition:[[AWSCloudWatchResources sharedInstance] JSONObject]
-                                                                                             actionName:operationName
-                                                                                            outputClass:outputClass];
+        networkingRequest.requestSerializer = [self requestSerializerForOperationName:operationName
+                                                                           usingBlock:^id<AWSURLRequestSerializer> {
+            return [[AWSQueryStringRequestSerializer alloc] initWithJSONDefinition:[[AWSCloudWatchResources sharedInstance] JSONObject]
+                                                                        actionName:operationName];
+        }];
+        networkingRequest.responseSerializer = [self responseSerializerForOperationName:operationName
+                                                                             usingBlock:^id<AWSHTTPURLResponseSerializer> {
+            return [[AWSCloudWatchResponseSerializer alloc] initWithJSONDefinition:[[AWSCloudWatchResources sharedInstance] JSONObject]
+                                                                        actionName:operationName
+                                                                       outputClass:outputClass];
+        }];
         
         return [self.networking sendRequest:networkingRequest];
     }
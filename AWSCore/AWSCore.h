@@ -55,11 +55,21 @@ FOUNDATION_EXPORT const unsigned char AWSCoreVersionString[] DEPRECATED_MSG_ATTR
 
 #import "AWSClientContext.h"
 #import "AWSSynchronizedMutableDictionary.h"
+#import "AWSEncoding.h"
 #import "AWSXMLDictionary.h"
 #import "AWSSerialization.h"
 #import "AWSURLRequestSerialization.h"
 #import "AWSURLResponseSerialization.h"
+#import "AWSLazyJSONDictionary.h"
 #import "AWSURLSessionManager.h"
+#import "AWSURLSessionPool.h"
+#import "AWSNetworkingMetrics.h"
+#import "AWSNetworkingHedgingPolicy.h"
+#import "AWSNetworkingCircuitBreaker.h"
+#import "AWSNetworkingRequestCoalescer.h"
+#import "AWSNetworkingRequestScheduler.h"
+#import "AWSNetworkingWireLogger.h"
+#import "AWSNetworkingRequestCompressionInterceptor.h"
 #import "AWSSignature.h"
 #import "AWSURLRequestRetryHandler.h"
 #import "AWSValidation.h"
@@ -29,6 +29,7 @@ FOUNDATION_EXPORT NSString * _Nonnull const AWSSignatureV4Terminator;
 + (NSString * _Nonnull)hashString:(NSString * _Nullable)stringToHash;
 + (NSData * _Nonnull)hash:(NSData * _Nullable)dataToHash;
 + (NSString * _Nonnull)hexEncode:(NSString * _Nullable)string;
++ (NSString * _Nonnull)hexEncodeData:(NSData * _Nullable)data;
 + (NSString * _Nullable)HMACSign:(NSData * _Nullable)data withKey:(NSString * _Nonnull)key usingAlgorithm:(uint32_t)algorithm;
 
 @end
@@ -21,6 +21,8 @@
 #import "AWSCocoaLumberjack.h"
 #import "AWSBolts.h"
 #import "AWSNetworkingHelpers.h"
+#import "AWSNetworkingMetrics.h"
+#import "AWSEncoding.h"
 
 static NSString *const AWSSigV4Marker = @"AWS4";
 NSString *const AWSSignatureV4Algorithm = @"AWS4-HMAC-SHA256";
@@ -61,31 +63,24 @@ NSString *const AWSSignatureV4Terminator = @"aws4_request";
 }
 
 + (NSString *)hexEncode:(NSString *)string {
-    NSUInteger len = [string length];
-    if (len == 0) {
-        return @"";
+    NSData *data = [string dataUsingEncoding:NSISOLatin1StringEncoding];
+    if (data) {
+        return AWSHexEncodedString(data);
     }
-    unichar *chars = malloc(len * sizeof(unichar));
-    if (chars == NULL) {
-        // this situation is irrecoverable and we don't want to return something corrupted, so we raise an exception (avoiding NSAssert that may be disabled)
-        [NSException raise:@"NSInternalInconsistencyException" format:@"failed malloc" arguments:nil];
-        return nil;
-    }
-
-    [string getCharacters:chars];
 
+    // characters above U+00FF are written with as many digits as they need
     NSMutableString *hexString = [NSMutableString new];
-    for (NSUInteger i = 0; i < len; i++) {
-        if ((int)chars[i] < 16) {
-            [hexString appendString:@"0"];
-        }
-        [hexString appendString:[NSString stringWithFormat:@"%x", chars[i]]];
+    for (NSUInteger i = 0; i < [string length]; i++) {
+        [hexString appendFormat:@"%02x", [string characterAtIndex:i]];
     }
-    free(chars);
 
     return hexString;
 }
 
++ (NSString *)hexEncodeData:(NSData *)data {
+    return AWSHexEncodedString(data);
+}
+
 + (NSString *)HMACSign:(NSData *)data withKey:(NSString *)key usingAlgorithm:(CCHmacAlgorithm)algorithm {
     CCHmacContext context;
     const char    *keyCString = [key cStringUsingEncoding:NSASCIIStringEncoding];
@@ -151,7 +146,11 @@ NSString *const AWSSignatureV4Terminator = @"aws4_request";
 
 - (AWSTask *)interceptRequest:(NSMutableURLRequest *)request {
     [request setValue:request.URL.host forHTTPHeaderField:@"Host"];
+    NSTimeInterval credentialRetrievalStartTime = [AWSNetworkingRequestMetrics currentTime];
     return [[self.credentialsProvider credentials] continueWithSuccessBlock:^id _Nullable(AWSTask<AWSCredentials *> * _Nonnull task) {
+        [NSURLProtocol setProperty:@([AWSNetworkingRequestMetrics currentTime] - credentialRetrievalStartTime)
+                            forKey:AWSNetworkingRequestMetricsCredentialRetrievalDurationKey
+                         inRequest:request];
         AWSCredentials *credentials = task.result;
         // clear authorization header if set
         [request setValue:nil forHTTPHeaderField:@"Authorization"];
@@ -231,7 +230,7 @@ NSString *const AWSSignatureV4Terminator = @"aws4_request";
         [urlRequest addValue:@"aws-chunked" forHTTPHeaderField:@"Content-Encoding"]; //add aws-chunked keyword for s3 chunk upload
         [urlRequest setValue:[NSString stringWithFormat:@"%lu", (unsigned long)contentLength] forHTTPHeaderField:@"x-amz-decoded-content-length"];
     } else {
-        contentSha256 = [AWSSignatureSignerUtility hexEncode:[[NSString alloc] initWithData:[AWSSignatureSignerUtility hash:[urlRequest HTTPBody]] encoding:NSASCIIStringEncoding]];
+        contentSha256 = [AWSSignatureSignerUtility hexEncodeData:[AWSSignatureSignerUtility hash:[urlRequest HTTPBody]]];
         //using Content-Length with value of '0' cause auth issue, remove it.
         if (contentLength == 0) {
             [urlRequest setValue:nil forHTTPHeaderField:@"Content-Length"];
@@ -268,7 +267,7 @@ NSString *const AWSSignatureV4Terminator = @"aws4_request";
                               AWSSignatureV4Algorithm,
                               [urlRequest valueForHTTPHeaderField:@"X-Amz-Date"],
                               scope,
-                              [AWSSignatureSignerUtility hexEncode:[AWSSignatureSignerUtility hashString:canonicalRequest]]];
+                              [AWSSignatureSignerUtility hexEncodeData:[AWSSignatureSignerUtility hash:[canonicalRequest dataUsingEncoding:NSUTF8StringEncoding]]]];
     // AWSDDLogVerbose(@"AWS4 String to Sign: [%@]", stringToSign);
 
     NSData *kSigning  = [AWSSignatureV4Signer getV4DerivedKey:credentials.secretKey
@@ -278,8 +277,7 @@ NSString *const AWSSignatureV4Terminator = @"aws4_request";
 
     NSData *signature = [AWSSignatureSignerUtility sha256HMacWithData:[stringToSign dataUsingEncoding:NSUTF8StringEncoding]
                                                               withKey:kSigning];
-    NSString *signatureString = [AWSSignatureSignerUtility hexEncode:[[NSString alloc] initWithData:signature
-                                                                                           encoding:NSASCIIStringEncoding]];
+    NSString *signatureString = [AWSSignatureSignerUtility hexEncodeData:signature];
 
     NSString *authorization = [NSString stringWithFormat:@"%@ Credential=%@, SignedHeaders=%@, Signature=%@",
                                AWSSignatureV4Algorithm,
@@ -324,7 +322,7 @@ NSString *const AWSSignatureV4Terminator = @"aws4_request";
         query = [NSString stringWithFormat:@""];
     }
 
-    NSString *contentSha256 = [AWSSignatureSignerUtility hexEncode:[[NSString alloc] initWithData:[AWSSignatureSignerUtility hash:request.HTTPBody] encoding:NSASCIIStringEncoding]];
+    NSString *contentSha256 = [AWSSignatureSignerUtility hexEncodeData:[AWSSignatureSignerUtility hash:request.HTTPBody]];
 
     NSString *canonicalRequest = [AWSSignatureV4Signer getCanonicalizedRequest:request.HTTPMethod
                                                                           path:path
@@ -347,7 +345,7 @@ NSString *const AWSSignatureV4Terminator = @"aws4_request";
                               AWSSignatureV4Algorithm,
                               [request valueForHTTPHeaderField:@"X-Amz-Date"],
                               scope,
-                              [AWSSignatureSignerUtility hexEncode:[AWSSignatureSignerUtility hashString:canonicalRequest]]];
+                              [AWSSignatureSignerUtility hexEncodeData:[AWSSignatureSignerUtility hash:[canonicalRequest dataUsingEncoding:NSUTF8StringEncoding]]]];
 
     //  AWSDDLogVerbose(@"AWS4 String to Sign: [%@]", stringToSign);
 
@@ -360,7 +358,7 @@ NSString *const AWSSignatureV4Terminator = @"aws4_request";
 
     NSString *credentialsAuthorizationHeader = [NSString stringWithFormat:@"Credential=%@", signingCredentials];
     NSString *signedHeadersAuthorizationHeader = [NSString stringWithFormat:@"SignedHeaders=%@", [AWSSignatureV4Signer getSignedHeadersString:request.allHTTPHeaderFields]];
-    NSString *signatureAuthorizationHeader = [NSString stringWithFormat:@"Signature=%@", [AWSSignatureSignerUtility hexEncode:[[NSString alloc] initWithData:signature encoding:NSASCIIStringEncoding]]];
+    NSString *signatureAuthorizationHeader = [NSString stringWithFormat:@"Signature=%@", [AWSSignatureSignerUtility hexEncodeData:signature]];
 
     NSString *authorization = [NSString stringWithFormat:@"%@ %@, %@, %@",
                                AWSSignatureV4Algorithm,
@@ -501,9 +499,7 @@ NSString *const AWSSignatureV4Terminator = @"aws4_request";
             //in case of http get we sign the body as an empty string only if the sign body flag is set to true
             NSData *emptyData = [@"" dataUsingEncoding:NSUTF8StringEncoding];
             NSData *emptyDataHash = [AWSSignatureSignerUtility hash:emptyData];
-            NSString *emptyDataEncodedString = [[NSString alloc] initWithData:emptyDataHash
-                                                                     encoding:NSASCIIStringEncoding];
-            contentSha256 = [AWSSignatureSignerUtility hexEncode:emptyDataEncodedString];
+            contentSha256 = [AWSSignatureSignerUtility hexEncodeData:emptyDataHash];
         } else {
             contentSha256 = @"UNSIGNED-PAYLOAD";
         }
@@ -525,7 +521,7 @@ NSString *const AWSSignatureV4Terminator = @"aws4_request";
                                   AWSSignatureV4Algorithm,
                                   [date aws_stringValue:AWSDateISO8601DateFormat2],
                                   credentialsScope,
-                                  [AWSSignatureSignerUtility hexEncode:[AWSSignatureSignerUtility hashString:canonicalRequest]]];
+                                  [AWSSignatureSignerUtility hexEncodeData:[AWSSignatureSignerUtility hash:[canonicalRequest dataUsingEncoding:NSUTF8StringEncoding]]]];
         
       //  AWSDDLogVerbose(@"AWS4 PresignedURL String to Sign: [%@]", stringToSign);
         AWSDDLogVerbose(@"AWS4 PresignedURL finished");
@@ -536,8 +532,7 @@ NSString *const AWSSignatureV4Terminator = @"aws4_request";
                                                           service:serviceName];
         NSData *signature = [AWSSignatureSignerUtility sha256HMacWithData:[stringToSign dataUsingEncoding:NSUTF8StringEncoding]
                                                                   withKey:kSigning];
-        NSString *signatureString = [AWSSignatureSignerUtility hexEncode:[[NSString alloc] initWithData:signature
-                                                                                               encoding:NSASCIIStringEncoding]];
+        NSString *signatureString = [AWSSignatureSignerUtility hexEncodeData:signature];
         
         // ============  generate v4 signature string (END) ===================
         
@@ -724,9 +719,9 @@ NSString *const AWSSignatureV4Terminator = @"aws4_request";
         NSString *key   = [sortedKeys objectAtIndex:index];
         NSString *value = (NSString *)[parameters valueForKey:key];
 
-        [mutableHTTPBodyString appendString:[key aws_stringWithURLEncoding]];
+        [mutableHTTPBodyString aws_appendStringWithURLEncoding:key];
         [mutableHTTPBodyString appendString:@"="];
-        [mutableHTTPBodyString appendString:[value aws_stringWithURLEncoding]];
+        [mutableHTTPBodyString aws_appendStringWithURLEncoding:value];
 
         if (index < [sortedKeys count] - 1) {
             [mutableHTTPBodyString appendString:@"&"];
@@ -783,7 +778,11 @@ NSString *const AWSSignatureV4Terminator = @"aws4_request";
 }
 
 - (AWSTask *)interceptRequest:(NSMutableURLRequest *)request {
+    NSTimeInterval credentialRetrievalStartTime = [AWSNetworkingRequestMetrics currentTime];
     return [[self.credentialsProvider credentials] continueWithSuccessBlock:^id _Nullable(AWSTask<AWSCredentials *> * _Nonnull task) {
+        [NSURLProtocol setProperty:@([AWSNetworkingRequestMetrics currentTime] - credentialRetrievalStartTime)
+                            forKey:AWSNetworkingRequestMetricsCredentialRetrievalDurationKey
+                         inRequest:request];
         AWSCredentials *credentials = task.result;
 
         NSString *HTTPBodyString = [[NSString alloc] initWithData:request.HTTPBody
@@ -948,8 +947,7 @@ static NSString *const emptyStringSha256 = @"e3b0c44298fc1c149afbf4c8996fb92427a
 }
 
 - (NSString *)dataToHexString:(NSData *) data {
-    return [AWSSignatureSignerUtility hexEncode:[[NSString alloc] initWithData:data
-                                                                      encoding:NSASCIIStringEncoding]];
+    return [AWSSignatureSignerUtility hexEncodeData:data];
 }
 
 #pragma mark NSInputStream methods
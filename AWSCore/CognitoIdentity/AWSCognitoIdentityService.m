@@ -16,6 +16,7 @@
 #import "AWSCognitoIdentityService.h"
 #import "AWSCategory.h"
 #import "AWSNetworking.h"
+#import "AWSNetworkingMetrics.h"
 #import "AWSSignature.h"
 #import "AWSService.h"
 #import "AWSURLRequestSerialization.h"
@@ -92,9 +93,12 @@ static NSDictionary *errorCodeDictionary = nil;
 
     if (!*error && [responseObject isKindOfClass:[NSDictionary class]]) {
         if (self.outputClass) {
+            AWSNetworkingRequestMetrics *metrics = [AWSNetworkingRequestMetrics currentMetrics];
+            [metrics beginPhase:AWSNetworkingRequestPhaseModelMapping];
             responseObject = [AWSMTLJSONAdapter modelOfClass:self.outputClass
                                           fromJSONDictionary:responseObject
                                                        error:error];
+            [metrics endPhase:AWSNetworkingRequestPhaseModelMapping];
         }
     }
 	
@@ -230,7 +234,8 @@ static AWSSynchronizedMutableDictionary *_serviceClients = nil;
         _configuration.requestInterceptors = @[baseInterceptor, signer];
 
         _configuration.baseURL = _configuration.endpoint.URL;
-        _configuration.retryHandler = [[AWSCognitoIdentityRequestRetryHandler alloc] initWithMaximumRetryCount:_configuration.maxRetryCount];
+        _configuration.retryHandler = [[AWSCognitoIdentityRequestRetryHandler alloc] initWithMaximumRetryCount:_configuration.maxRetryCount
+                                                                                                     retryMode:_configuration.retryMode];
         _configuration.headers = @{@"Content-Type" : @"application/x-amz-json-1.1"}; 
 		
         _networking = [[AWSNetworking alloc] initWithConfiguration:_configuration];
@@ -252,8 +257,12 @@ static AWSSynchronizedMutableDictionary *_serviceClients = nil;
         }
 
         AWSNetworkingRequest *networkingRequest = request.internalRequest;
+        networkingRequest.metrics = [[AWSNetworkingRequestMetrics alloc] initWithServiceName:self.configuration.endpoint.serviceName
+                                                                               operationName:operationName];
         if (request) {
+            [networkingRequest.metrics beginPhase:AWSNetworkingRequestPhaseModelSerialization];
             networkingRequest.parameters = [[AWSMTLJSONAdapter JSONDictionaryFromModel:request] aws_removeNullValues];
+            [networkingRequest.metrics endPhase:AWSNetworkingRequestPhaseModelSerialization];
         } else {
             networkingRequest.parameters = @{};
         }
@@ -262,11 +271,17 @@ static AWSSynchronizedMutableDictionary *_serviceClients = nil;
         headers[@"X-Amz-Target"] = [NSString stringWithFormat:@"%@.%@", targetPrefix, operationName];
         networkingRequest.headers = headers;
         networkingRequest.HTTPMethod = HTTPMethod;
-        networkingRequest.requestSerializer = [[AWSJSONRequestSerializer alloc] initWithJSONDefinition:[[AWSCognitoIdentityResources sharedInstance] JSONObject]
-                                                                                                   actionName:operationName];
-        networkingRequest.responseSerializer = [[AWSCognitoIdentityResponseSerializer alloc] initWithJSONDefinition:[[AWSCognitoIdentityResources sharedInstance] JSONObject]
-                                                                                             actionName:operationName
-                                                                                            outputClass:outputClass];
+        networkingRequest.requestSerializer = [self requestSerializerForOperationName:operationName
+                                                                           usingBlock:^id<AWSURLRequestSerializer> {
+            return [[AWSJSONRequestSerializer alloc] initWithJSONDefinition:[[AWSCognitoIdentityResources sharedInstance] JSONObject]
+                                                                 actionName:operationName];
+        }];
+        networkingRequest.responseSerializer = [self responseSerializerForOperationName:operationName
+                                                                             usingBlock:^id<AWSHTTPURLResponseSerializer> {
+            return [[AWSCognitoIdentityResponseSerializer alloc] initWithJSONDefinition:[[AWSCognitoIdentityResources sharedInstance] JSONObject]
+                                                                             actionName:operationName
+                                                                            outputClass:outputClass];
+        }];
         
         return [self.networking sendRequest:networkingRequest];
     }
@@ -9,6 +9,7 @@
 #import "AWSMTLJSONAdapter.h"
 #import "AWSMTLModel.h"
 #import "AWSMTLReflection.h"
+#import <objc/runtime.h>
 
 NSString * const AWSMTLJSONAdapterErrorDomain = @"AWSMTLJSONAdapterErrorDomain";
 const NSInteger AWSMTLJSONAdapterErrorNoClassFound = 2;
@@ -21,6 +22,9 @@ const NSInteger AWSMTLJSONAdapterErrorExceptionThrown = 1;
 // Associated with the NSException that was caught.
 static NSString * const AWSMTLJSONAdapterThrownExceptionErrorKey = @"AWSMTLJSONAdapterThrownException";
 
+// Used to cache the transformers of each model class, keyed by property key.
+static void *AWSMTLJSONAdapterCachedTransformersKey = &AWSMTLJSONAdapterCachedTransformersKey;
+
 @interface AWSMTLJSONAdapter ()
 
 // The MTLModel subclass being parsed, or the class of `model` if parsing has
@@ -30,6 +34,10 @@ static NSString * const AWSMTLJSONAdapterThrownExceptionErrorKey = @"AWSMTLJSONA
 // A cached copy of the return value of +JSONKeyPathsByPropertyKey.
 @property (nonatomic, copy, readonly) NSDictionary *JSONKeyPathsByPropertyKey;
 
+// The transformers of `modelClass`, keyed by property key. NSNull stands for
+// no transformer.
+@property (nonatomic, copy, readonly) NSDictionary *JSONTransformersByPropertyKey;
+
 // Looks up the NSValueTransformer that should be used for the given key.
 //
 // key - The property key to transform from or to. This argument must not be nil.
@@ -139,6 +147,7 @@ static NSString * const AWSMTLJSONAdapterThrownExceptionErrorKey = @"AWSMTLJSONA
 
 	_modelClass = modelClass;
 	_JSONKeyPathsByPropertyKey = [[modelClass JSONKeyPathsByPropertyKey] copy];
+	_JSONTransformersByPropertyKey = [self cachedJSONTransformers];
 
 	NSMutableDictionary *dictionaryValue = [[NSMutableDictionary alloc] initWithCapacity:JSONDictionary.count];
 
@@ -228,6 +237,7 @@ static NSString * const AWSMTLJSONAdapterThrownExceptionErrorKey = @"AWSMTLJSONA
 	_model = model;
 	_modelClass = model.class;
 	_JSONKeyPathsByPropertyKey = [[model.class JSONKeyPathsByPropertyKey] copy];
+	_JSONTransformersByPropertyKey = [self cachedJSONTransformers];
 
 	return self;
 }
@@ -250,6 +260,13 @@ static NSString * const AWSMTLJSONAdapterThrownExceptionErrorKey = @"AWSMTLJSONA
 			value = [transformer reverseTransformedValue:value] ?: NSNull.null;
 		}
 
+		// Most key paths are a single key, which needs no intermediate
+		// dictionaries.
+		if ([JSONKeyPath rangeOfString:@"."].location == NSNotFound) {
+			JSONDictionary[JSONKeyPath] = value;
+			return;
+		}
+
 		NSArray *keyPathComponents = [JSONKeyPath componentsSeparatedByString:@"."];
 
 		// Set up dictionaries at each step of the key path.
@@ -270,9 +287,36 @@ static NSString * const AWSMTLJSONAdapterThrownExceptionErrorKey = @"AWSMTLJSONA
 	return JSONDictionary;
 }
 
+- (NSDictionary *)cachedJSONTransformers {
+	// Looking a transformer up takes an NSInvocation and usually creates the
+	// transformer, so they are cached per class. They keep no state.
+	NSDictionary *cachedTransformers = objc_getAssociatedObject(self.modelClass, AWSMTLJSONAdapterCachedTransformersKey);
+	if (cachedTransformers != nil) return cachedTransformers;
+
+	NSMutableDictionary *transformers = [NSMutableDictionary dictionary];
+	for (NSString *key in [self.modelClass propertyKeys]) {
+		transformers[key] = [self uncachedJSONTransformerForKey:key] ?: NSNull.null;
+	}
+
+	cachedTransformers = [transformers copy];
+
+	// It doesn't really matter if we replace another thread's work, since we do
+	// it atomically and the result should be the same.
+	objc_setAssociatedObject(self.modelClass, AWSMTLJSONAdapterCachedTransformersKey, cachedTransformers, OBJC_ASSOCIATION_RETAIN);
+
+	return cachedTransformers;
+}
+
 - (NSValueTransformer *)JSONTransformerForKey:(NSString *)key {
 	NSParameterAssert(key != nil);
 
+	id transformer = self.JSONTransformersByPropertyKey[key];
+	if (transformer == nil) return [self uncachedJSONTransformerForKey:key];
+
+	return transformer == NSNull.null ? nil : transformer;
+}
+
+- (NSValueTransformer *)uncachedJSONTransformerForKey:(NSString *)key {
 	SEL selector = AWSMTLSelectorWithKeyPattern(key, "JSONTransformer");
 	if ([self.modelClass respondsToSelector:selector]) {
 		NSInvocation *invocation = [NSInvocation invocationWithMethodSignature:[self.modelClass methodSignatureForSelector:selector]];
@@ -15,12 +15,15 @@
 
 #import <Foundation/Foundation.h>
 #import "AWSModel.h"
+#import "AWSNetworkingRequestScheduler.h"
 
 FOUNDATION_EXPORT NSString *const AWSNetworkingErrorDomain;
 typedef NS_ENUM(NSInteger, AWSNetworkingErrorType) {
     AWSNetworkingErrorUnknown,
     AWSNetworkingErrorCancelled,
-    AWSNetworkingErrorSessionInvalid
+    AWSNetworkingErrorSessionInvalid,
+    AWSNetworkingErrorCircuitOpen,
+    AWSNetworkingErrorDeadlineExceeded
 };
 
 typedef NS_ENUM(NSInteger, AWSNetworkingRetryType) {
@@ -32,15 +35,31 @@ typedef NS_ENUM(NSInteger, AWSNetworkingRetryType) {
     AWSNetworkingRetryTypeResetStreamAndRetry
 };
 
+typedef NS_ENUM(NSInteger, AWSNetworkingRetryMode) {
+    AWSNetworkingRetryModeLegacy,
+    AWSNetworkingRetryModeStandard,
+    AWSNetworkingRetryModeAdaptive
+};
+
 /** UserInfo dictionary key for response errors */
 FOUNDATION_EXPORT NSString *const AWSResponseObjectErrorUserInfoKey;
 
+/** `NSURLProtocol` property key under which request interceptors find the name of the operation being sent */
+FOUNDATION_EXPORT NSString *const AWSNetworkingRequestOperationNameKey;
+
 @class AWSNetworkingConfiguration;
 @class AWSNetworkingRequest;
+@class AWSNetworkingRequestMetrics;
+@class AWSNetworkingHedgingPolicy;
+@class AWSNetworkingCircuitBreaker;
+@class AWSNetworkingRequestCoalescer;
+@class AWSNetworkingWireLogger;
 @class AWSTask<__covariant ResultType>;
+@class AWSCancellationToken;
 
 typedef void (^AWSNetworkingUploadProgressBlock) (int64_t bytesSent, int64_t totalBytesSent, int64_t totalBytesExpectedToSend);
 typedef void (^AWSNetworkingDownloadProgressBlock) (int64_t bytesWritten, int64_t totalBytesWritten, int64_t totalBytesExpectedToWrite);
+typedef void (^AWSNetworkingResponseDataBlock) (NSData *data);
 
 #pragma mark - AWSHTTPMethod
 
@@ -136,6 +155,25 @@ typedef NS_ENUM(NSInteger, AWSHTTPMethod) {
 
 - (NSDictionary *)resetParameters:(NSDictionary *)parameters;
 
+/**
+ Returns how long the request should wait before it is sent. Used by the adaptive retry mode to rate limit requests to an endpoint that is throttling.
+ */
+- (NSTimeInterval)timeIntervalBeforeSendingRequest:(AWSNetworkingRequest *)request;
+
+/**
+ Called after `shouldRetry:originalRequest:response:data:error:` decided to retry. Returning `NO` cancels the retry, e.g. when the retry quota for the endpoint is exhausted.
+ */
+- (BOOL)acquireRetryQuotaForRequest:(AWSNetworkingRequest *)request
+                           response:(NSHTTPURLResponse *)response
+                              error:(NSError *)error;
+
+/**
+ Called every time an attempt of the request completes, successfully or not.
+ */
+- (void)didCompleteRequest:(AWSNetworkingRequest *)request
+                  response:(NSHTTPURLResponse *)response
+                     error:(NSError *)error;
+
 @end
 
 
@@ -162,6 +200,41 @@ typedef NS_ENUM(NSInteger, AWSHTTPMethod) {
  */
 @property (nonatomic, assign) uint32_t maxRetryCount;
 
+/**
+ The retry strategy of the service clients. `AWSNetworkingRetryModeLegacy` keeps the fixed exponential back-off. `AWSNetworkingRetryModeStandard` adds full jitter and a per-endpoint retry quota that shrinks on failures and refills on success. `AWSNetworkingRetryModeAdaptive` additionally rate limits the requests to an endpoint when it returns throttling errors. The default value is `AWSNetworkingRetryModeLegacy`.
+ */
+@property (nonatomic, assign) AWSNetworkingRetryMode retryMode;
+
+/**
+ When set, slow requests of the operations listed by the policy are duplicated and the first successful response is used. The default value is `nil`, which turns hedging off.
+ */
+@property (nonatomic, strong) AWSNetworkingHedgingPolicy *hedgingPolicy;
+
+/**
+ When set, requests to an endpoint that keeps failing fail fast with `AWSNetworkingErrorCircuitOpen`. The default value is `nil`.
+ */
+@property (nonatomic, strong) AWSNetworkingCircuitBreaker *circuitBreaker;
+
+/**
+ When set, identical idempotent reads that are in flight at the same time are sent only once. The default value is `nil`.
+ */
+@property (nonatomic, strong) AWSNetworkingRequestCoalescer *requestCoalescer;
+
+/**
+ When set, requests wait for admission when too many of their priority class or to their host are in flight. The default value is `nil`.
+ */
+@property (nonatomic, strong) AWSNetworkingRequestScheduler *requestScheduler;
+
+/**
+ When set, requests and responses are logged as they go over the wire. The default value is `nil`, which turns wire logging off.
+ */
+@property (nonatomic, strong) AWSNetworkingWireLogger *wireLogger;
+
+/**
+ When `YES`, service clients compress the request bodies of the operations their definition marks as accepting gzip. The default value is `NO`.
+ */
+@property (nonatomic, assign, getter = isRequestCompressionEnabled) BOOL requestCompressionEnabled;
+
 /**
  The timeout interval to use when waiting for additional data.
  */
@@ -186,6 +259,41 @@ typedef NS_ENUM(NSInteger, AWSHTTPMethod) {
 @property (nonatomic, copy) AWSNetworkingUploadProgressBlock uploadProgress;
 @property (nonatomic, copy) AWSNetworkingDownloadProgressBlock downloadProgress;
 
+/**
+ When set, the body of a successful response is handed to this block chunk by chunk as it arrives, instead of being accumulated in memory and passed to the response serializer. Chunks are delivered in order on a serial background queue. Ignored when `downloadingFileURL` is set.
+ */
+@property (nonatomic, copy) AWSNetworkingResponseDataBlock responseDataHandler;
+
+/**
+ When set, the body of a successful response is written to this stream as it arrives. The stream is opened when the response starts and closed when the request completes. Ignored when `downloadingFileURL` is set.
+ */
+@property (nonatomic, strong) NSOutputStream *responseOutputStream;
+
+/**
+ The maximum number of streamed response bytes that may be waiting for `responseDataHandler` or `responseOutputStream`. When it is exceeded, the transfer is suspended until the consumer catches up. The default value is 1 MB.
+ */
+@property (nonatomic, assign) NSUInteger responseStreamingWindowSize;
+
+/**
+ The timings of the request. Service clients set a new instance for every invocation; otherwise one is created when the request is sent. Completed metrics are delivered to the observers registered with `AWSNetworkingRequestMetrics`.
+ */
+@property (nonatomic, strong) AWSNetworkingRequestMetrics *metrics;
+
+/**
+ The class the request is admitted in when a `requestScheduler` is set. The default value is `AWSNetworkingRequestPriorityDefault`.
+ */
+@property (nonatomic, assign) AWSNetworkingRequestPriority priority;
+
+/**
+ When set, the request including its retries, credential refresh and response parsing must complete by this date. Once it passes, the request is cancelled and fails with `AWSNetworkingErrorDeadlineExceeded`; a retry whose back-off would end after it is not attempted.
+ */
+@property (nonatomic, strong) NSDate *deadline;
+
+/**
+ When set, requesting cancellation on the token cancels the request. The request then fails with `AWSNetworkingErrorCancelled`.
+ */
+@property (nonatomic, strong) AWSCancellationToken *cancellationToken;
+
 @property (readonly, nonatomic, strong) NSURLSessionTask *task;
 @property (readonly, nonatomic, assign, getter = isCancelled) BOOL cancelled;
 
@@ -199,9 +307,26 @@ typedef NS_ENUM(NSInteger, AWSHTTPMethod) {
 
 @property (nonatomic, copy) AWSNetworkingUploadProgressBlock uploadProgress;
 @property (nonatomic, copy) AWSNetworkingDownloadProgressBlock downloadProgress;
+@property (nonatomic, copy) AWSNetworkingResponseDataBlock responseDataHandler;
+@property (nonatomic, strong) NSOutputStream *responseOutputStream;
 @property (nonatomic, assign, readonly, getter = isCancelled) BOOL cancelled;
 @property (nonatomic, strong) NSURL *downloadingFileURL;
 
+/**
+ The class the request is admitted in when the client has a `requestScheduler`.
+ */
+@property (nonatomic, assign) AWSNetworkingRequestPriority priority;
+
+/**
+ The date by which the request including its retries must complete. See `AWSNetworkingRequest.deadline`.
+ */
+@property (nonatomic, strong) NSDate *deadline;
+
+/**
+ Requesting cancellation on the token cancels the request.
+ */
+@property (nonatomic, strong) AWSCancellationToken *cancellationToken;
+
 - (AWSTask *)cancel;
 - (AWSTask *)pause;
 
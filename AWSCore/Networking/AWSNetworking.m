@@ -14,6 +14,7 @@
 //
 
 #import "AWSNetworking.h"
+#import <objc/runtime.h>
 #if TARGET_OS_IPHONE || TARGET_IPHONE_SIMULATOR
 #import <UIKit/UIKit.h>
 #else
@@ -21,12 +22,19 @@
 #endif
 #import "AWSBolts.h"
 #import "AWSCategory.h"
+#import "AWSCocoaLumberjack.h"
 #import "AWSModel.h"
 #import "AWSURLSessionManager.h"
+#import "AWSNetworkingMetrics.h"
+#import "AWSNetworkingHedgingPolicy.h"
+#import "AWSNetworkingRequestCoalescer.h"
+#import "AWSNetworkingRequestScheduler.h"
 #import "AWSService.h"
 
 NSString *const AWSNetworkingErrorDomain = @"com.amazonaws.AWSNetworkingErrorDomain";
 
+static void *AWSRequestCachedPropertyKeysKey = &AWSRequestCachedPropertyKeysKey;
+
 #pragma mark - AWSHTTPMethod
 
 @implementation NSString (AWSHTTPMethod)
@@ -70,11 +78,68 @@ NSString *const AWSNetworkingErrorDomain = @"com.amazonaws.AWSNetworkingErrorDom
 
 @end
 
+#pragma mark - AWSNetworkingHedgingPolicy
+
+@interface AWSNetworkingHedgingPolicy()
+
+- (void)recordEligibleRequest;
+- (BOOL)acquireHedge;
+- (void)recordHedgeWon;
+- (void)recordLatencyForRequest:(AWSNetworkingRequest *)request;
+
+@end
+
+#pragma mark - AWSNetworkingRequestCoalescer
+
+@interface AWSNetworkingRequestCoalescer()
+
+- (NSString *)keyForRequest:(AWSNetworkingRequest *)request
+                      scope:(id)scope;
+- (AWSTask *)sendRequest:(AWSNetworkingRequest *)request
+                     key:(NSString *)key
+              usingBlock:(AWSTask *(^)(AWSNetworkingRequest *sharedRequest))block;
+- (void)cancelRequest:(AWSNetworkingRequest *)request
+                  key:(NSString *)key;
+
+@end
+
+#pragma mark - AWSNetworkingRequestScheduler
+
+@interface AWSNetworkingRequestScheduler()
+
+- (void)cancelPendingRequest:(AWSNetworkingRequest *)request;
+
+@end
+
+#pragma mark - AWSNetworkingRequest
+
+@interface AWSNetworkingRequest()
+
+@property (nonatomic, strong) NSURLSessionTask *task;
+@property (nonatomic, assign, getter = isCancelled) BOOL cancelled;
+
+/**
+ The duplicate sent by a hedge, cancelled together with the request.
+ */
+@property (nonatomic, strong) AWSNetworkingRequest *hedgeRequest;
+
+/**
+ Set while the request waits for the response of an identical request, so cancelling it only detaches it.
+ */
+@property (nonatomic, strong) AWSNetworkingRequestCoalescer *waitingCoalescer;
+@property (nonatomic, strong) NSString *coalescingKey;
+
+@property (nonatomic, assign, getter = isDeadlineExceeded) BOOL deadlineExceeded;
+
+@end
+
 #pragma mark - AWSNetworking
 
 @interface AWSNetworking()
 
 @property (nonatomic, strong) AWSURLSessionManager *sessionManager;
+@property (nonatomic, strong) AWSNetworkingHedgingPolicy *hedgingPolicy;
+@property (nonatomic, strong) AWSNetworkingRequestCoalescer *requestCoalescer;
 
 @end
 
@@ -90,13 +155,243 @@ NSString *const AWSNetworkingErrorDomain = @"com.amazonaws.AWSNetworkingErrorDom
 - (instancetype)initWithConfiguration:(AWSNetworkingConfiguration *)configuration {
     if (self = [super init]) {
         _sessionManager = [[AWSURLSessionManager alloc] initWithConfiguration:configuration];
+        _hedgingPolicy = configuration.hedgingPolicy;
+        _requestCoalescer = configuration.requestCoalescer;
     }
 
     return self;
 }
 
 - (AWSTask *)sendRequest:(AWSNetworkingRequest *)request {
-    return [self.sessionManager dataTaskWithRequest:request];
+    AWSCancellationToken *cancellationToken = request.cancellationToken;
+    NSDate *deadline = request.deadline;
+    if (!cancellationToken && !deadline) {
+        return [self coalesceRequestIfNeeded:request];
+    }
+
+    if (cancellationToken.isCancellationRequested) {
+        [request cancel];
+        return [AWSTask taskWithError:[NSError errorWithDomain:AWSNetworkingErrorDomain
+                                                          code:AWSNetworkingErrorCancelled
+                                                      userInfo:nil]];
+    }
+    NSTimeInterval timeIntervalToDeadline = [deadline timeIntervalSinceNow];
+    if (deadline && timeIntervalToDeadline <= 0) {
+        return [AWSTask taskWithError:[AWSNetworking deadlineExceededErrorWithUnderlyingError:nil]];
+    }
+
+    __weak AWSNetworkingRequest *weakRequest = request;
+    AWSCancellationTokenRegistration *registration = [cancellationToken registerCancellationObserverWithBlock:^{
+        [weakRequest cancel];
+    }];
+
+    dispatch_source_t deadlineTimer = nil;
+    if (deadline) {
+        deadlineTimer = dispatch_source_create(DISPATCH_SOURCE_TYPE_TIMER, 0, 0, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0));
+        dispatch_source_set_timer(deadlineTimer, dispatch_time(DISPATCH_TIME_NOW, (int64_t)(timeIntervalToDeadline * NSEC_PER_SEC)), DISPATCH_TIME_FOREVER, 0);
+        dispatch_source_set_event_handler(deadlineTimer, ^{
+            AWSNetworkingRequest *request = weakRequest;
+            @synchronized(request) {
+                request.deadlineExceeded = YES;
+            }
+            [request cancel];
+        });
+        dispatch_resume(deadlineTimer);
+    }
+
+    return [[self coalesceRequestIfNeeded:request] continueWithBlock:^id _Nullable(AWSTask * _Nonnull task) {
+        [registration dispose];
+        if (deadlineTimer) {
+            dispatch_source_cancel(deadlineTimer);
+        }
+
+        // However far the request got, running out of time is reported as such so callers can tell it from a user cancellation.
+        BOOL deadlineExceeded = NO;
+        @synchronized(request) {
+            deadlineExceeded = request.isDeadlineExceeded;
+        }
+        if (task.error
+            && deadlineExceeded
+            && !([task.error.domain isEqualToString:AWSNetworkingErrorDomain] && task.error.code == AWSNetworkingErrorDeadlineExceeded)) {
+            return [AWSTask taskWithError:[AWSNetworking deadlineExceededErrorWithUnderlyingError:task.error]];
+        }
+        if (task.error
+            && cancellationToken.isCancellationRequested
+            && !([task.error.domain isEqualToString:AWSNetworkingErrorDomain] && task.error.code == AWSNetworkingErrorCancelled)) {
+            return [AWSTask taskWithError:[NSError errorWithDomain:AWSNetworkingErrorDomain
+                                                              code:AWSNetworkingErrorCancelled
+                                                          userInfo:@{NSUnderlyingErrorKey: task.error}]];
+        }
+        return task;
+    }];
+}
+
++ (NSError *)deadlineExceededErrorWithUnderlyingError:(NSError *)underlyingError {
+    NSMutableDictionary *userInfo = [NSMutableDictionary dictionaryWithObject:@"The request did not complete before its deadline."
+                                                                       forKey:NSLocalizedDescriptionKey];
+    userInfo[NSUnderlyingErrorKey] = underlyingError;
+
+    return [NSError errorWithDomain:AWSNetworkingErrorDomain
+                               code:AWSNetworkingErrorDeadlineExceeded
+                           userInfo:userInfo];
+}
+
+- (AWSTask *)coalesceRequestIfNeeded:(AWSNetworkingRequest *)request {
+    AWSNetworkingRequestCoalescer *requestCoalescer = self.requestCoalescer;
+    if (!requestCoalescer && !self.hedgingPolicy) {
+        return [self.sessionManager dataTaskWithRequest:request];
+    }
+
+    if (!request.metrics) {
+        request.metrics = [AWSNetworkingRequestMetrics new];
+    }
+    if (!requestCoalescer || ![requestCoalescer isRequestCoalescable:request]) {
+        return [self hedgeRequestIfNeeded:request];
+    }
+
+    // The key is built from the request as it is sent, so it needs the client's base URL and headers.
+    [request assignProperties:self.sessionManager.configuration];
+    NSString *coalescingKey = [requestCoalescer keyForRequest:request
+                                                        scope:self];
+    if (!coalescingKey) {
+        return [self hedgeRequestIfNeeded:request];
+    }
+    @synchronized(request) {
+        request.waitingCoalescer = requestCoalescer;
+        request.coalescingKey = coalescingKey;
+    }
+    return [requestCoalescer sendRequest:request
+                                     key:coalescingKey
+                              usingBlock:^AWSTask *(AWSNetworkingRequest *sharedRequest) {
+                                  return [self hedgeRequestIfNeeded:sharedRequest];
+                              }];
+}
+
+- (AWSTask *)hedgeRequestIfNeeded:(AWSNetworkingRequest *)request {
+    AWSNetworkingHedgingPolicy *hedgingPolicy = self.hedgingPolicy;
+    if (!hedgingPolicy || ![hedgingPolicy isRequestHedgeable:request]) {
+        return [self.sessionManager dataTaskWithRequest:request];
+    }
+
+    [hedgingPolicy recordEligibleRequest];
+    NSTimeInterval hedgeDelay = [hedgingPolicy hedgeDelayForRequest:request];
+    if (hedgeDelay <= 0) {
+        [request.metrics recordHedgeDecision:AWSNetworkingHedgeDecisionInsufficientSamples
+                                  hedgeDelay:0];
+        return [[self.sessionManager dataTaskWithRequest:request] continueWithBlock:^id _Nullable(AWSTask * _Nonnull task) {
+            [hedgingPolicy recordLatencyForRequest:request];
+            return task;
+        }];
+    }
+
+    return [self sendRequest:request
+               hedgingPolicy:hedgingPolicy
+                  hedgeDelay:hedgeDelay];
+}
+
+/**
+ Sends the request and, if it has not started receiving its response after `hedgeDelay`, a duplicate of it.
+ The first successful response completes the returned task and the other request is cancelled. When both
+ fail, the error of the last one to complete is returned.
+ */
+- (AWSTask *)sendRequest:(AWSNetworkingRequest *)request
+           hedgingPolicy:(AWSNetworkingHedgingPolicy *)hedgingPolicy
+              hedgeDelay:(NSTimeInterval)hedgeDelay {
+    // Upgraded when the delay elapses; recorded now because the metrics are delivered when the request completes.
+    [request.metrics recordHedgeDecision:AWSNetworkingHedgeDecisionNotNeeded
+                              hedgeDelay:hedgeDelay];
+
+    AWSTaskCompletionSource *taskCompletionSource = [AWSTaskCompletionSource taskCompletionSource];
+    __block NSUInteger outstandingRequestCount = 1;
+
+    void (^requestDidComplete)(AWSNetworkingRequest *, AWSTask *) = ^(AWSNetworkingRequest *completedRequest, AWSTask *task) {
+        if (!completedRequest.isCancelled) {
+            [hedgingPolicy recordLatencyForRequest:completedRequest];
+        }
+
+        AWSNetworkingRequest *requestToCancel = nil;
+        @synchronized(taskCompletionSource) {
+            outstandingRequestCount--;
+            if (taskCompletionSource.task.completed) {
+                return;
+            }
+            if (task.error && outstandingRequestCount > 0) {
+                // The other request may still succeed.
+                return;
+            }
+
+            AWSNetworkingRequest *hedgeRequest = request.hedgeRequest;
+            request.hedgeRequest = nil;
+            if (completedRequest == hedgeRequest) {
+                [request.metrics recordHedgeWon];
+                [hedgingPolicy recordHedgeWon];
+                requestToCancel = request;
+            } else {
+                requestToCancel = hedgeRequest;
+            }
+
+            if (task.error) {
+                taskCompletionSource.error = task.error;
+            } else {
+                taskCompletionSource.result = task.result;
+            }
+        }
+
+        if (requestToCancel == request) {
+            // Only the attempt is cancelled; the caller's request is not marked as cancelled.
+            [request.task cancel];
+        } else {
+            [requestToCancel cancel];
+        }
+    };
+
+    dispatch_time_t hedgeTime = dispatch_time(DISPATCH_TIME_NOW, (int64_t)(hedgeDelay * NSEC_PER_SEC));
+    dispatch_after(hedgeTime, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+        AWSNetworkingRequest *hedgeRequest = nil;
+        @synchronized(taskCompletionSource) {
+            if (taskCompletionSource.task.completed
+                || request.isCancelled
+                || request.task.response) {
+                return;
+            }
+            if (![hedgingPolicy acquireHedge]) {
+                [request.metrics recordHedgeDecision:AWSNetworkingHedgeDecisionBudgetExhausted
+                                          hedgeDelay:hedgeDelay];
+                return;
+            }
+
+            hedgeRequest = [self hedgeRequestForRequest:request];
+            request.hedgeRequest = hedgeRequest;
+            outstandingRequestCount++;
+            [request.metrics recordHedgeDecision:AWSNetworkingHedgeDecisionHedged
+                                      hedgeDelay:hedgeDelay];
+        }
+
+        AWSDDLogDebug(@"Sending a hedge for %@ %@ after %.3fs.", request.metrics.serviceName, request.metrics.operationName, hedgeDelay);
+        [[self.sessionManager dataTaskWithRequest:hedgeRequest] continueWithBlock:^id _Nullable(AWSTask * _Nonnull task) {
+            requestDidComplete(hedgeRequest, task);
+            return nil;
+        }];
+    });
+
+    [[self.sessionManager dataTaskWithRequest:request] continueWithBlock:^id _Nullable(AWSTask * _Nonnull task) {
+        requestDidComplete(request, task);
+        return nil;
+    }];
+
+    return taskCompletionSource.task;
+}
+
+- (AWSNetworkingRequest *)hedgeRequestForRequest:(AWSNetworkingRequest *)request {
+    AWSNetworkingRequest *hedgeRequest = [request copy];
+    hedgeRequest.parameters = request.parameters;
+    hedgeRequest.priority = request.priority;
+    hedgeRequest.metrics = [[AWSNetworkingRequestMetrics alloc] initWithServiceName:request.metrics.serviceName
+                                                                      operationName:request.metrics.operationName];
+    [hedgeRequest.metrics recordHedgeDecision:AWSNetworkingHedgeDecisionDuplicate
+                                   hedgeDelay:0];
+
+    return hedgeRequest;
 }
 
 - (void)dealloc {
@@ -168,6 +463,13 @@ NSString *const AWSNetworkingErrorDomain = @"com.amazonaws.AWSNetworkingErrorDom
     configuration.responseInterceptors = [self.responseInterceptors copy];
     configuration.retryHandler = self.retryHandler;
     configuration.maxRetryCount = self.maxRetryCount;
+    configuration.retryMode = self.retryMode;
+    configuration.hedgingPolicy = self.hedgingPolicy;
+    configuration.circuitBreaker = self.circuitBreaker;
+    configuration.requestCoalescer = self.requestCoalescer;
+    configuration.requestScheduler = self.requestScheduler;
+    configuration.wireLogger = self.wireLogger;
+    configuration.requestCompressionEnabled = self.isRequestCompressionEnabled;
     configuration.timeoutIntervalForRequest = self.timeoutIntervalForRequest;
     configuration.timeoutIntervalForResource = self.timeoutIntervalForResource;
 
@@ -178,13 +480,6 @@ NSString *const AWSNetworkingErrorDomain = @"com.amazonaws.AWSNetworkingErrorDom
 
 #pragma mark - AWSNetworkingRequest
 
-@interface AWSNetworkingRequest()
-
-@property (nonatomic, strong) NSURLSessionTask *task;
-@property (nonatomic, assign, getter = isCancelled) BOOL cancelled;
-
-@end
-
 @implementation AWSNetworkingRequest
 
 - (void)assignProperties:(AWSNetworkingConfiguration *)configuration {
@@ -227,6 +522,10 @@ NSString *const AWSNetworkingErrorDomain = @"com.amazonaws.AWSNetworkingErrorDom
     if (!self.retryHandler) {
         self.retryHandler = configuration.retryHandler;
     }
+
+    if (!self.requestScheduler) {
+        self.requestScheduler = configuration.requestScheduler;
+    }
 }
 
 - (void)setTask:(NSURLSessionTask *)task {
@@ -246,12 +545,25 @@ NSString *const AWSNetworkingErrorDomain = @"com.amazonaws.AWSNetworkingErrorDom
 }
 
 - (void)cancel {
+    AWSNetworkingRequestCoalescer *waitingCoalescer = nil;
+    NSString *coalescingKey = nil;
+    AWSNetworkingRequestScheduler *requestScheduler = nil;
     @synchronized(self) {
         if (!_cancelled) {
             _cancelled = YES;
             [self.task cancel];
+            [self.hedgeRequest cancel];
+            waitingCoalescer = self.waitingCoalescer;
+            coalescingKey = self.coalescingKey;
+            requestScheduler = self.requestScheduler;
         }
     }
+
+    // Called outside the lock because the coalescer may cancel the shared request in turn.
+    [waitingCoalescer cancelRequest:self
+                                key:coalescingKey];
+    // A request still waiting for admission has no task to cancel yet.
+    [requestScheduler cancelPendingRequest:self];
 }
 
 - (void)pause {
@@ -287,6 +599,38 @@ NSString *const AWSNetworkingErrorDomain = @"com.amazonaws.AWSNetworkingErrorDom
     self.internalRequest.downloadProgress = downloadProgress;
 }
 
+- (void)setResponseDataHandler:(AWSNetworkingResponseDataBlock)responseDataHandler {
+    self.internalRequest.responseDataHandler = responseDataHandler;
+}
+
+- (void)setResponseOutputStream:(NSOutputStream *)responseOutputStream {
+    self.internalRequest.responseOutputStream = responseOutputStream;
+}
+
+- (AWSNetworkingRequestPriority)priority {
+    return self.internalRequest.priority;
+}
+
+- (void)setPriority:(AWSNetworkingRequestPriority)priority {
+    self.internalRequest.priority = priority;
+}
+
+- (NSDate *)deadline {
+    return self.internalRequest.deadline;
+}
+
+- (void)setDeadline:(NSDate *)deadline {
+    self.internalRequest.deadline = deadline;
+}
+
+- (AWSCancellationToken *)cancellationToken {
+    return self.internalRequest.cancellationToken;
+}
+
+- (void)setCancellationToken:(AWSCancellationToken *)cancellationToken {
+    self.internalRequest.cancellationToken = cancellationToken;
+}
+
 - (BOOL)isCancelled {
     return [self.internalRequest isCancelled];
 }
@@ -301,17 +645,21 @@ NSString *const AWSNetworkingErrorDomain = @"com.amazonaws.AWSNetworkingErrorDom
     return [AWSTask taskWithResult:nil];
 }
 
-- (NSDictionary *)dictionaryValue {
-    NSDictionary *dictionaryValue = [super dictionaryValue];
-    NSMutableDictionary *mutableDictionaryValue = [dictionaryValue mutableCopy];
+/**
+ The call settings are not members of the request, so they are left out of its parameters, equality, hash and
+ description, and two calls that differ only in them can still be coalesced.
+ */
++ (NSSet *)propertyKeys {
+    NSSet *cachedKeys = objc_getAssociatedObject(self, AWSRequestCachedPropertyKeysKey);
+    if (cachedKeys != nil) {
+        return cachedKeys;
+    }
 
-    [dictionaryValue enumerateKeysAndObjectsUsingBlock:^(id key, id obj, BOOL *stop) {
-        if ([key isEqualToString:@"internalRequest"]) {
-            [mutableDictionaryValue removeObjectForKey:key];
-        }
-    }];
+    NSMutableSet *keys = [[super propertyKeys] mutableCopy];
+    [keys minusSet:[NSSet setWithObjects:@"internalRequest", @"priority", @"deadline", @"cancellationToken", nil]];
+    objc_setAssociatedObject(self, AWSRequestCachedPropertyKeysKey, keys, OBJC_ASSOCIATION_COPY);
 
-    return mutableDictionaryValue;
+    return keys;
 }
 
 @end
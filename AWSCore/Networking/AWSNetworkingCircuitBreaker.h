@@ -0,0 +1,100 @@
+//
+// Copyright 2010-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+@class AWSNetworkingCircuitBreaker;
+
+typedef NS_ENUM(NSInteger, AWSNetworkingCircuitBreakerState) {
+    /** Requests are sent and their outcomes are counted. */
+    AWSNetworkingCircuitBreakerStateClosed,
+    /** Requests fail immediately with `AWSNetworkingErrorCircuitOpen`. */
+    AWSNetworkingCircuitBreakerStateOpen,
+    /** A limited number of probe requests are sent to find out whether the endpoint recovered. */
+    AWSNetworkingCircuitBreakerStateHalfOpen
+};
+
+@protocol AWSNetworkingCircuitBreakerObserver <NSObject>
+
+/**
+ Called on a background thread every time the circuit of a host changes state.
+ */
+- (void)circuitBreaker:(AWSNetworkingCircuitBreaker *)circuitBreaker
+                  host:(NSString *)host
+    didChangeFromState:(AWSNetworkingCircuitBreakerState)fromState
+               toState:(AWSNetworkingCircuitBreakerState)toState;
+
+@end
+
+/**
+ Stops sending requests to an endpoint that keeps failing. Every endpoint host has its own circuit. The circuit
+ opens when, within `windowDuration`, at least `minimumRequestCount` attempts were made and `failureRateThreshold`
+ of them failed with a server error, a timeout or a connection error. While it is open, requests fail immediately
+ with `AWSNetworkingErrorCircuitOpen` instead of running through the retry back-off. After `openDuration` the circuit
+ becomes half-open and lets `halfOpenProbeCount` probe requests through; it closes when all of them succeed and
+ opens again when one fails.
+
+ Set an instance on `AWSNetworkingConfiguration.circuitBreaker` to opt in. The instance may be shared between clients.
+ */
+@interface AWSNetworkingCircuitBreaker : NSObject
+
+/**
+ The fraction of failed attempts that opens the circuit. The default value is `0.5`.
+ */
+@property (nonatomic, assign) double failureRateThreshold;
+
+/**
+ The number of attempts within the window below which the circuit does not open. The default value is `20`.
+ */
+@property (nonatomic, assign) NSUInteger minimumRequestCount;
+
+/**
+ The period over which the attempts are counted. The default value is 10 seconds.
+ */
+@property (nonatomic, assign) NSTimeInterval windowDuration;
+
+/**
+ How long the circuit stays open before probe requests are let through. The default value is 5 seconds.
+ */
+@property (nonatomic, assign) NSTimeInterval openDuration;
+
+/**
+ The number of concurrent probe requests while half-open, and of successes needed to close. The default value is `1`.
+ */
+@property (nonatomic, assign) NSUInteger halfOpenProbeCount;
+
+- (AWSNetworkingCircuitBreakerState)stateForHost:(NSString *)host;
+
+/**
+ Returns `NO` when a request to the host must fail fast. Every `YES` must be balanced by a call to
+ `recordAttemptForHost:response:error:` once the attempt completes.
+ */
+- (BOOL)allowAttemptForHost:(NSString *)host;
+
+- (void)recordAttemptForHost:(NSString *)host
+                    response:(nullable NSHTTPURLResponse *)response
+                       error:(nullable NSError *)error;
+
+/**
+ Observers are held weakly.
+ */
+- (void)addObserver:(id<AWSNetworkingCircuitBreakerObserver>)observer;
+- (void)removeObserver:(id<AWSNetworkingCircuitBreakerObserver>)observer;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,290 @@
+//
+// Copyright 2010-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import "AWSNetworkingCircuitBreaker.h"
+#import "AWSNetworkingMetrics.h"
+#import "AWSCocoaLumberjack.h"
+
+static const double AWSNetworkingCircuitBreakerDefaultFailureRateThreshold = 0.5;
+static const NSUInteger AWSNetworkingCircuitBreakerDefaultMinimumRequestCount = 20;
+static const NSTimeInterval AWSNetworkingCircuitBreakerDefaultWindowDuration = 10.0;
+static const NSTimeInterval AWSNetworkingCircuitBreakerDefaultOpenDuration = 5.0;
+static const NSUInteger AWSNetworkingCircuitBreakerDefaultHalfOpenProbeCount = 1;
+static const NSUInteger AWSNetworkingCircuitBreakerBucketCount = 10;
+
+typedef struct {
+    int64_t epoch;
+    NSUInteger successCount;
+    NSUInteger failureCount;
+} AWSCircuitBreakerBucket;
+
+#pragma mark - AWSCircuitBreakerEndpointState
+
+/**
+ The circuit of one host. The attempts are counted in a ring of buckets that together span the window.
+ */
+@interface AWSCircuitBreakerEndpointState : NSObject
+
+@property (nonatomic, assign) AWSNetworkingCircuitBreakerState state;
+@property (nonatomic, assign) NSTimeInterval openedTime;
+@property (nonatomic, assign) NSUInteger probesInFlight;
+@property (nonatomic, assign) NSUInteger probeSuccessCount;
+
+- (void)recordSuccess:(BOOL)success
+                 time:(NSTimeInterval)time
+       bucketDuration:(NSTimeInterval)bucketDuration;
+- (void)countAttempts:(NSUInteger *)attemptCount
+             failures:(NSUInteger *)failureCount
+                 time:(NSTimeInterval)time
+       bucketDuration:(NSTimeInterval)bucketDuration;
+- (void)resetBuckets;
+
+@end
+
+@implementation AWSCircuitBreakerEndpointState {
+    AWSCircuitBreakerBucket _buckets[AWSNetworkingCircuitBreakerBucketCount];
+}
+
+- (void)recordSuccess:(BOOL)success
+                 time:(NSTimeInterval)time
+       bucketDuration:(NSTimeInterval)bucketDuration {
+    int64_t epoch = (int64_t)(time / bucketDuration);
+    AWSCircuitBreakerBucket *bucket = &_buckets[epoch % AWSNetworkingCircuitBreakerBucketCount];
+    if (bucket->epoch != epoch) {
+        bucket->epoch = epoch;
+        bucket->successCount = 0;
+        bucket->failureCount = 0;
+    }
+    if (success) {
+        bucket->successCount++;
+    } else {
+        bucket->failureCount++;
+    }
+}
+
+- (void)countAttempts:(NSUInteger *)attemptCount
+             failures:(NSUInteger *)failureCount
+                 time:(NSTimeInterval)time
+       bucketDuration:(NSTimeInterval)bucketDuration {
+    int64_t epoch = (int64_t)(time / bucketDuration);
+    *attemptCount = 0;
+    *failureCount = 0;
+    for (NSUInteger i = 0; i < AWSNetworkingCircuitBreakerBucketCount; i++) {
+        if (epoch - _buckets[i].epoch < (int64_t)AWSNetworkingCircuitBreakerBucketCount) {
+            *attemptCount += _buckets[i].successCount + _buckets[i].failureCount;
+            *failureCount += _buckets[i].failureCount;
+        }
+    }
+}
+
+- (void)resetBuckets {
+    memset(_buckets, 0, sizeof(_buckets));
+}
+
+@end
+
+#pragma mark - AWSNetworkingCircuitBreaker
+
+@interface AWSNetworkingCircuitBreaker()
+
+@property (nonatomic, strong) NSMutableDictionary<NSString *, AWSCircuitBreakerEndpointState *> *endpointStates;
+@property (nonatomic, strong) NSHashTable<id<AWSNetworkingCircuitBreakerObserver>> *observers;
+
+@end
+
+@implementation AWSNetworkingCircuitBreaker
+
+- (instancetype)init {
+    if (self = [super init]) {
+        _failureRateThreshold = AWSNetworkingCircuitBreakerDefaultFailureRateThreshold;
+        _minimumRequestCount = AWSNetworkingCircuitBreakerDefaultMinimumRequestCount;
+        _windowDuration = AWSNetworkingCircuitBreakerDefaultWindowDuration;
+        _openDuration = AWSNetworkingCircuitBreakerDefaultOpenDuration;
+        _halfOpenProbeCount = AWSNetworkingCircuitBreakerDefaultHalfOpenProbeCount;
+        _endpointStates = [NSMutableDictionary new];
+        _observers = [NSHashTable weakObjectsHashTable];
+    }
+
+    return self;
+}
+
+- (AWSCircuitBreakerEndpointState *)endpointStateForHost:(NSString *)host {
+    AWSCircuitBreakerEndpointState *endpointState = self.endpointStates[host];
+    if (!endpointState) {
+        endpointState = [AWSCircuitBreakerEndpointState new];
+        self.endpointStates[host] = endpointState;
+    }
+
+    return endpointState;
+}
+
+- (NSTimeInterval)bucketDuration {
+    return MAX(self.windowDuration, 0.001) / AWSNetworkingCircuitBreakerBucketCount;
+}
+
+- (AWSNetworkingCircuitBreakerState)stateForHost:(NSString *)host {
+    @synchronized(self) {
+        return self.endpointStates[host].state;
+    }
+}
+
+- (BOOL)allowAttemptForHost:(NSString *)host {
+    if (!host) {
+        return YES;
+    }
+
+    BOOL allowed = YES;
+    BOOL didBecomeHalfOpen = NO;
+    @synchronized(self) {
+        AWSCircuitBreakerEndpointState *endpointState = [self endpointStateForHost:host];
+        if (endpointState.state == AWSNetworkingCircuitBreakerStateOpen
+            && [AWSNetworkingRequestMetrics currentTime] - endpointState.openedTime >= self.openDuration) {
+            endpointState.state = AWSNetworkingCircuitBreakerStateHalfOpen;
+            endpointState.probesInFlight = 0;
+            endpointState.probeSuccessCount = 0;
+            didBecomeHalfOpen = YES;
+        }
+
+        switch (endpointState.state) {
+            case AWSNetworkingCircuitBreakerStateOpen:
+                allowed = NO;
+                break;
+
+            case AWSNetworkingCircuitBreakerStateHalfOpen:
+                if (endpointState.probesInFlight < MAX(self.halfOpenProbeCount, 1)) {
+                    endpointState.probesInFlight++;
+                } else {
+                    allowed = NO;
+                }
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    if (didBecomeHalfOpen) {
+        [self notifyObserversForHost:host
+                           fromState:AWSNetworkingCircuitBreakerStateOpen
+                             toState:AWSNetworkingCircuitBreakerStateHalfOpen];
+    }
+
+    return allowed;
+}
+
+- (void)recordAttemptForHost:(NSString *)host
+                    response:(NSHTTPURLResponse *)response
+                       error:(NSError *)error {
+    if (!host) {
+        return;
+    }
+
+    // A cancelled attempt says nothing about the health of the endpoint.
+    BOOL cancelled = [error.domain isEqualToString:NSURLErrorDomain] && error.code == NSURLErrorCancelled;
+    BOOL success = response ? response.statusCode < 500 : !error;
+
+    AWSNetworkingCircuitBreakerState fromState;
+    AWSNetworkingCircuitBreakerState toState;
+    @synchronized(self) {
+        AWSCircuitBreakerEndpointState *endpointState = [self endpointStateForHost:host];
+        fromState = endpointState.state;
+        NSTimeInterval now = [AWSNetworkingRequestMetrics currentTime];
+
+        switch (endpointState.state) {
+            case AWSNetworkingCircuitBreakerStateClosed: {
+                if (cancelled) {
+                    break;
+                }
+                [endpointState recordSuccess:success
+                                        time:now
+                              bucketDuration:[self bucketDuration]];
+                if (!success) {
+                    NSUInteger attemptCount = 0;
+                    NSUInteger failureCount = 0;
+                    [endpointState countAttempts:&attemptCount
+                                        failures:&failureCount
+                                            time:now
+                                  bucketDuration:[self bucketDuration]];
+                    if (attemptCount >= self.minimumRequestCount
+                        && (double)failureCount / attemptCount >= self.failureRateThreshold) {
+                        endpointState.state = AWSNetworkingCircuitBreakerStateOpen;
+                        endpointState.openedTime = now;
+                    }
+                }
+            }
+                break;
+
+            case AWSNetworkingCircuitBreakerStateHalfOpen: {
+                if (endpointState.probesInFlight > 0) {
+                    endpointState.probesInFlight--;
+                }
+                if (cancelled) {
+                    break;
+                }
+                if (!success) {
+                    endpointState.state = AWSNetworkingCircuitBreakerStateOpen;
+                    endpointState.openedTime = now;
+                } else if (++endpointState.probeSuccessCount >= MAX(self.halfOpenProbeCount, 1)) {
+                    endpointState.state = AWSNetworkingCircuitBreakerStateClosed;
+                    [endpointState resetBuckets];
+                }
+            }
+                break;
+
+            default:
+                // Attempts admitted before the circuit opened do not change it.
+                break;
+        }
+        toState = endpointState.state;
+    }
+
+    if (fromState != toState) {
+        if (toState == AWSNetworkingCircuitBreakerStateOpen) {
+            AWSDDLogWarn(@"The circuit for %@ is open. Requests to it will fail fast for %.1f seconds.", host, self.openDuration);
+        }
+        [self notifyObserversForHost:host
+                           fromState:fromState
+                             toState:toState];
+    }
+}
+
+- (void)addObserver:(id<AWSNetworkingCircuitBreakerObserver>)observer {
+    @synchronized(self.observers) {
+        [self.observers addObject:observer];
+    }
+}
+
+- (void)removeObserver:(id<AWSNetworkingCircuitBreakerObserver>)observer {
+    @synchronized(self.observers) {
+        [self.observers removeObject:observer];
+    }
+}
+
+- (void)notifyObserversForHost:(NSString *)host
+                     fromState:(AWSNetworkingCircuitBreakerState)fromState
+                       toState:(AWSNetworkingCircuitBreakerState)toState {
+    NSArray<id<AWSNetworkingCircuitBreakerObserver>> *observers = nil;
+    @synchronized(self.observers) {
+        observers = [self.observers allObjects];
+    }
+    for (id<AWSNetworkingCircuitBreakerObserver> observer in observers) {
+        [observer circuitBreaker:self
+                            host:host
+              didChangeFromState:fromState
+                         toState:toState];
+    }
+}
+
+@end
@@ -0,0 +1,99 @@
+//
+// Copyright 2010-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+@class AWSNetworkingRequest;
+
+/**
+ A point-in-time snapshot of the counters of an `AWSNetworkingHedgingPolicy`.
+ */
+@interface AWSNetworkingHedgingStatistics : NSObject
+
+/**
+ The number of requests of the hedged operations the policy considered.
+ */
+@property (nonatomic, assign, readonly) NSUInteger eligibleRequestCount;
+
+/**
+ The number of duplicates sent.
+ */
+@property (nonatomic, assign, readonly) NSUInteger hedgedRequestCount;
+
+/**
+ The number of duplicates whose response was used.
+ */
+@property (nonatomic, assign, readonly) NSUInteger hedgeWinCount;
+
+/**
+ The number of hedges skipped because `maximumHedgeRatio` was reached.
+ */
+@property (nonatomic, assign, readonly) NSUInteger budgetExhaustedCount;
+
+@end
+
+/**
+ Reduces the tail latency of idempotent reads. When a request has not started receiving its response after
+ `latencyPercentile` of the recent latencies of the same operation, a duplicate is sent; the first successful
+ response wins and the other request is cancelled.
+
+ Set an instance on `AWSNetworkingConfiguration.hedgingPolicy` to opt in. The policy may be shared between clients.
+ Only requests whose operation is in `hedgedOperationNames` are hedged. Requests that upload a file or write their
+ response to a file or a stream are never hedged.
+ */
+@interface AWSNetworkingHedgingPolicy : NSObject
+
+/**
+ The percentile of the observed time to first byte after which a duplicate is sent. The default value is `0.95`.
+ */
+@property (nonatomic, assign) double latencyPercentile;
+
+/**
+ The maximum number of duplicates as a fraction of the eligible requests. The default value is `0.05`.
+ */
+@property (nonatomic, assign) double maximumHedgeRatio;
+
+/**
+ Bounds of the hedge delay. The default values are 10 ms and 2 seconds.
+ */
+@property (nonatomic, assign) NSTimeInterval minimumHedgeDelay;
+@property (nonatomic, assign) NSTimeInterval maximumHedgeDelay;
+
+/**
+ The number of latency samples an operation needs before its requests are hedged. The default value is `50`.
+ */
+@property (nonatomic, assign) NSUInteger minimumSampleCount;
+
+/**
+ The operations whose requests are hedged. List only operations that are safe to send twice and whose responses are
+ small: a hedge downloads the response again, so hedging a download such as S3 `GetObject` doubles its transfer. The
+ default value contains the DynamoDB `GetItem` and `Query` operations.
+ */
+@property (nonatomic, copy) NSSet<NSString *> *hedgedOperationNames;
+
+- (BOOL)isRequestHedgeable:(AWSNetworkingRequest *)request;
+
+/**
+ The delay after which a duplicate of the request is sent, or `0` when there are not enough samples yet.
+ */
+- (NSTimeInterval)hedgeDelayForRequest:(AWSNetworkingRequest *)request;
+
+- (AWSNetworkingHedgingStatistics *)statistics;
+
+@end
+
+NS_ASSUME_NONNULL_END
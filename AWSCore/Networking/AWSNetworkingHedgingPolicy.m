@@ -0,0 +1,252 @@
+//
+// Copyright 2010-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import "AWSNetworkingHedgingPolicy.h"
+#import "AWSNetworking.h"
+#import "AWSNetworkingMetrics.h"
+
+static const double AWSNetworkingHedgingPolicyDefaultLatencyPercentile = 0.95;
+static const double AWSNetworkingHedgingPolicyDefaultMaximumHedgeRatio = 0.05;
+static const NSTimeInterval AWSNetworkingHedgingPolicyDefaultMinimumHedgeDelay = 0.01;
+static const NSTimeInterval AWSNetworkingHedgingPolicyDefaultMaximumHedgeDelay = 2.0;
+static const NSUInteger AWSNetworkingHedgingPolicyDefaultMinimumSampleCount = 50;
+// Lets a short burst of slow requests be hedged even when the long-run ratio is low.
+static const double AWSNetworkingHedgingPolicyMaximumHedgeTokens = 10.0;
+
+// Logarithmic buckets from 1 ms growing by 20%; the last one ends past 30 minutes.
+static const NSUInteger AWSLatencyHistogramBucketCount = 80;
+static const NSTimeInterval AWSLatencyHistogramFirstBucketUpperBound = 0.001;
+static const double AWSLatencyHistogramBucketGrowthFactor = 1.2;
+// Counts are halved when this many samples accumulate, so the histogram follows recent latencies.
+static const NSUInteger AWSLatencyHistogramDecayThreshold = 2000;
+
+#pragma mark - AWSLatencyHistogram
+
+@interface AWSLatencyHistogram : NSObject
+
+@property (nonatomic, assign, readonly) NSUInteger sampleCount;
+
+- (void)addSample:(NSTimeInterval)latency;
+- (NSTimeInterval)valueAtPercentile:(double)percentile;
+
+@end
+
+@implementation AWSLatencyHistogram {
+    NSUInteger _counts[AWSLatencyHistogramBucketCount];
+}
+
++ (const NSTimeInterval *)bucketUpperBounds {
+    static NSTimeInterval _bucketUpperBounds[AWSLatencyHistogramBucketCount];
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        NSTimeInterval upperBound = AWSLatencyHistogramFirstBucketUpperBound;
+        for (NSUInteger i = 0; i < AWSLatencyHistogramBucketCount; i++) {
+            _bucketUpperBounds[i] = upperBound;
+            upperBound *= AWSLatencyHistogramBucketGrowthFactor;
+        }
+    });
+
+    return _bucketUpperBounds;
+}
+
+- (void)addSample:(NSTimeInterval)latency {
+    const NSTimeInterval *bucketUpperBounds = [AWSLatencyHistogram bucketUpperBounds];
+    NSUInteger bucket = 0;
+    while (bucket < AWSLatencyHistogramBucketCount - 1 && latency > bucketUpperBounds[bucket]) {
+        bucket++;
+    }
+    _counts[bucket]++;
+    _sampleCount++;
+
+    if (_sampleCount >= AWSLatencyHistogramDecayThreshold) {
+        _sampleCount = 0;
+        for (NSUInteger i = 0; i < AWSLatencyHistogramBucketCount; i++) {
+            _counts[i] /= 2;
+            _sampleCount += _counts[i];
+        }
+    }
+}
+
+- (NSTimeInterval)valueAtPercentile:(double)percentile {
+    if (_sampleCount == 0) {
+        return 0;
+    }
+
+    const NSTimeInterval *bucketUpperBounds = [AWSLatencyHistogram bucketUpperBounds];
+    double rank = percentile * _sampleCount;
+    NSUInteger cumulativeCount = 0;
+    for (NSUInteger i = 0; i < AWSLatencyHistogramBucketCount; i++) {
+        cumulativeCount += _counts[i];
+        if (cumulativeCount >= rank) {
+            return bucketUpperBounds[i];
+        }
+    }
+
+    return bucketUpperBounds[AWSLatencyHistogramBucketCount - 1];
+}
+
+@end
+
+#pragma mark - AWSNetworkingHedgingStatistics
+
+@interface AWSNetworkingHedgingStatistics()
+
+@property (nonatomic, assign) NSUInteger eligibleRequestCount;
+@property (nonatomic, assign) NSUInteger hedgedRequestCount;
+@property (nonatomic, assign) NSUInteger hedgeWinCount;
+@property (nonatomic, assign) NSUInteger budgetExhaustedCount;
+
+@end
+
+@implementation AWSNetworkingHedgingStatistics
+
+- (NSString *)description {
+    return [NSString stringWithFormat:@"<%@: eligible=%lu hedged=%lu won=%lu budgetExhausted=%lu>",
+            NSStringFromClass([self class]),
+            (unsigned long)self.eligibleRequestCount,
+            (unsigned long)self.hedgedRequestCount,
+            (unsigned long)self.hedgeWinCount,
+            (unsigned long)self.budgetExhaustedCount];
+}
+
+@end
+
+#pragma mark - AWSNetworkingHedgingPolicy
+
+@interface AWSNetworkingHedgingPolicy()
+
+@property (nonatomic, strong) NSMutableDictionary<NSString *, AWSLatencyHistogram *> *histograms;
+@property (nonatomic, assign) double hedgeTokens;
+@property (nonatomic, assign) NSUInteger eligibleRequestCount;
+@property (nonatomic, assign) NSUInteger hedgedRequestCount;
+@property (nonatomic, assign) NSUInteger hedgeWinCount;
+@property (nonatomic, assign) NSUInteger budgetExhaustedCount;
+
+@end
+
+@implementation AWSNetworkingHedgingPolicy
+
+- (instancetype)init {
+    if (self = [super init]) {
+        _latencyPercentile = AWSNetworkingHedgingPolicyDefaultLatencyPercentile;
+        _maximumHedgeRatio = AWSNetworkingHedgingPolicyDefaultMaximumHedgeRatio;
+        _minimumHedgeDelay = AWSNetworkingHedgingPolicyDefaultMinimumHedgeDelay;
+        _maximumHedgeDelay = AWSNetworkingHedgingPolicyDefaultMaximumHedgeDelay;
+        _minimumSampleCount = AWSNetworkingHedgingPolicyDefaultMinimumSampleCount;
+        // BatchGetItem is left out: its responses reach 16 MB.
+        _hedgedOperationNames = [NSSet setWithObjects:@"GetItem", @"Query", nil];
+        _histograms = [NSMutableDictionary new];
+    }
+
+    return self;
+}
+
+- (NSString *)latencyKeyForRequest:(AWSNetworkingRequest *)request {
+    AWSNetworkingRequestMetrics *metrics = request.metrics;
+    if (metrics.operationName) {
+        return [NSString stringWithFormat:@"%@.%@", metrics.serviceName, metrics.operationName];
+    }
+
+    return [NSString stringWithFormat:@"%@ %@", [NSString aws_stringWithHTTPMethod:request.HTTPMethod], request.URL.host];
+}
+
+- (BOOL)isRequestHedgeable:(AWSNetworkingRequest *)request {
+    // The body of these requests is consumed as it arrives, so it cannot be received twice.
+    if (request.uploadingFileURL
+        || request.downloadingFileURL
+        || request.responseDataHandler
+        || request.responseOutputStream) {
+        return NO;
+    }
+
+    NSString *operationName = request.metrics.operationName;
+    return operationName && [self.hedgedOperationNames containsObject:operationName];
+}
+
+- (NSTimeInterval)hedgeDelayForRequest:(AWSNetworkingRequest *)request {
+    NSString *key = [self latencyKeyForRequest:request];
+    NSTimeInterval delay = 0;
+    @synchronized(self) {
+        AWSLatencyHistogram *histogram = self.histograms[key];
+        if (histogram.sampleCount < MAX(self.minimumSampleCount, 1)) {
+            return 0;
+        }
+        delay = [histogram valueAtPercentile:self.latencyPercentile];
+    }
+
+    return MIN(MAX(delay, self.minimumHedgeDelay), self.maximumHedgeDelay);
+}
+
+- (AWSNetworkingHedgingStatistics *)statistics {
+    AWSNetworkingHedgingStatistics *statistics = [AWSNetworkingHedgingStatistics new];
+    @synchronized(self) {
+        statistics.eligibleRequestCount = self.eligibleRequestCount;
+        statistics.hedgedRequestCount = self.hedgedRequestCount;
+        statistics.hedgeWinCount = self.hedgeWinCount;
+        statistics.budgetExhaustedCount = self.budgetExhaustedCount;
+    }
+
+    return statistics;
+}
+
+- (void)recordEligibleRequest {
+    @synchronized(self) {
+        self.eligibleRequestCount++;
+        self.hedgeTokens = MIN(self.hedgeTokens + self.maximumHedgeRatio, AWSNetworkingHedgingPolicyMaximumHedgeTokens);
+    }
+}
+
+- (BOOL)acquireHedge {
+    @synchronized(self) {
+        if (self.hedgeTokens < 1.0) {
+            self.budgetExhaustedCount++;
+            return NO;
+        }
+        self.hedgeTokens -= 1.0;
+        self.hedgedRequestCount++;
+        return YES;
+    }
+}
+
+- (void)recordHedgeWon {
+    @synchronized(self) {
+        self.hedgeWinCount++;
+    }
+}
+
+- (void)recordLatencyForRequest:(AWSNetworkingRequest *)request {
+    AWSNetworkingRequestMetrics *metrics = request.metrics;
+    // Only a single attempt that got a response measures how long the operation takes to start answering.
+    if (metrics.retryCount > 0 || metrics.HTTPStatusCode == 0) {
+        return;
+    }
+
+    NSTimeInterval timeToFirstByte = 0;
+    for (NSInteger phase = AWSNetworkingRequestPhaseRequestSerialization; phase <= AWSNetworkingRequestPhaseTimeToFirstByte; phase++) {
+        timeToFirstByte += [metrics durationForPhase:phase];
+    }
+
+    NSString *key = [self latencyKeyForRequest:request];
+    @synchronized(self) {
+        AWSLatencyHistogram *histogram = self.histograms[key];
+        if (!histogram) {
+            histogram = [AWSLatencyHistogram new];
+            self.histograms[key] = histogram;
+        }
+        [histogram addSample:timeToFirstByte];
+    }
+}
+
+@end
@@ -0,0 +1,202 @@
+//
+// Copyright 2010-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+@class AWSNetworkingRequestMetrics;
+
+/**
+ The phases a request goes through. Durations of phases that run again on a retry are accumulated.
+ */
+typedef NS_ENUM(NSInteger, AWSNetworkingRequestPhase) {
+    /** Converting the request model into a dictionary. */
+    AWSNetworkingRequestPhaseModelSerialization,
+    /** Building the URL request from the dictionary. */
+    AWSNetworkingRequestPhaseRequestSerialization,
+    /** Retrieving the credentials used to sign the request. */
+    AWSNetworkingRequestPhaseCredentialRetrieval,
+    /** Running the request interceptors, excluding the credential retrieval. Dominated by SigV4 signing. */
+    AWSNetworkingRequestPhaseSigning,
+    /** Waiting in the client-side rate limiter and for a connection once the task is resumed. */
+    AWSNetworkingRequestPhaseQueueWait,
+    /** Resolving the host name. Zero when a connection is reused. */
+    AWSNetworkingRequestPhaseDomainLookup,
+    /** Establishing the TCP connection. Zero when a connection is reused. */
+    AWSNetworkingRequestPhaseConnect,
+    /** The TLS handshake. Zero when a connection is reused. */
+    AWSNetworkingRequestPhaseSecureConnection,
+    /** From the first byte of the request being sent to the first byte of the response. */
+    AWSNetworkingRequestPhaseTimeToFirstByte,
+    /** Receiving the response body. */
+    AWSNetworkingRequestPhaseBodyTransfer,
+    /** Running the response serializer, excluding the model mapping. */
+    AWSNetworkingRequestPhaseResponseParsing,
+    /** Converting the parsed response into the output model. */
+    AWSNetworkingRequestPhaseModelMapping,
+    AWSNetworkingRequestPhaseCount
+};
+
+/**
+ What the hedging policy decided for a request. See `AWSNetworkingHedgingPolicy`.
+ */
+typedef NS_ENUM(NSInteger, AWSNetworkingHedgeDecision) {
+    /** Hedging is off or the operation of the request is not hedged. */
+    AWSNetworkingHedgeDecisionNotEligible,
+    /** Not enough latency samples for the operation to pick a hedge delay. */
+    AWSNetworkingHedgeDecisionInsufficientSamples,
+    /** The response started before the hedge delay elapsed. */
+    AWSNetworkingHedgeDecisionNotNeeded,
+    /** The hedge delay elapsed but the hedge budget was exhausted. */
+    AWSNetworkingHedgeDecisionBudgetExhausted,
+    /** A duplicate request was sent. */
+    AWSNetworkingHedgeDecisionHedged,
+    /** The request is the duplicate sent by a hedge. */
+    AWSNetworkingHedgeDecisionDuplicate
+};
+
+/**
+ The `NSURLProtocol` property key a request interceptor sets on the `NSMutableURLRequest` to report
+ how long it spent retrieving credentials, as an `NSNumber` of seconds. The session manager removes
+ the property before the request is sent.
+ */
+FOUNDATION_EXPORT NSString *const AWSNetworkingRequestMetricsCredentialRetrievalDurationKey;
+
+/**
+ Receives the metrics of every request sent through `AWSNetworking` once it completes.
+ */
+@protocol AWSNetworkingMetricsObserver <NSObject>
+
+/**
+ Called once per request, after the last attempt and before the request's task is completed. It is called on a background
+ thread, so the implementation must be thread-safe and should return quickly.
+ */
+- (void)networkingRequestDidFinishWithMetrics:(AWSNetworkingRequestMetrics *)metrics;
+
+@end
+
+/**
+ Timings of a single request, measured with a monotonic clock.
+ */
+@interface AWSNetworkingRequestMetrics : NSObject
+
+/**
+ The signing name of the service, e.g. `dynamodb`. `nil` for requests not sent by a service client.
+ */
+@property (nonatomic, strong, readonly, nullable) NSString *serviceName;
+
+/**
+ The name of the operation, e.g. `GetItem`. `nil` for requests not sent by a service client.
+ */
+@property (nonatomic, strong, readonly, nullable) NSString *operationName;
+
+/**
+ The time from the service client being invoked to the request completing.
+ */
+@property (nonatomic, assign, readonly) NSTimeInterval totalDuration;
+
+/**
+ The number of attempts that were retried.
+ */
+@property (nonatomic, assign, readonly) uint32_t retryCount;
+
+/**
+ The HTTP status code of the last attempt, or `0` when no response was received.
+ */
+@property (nonatomic, assign, readonly) NSInteger HTTPStatusCode;
+
+/**
+ The error the request completed with.
+ */
+@property (nonatomic, strong, readonly, nullable) NSError *error;
+
+/**
+ The metrics `NSURLSession` collected for the last attempt.
+ */
+@property (nonatomic, strong, readonly, nullable) NSURLSessionTaskMetrics *taskMetrics;
+
+/**
+ What the hedging policy decided for the request.
+ */
+@property (nonatomic, assign, readonly) AWSNetworkingHedgeDecision hedgeDecision;
+
+/**
+ The delay after which a duplicate is, or would have been, sent. `0` when no delay was computed.
+ */
+@property (nonatomic, assign, readonly) NSTimeInterval hedgeDelay;
+
+/**
+ Whether the duplicate's response was used instead of this request's.
+ */
+@property (nonatomic, assign, readonly) BOOL hedgeWon;
+
+- (instancetype)initWithServiceName:(nullable NSString *)serviceName
+                      operationName:(nullable NSString *)operationName;
+
+/**
+ The accumulated duration of the phase.
+ */
+- (NSTimeInterval)durationForPhase:(AWSNetworkingRequestPhase)phase;
+
+/**
+ The durations of all phases keyed by `nameForPhase:`, convenient for exporting.
+ */
+- (NSDictionary<NSString *, NSNumber *> *)phaseDurations;
+
+- (void)beginPhase:(AWSNetworkingRequestPhase)phase;
+- (void)endPhase:(AWSNetworkingRequestPhase)phase;
+- (void)addDuration:(NSTimeInterval)duration
+           forPhase:(AWSNetworkingRequestPhase)phase;
+
+/**
+ Records the network phases of one attempt.
+ */
+- (void)recordTaskMetrics:(NSURLSessionTaskMetrics *)taskMetrics;
+
+- (void)recordHedgeDecision:(AWSNetworkingHedgeDecision)hedgeDecision
+                 hedgeDelay:(NSTimeInterval)hedgeDelay;
+- (void)recordHedgeWon;
+
+/**
+ Marks the request as completed and notifies the observers.
+ */
+- (void)finishWithStatusCode:(NSInteger)HTTPStatusCode
+                  retryCount:(uint32_t)retryCount
+                       error:(nullable NSError *)error;
+
+/**
+ The metrics of the request whose response is being serialized on the calling thread. Response serializers use it to
+ report `AWSNetworkingRequestPhaseModelMapping`.
+ */
++ (nullable instancetype)currentMetrics;
++ (void)setCurrentMetrics:(nullable AWSNetworkingRequestMetrics *)metrics;
+
++ (NSString *)nameForPhase:(AWSNetworkingRequestPhase)phase;
+
+/**
+ Seconds on a monotonic clock that is not affected by changes to the system time.
+ */
++ (NSTimeInterval)currentTime;
+
+/**
+ Observers are held weakly.
+ */
++ (void)addObserver:(id<AWSNetworkingMetricsObserver>)observer;
++ (void)removeObserver:(id<AWSNetworkingMetricsObserver>)observer;
+
+@end
+
+NS_ASSUME_NONNULL_END
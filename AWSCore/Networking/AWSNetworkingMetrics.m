@@ -0,0 +1,267 @@
+//
+// Copyright 2010-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import "AWSNetworkingMetrics.h"
+#import <time.h>
+
+NSString *const AWSNetworkingRequestMetricsCredentialRetrievalDurationKey = @"com.amazonaws.AWSNetworkingRequestMetrics.credentialRetrievalDuration";
+
+static NSString *const AWSNetworkingRequestMetricsCurrentMetricsKey = @"com.amazonaws.AWSNetworkingRequestMetrics.currentMetrics";
+
+@interface AWSNetworkingRequestMetrics()
+
+@property (nonatomic, strong) NSString *serviceName;
+@property (nonatomic, strong) NSString *operationName;
+@property (nonatomic, assign) NSTimeInterval totalDuration;
+@property (nonatomic, assign) uint32_t retryCount;
+@property (nonatomic, assign) NSInteger HTTPStatusCode;
+@property (nonatomic, strong) NSError *error;
+@property (nonatomic, strong) NSURLSessionTaskMetrics *taskMetrics;
+@property (atomic, assign) AWSNetworkingHedgeDecision hedgeDecision;
+@property (atomic, assign) NSTimeInterval hedgeDelay;
+@property (atomic, assign) BOOL hedgeWon;
+
+@end
+
+static NSTimeInterval AWSTimeIntervalBetweenDates(NSDate *startDate, NSDate *endDate) {
+    if (!startDate || !endDate) {
+        return 0;
+    }
+    return [endDate timeIntervalSinceDate:startDate];
+}
+
+@implementation AWSNetworkingRequestMetrics {
+    NSTimeInterval _startTime;
+    NSTimeInterval _durations[AWSNetworkingRequestPhaseCount];
+    NSTimeInterval _phaseStartTimes[AWSNetworkingRequestPhaseCount];
+}
+
++ (NSHashTable<id<AWSNetworkingMetricsObserver>> *)observers {
+    static NSHashTable *_observers = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        _observers = [NSHashTable weakObjectsHashTable];
+    });
+
+    return _observers;
+}
+
++ (void)addObserver:(id<AWSNetworkingMetricsObserver>)observer {
+    NSHashTable *observers = [self observers];
+    @synchronized(observers) {
+        [observers addObject:observer];
+    }
+}
+
++ (void)removeObserver:(id<AWSNetworkingMetricsObserver>)observer {
+    NSHashTable *observers = [self observers];
+    @synchronized(observers) {
+        [observers removeObject:observer];
+    }
+}
+
++ (NSTimeInterval)currentTime {
+    return (NSTimeInterval)clock_gettime_nsec_np(CLOCK_UPTIME_RAW) / NSEC_PER_SEC;
+}
+
++ (instancetype)currentMetrics {
+    return [[NSThread currentThread].threadDictionary objectForKey:AWSNetworkingRequestMetricsCurrentMetricsKey];
+}
+
++ (void)setCurrentMetrics:(AWSNetworkingRequestMetrics *)metrics {
+    NSMutableDictionary *threadDictionary = [NSThread currentThread].threadDictionary;
+    if (metrics) {
+        [threadDictionary setObject:metrics forKey:AWSNetworkingRequestMetricsCurrentMetricsKey];
+    } else {
+        [threadDictionary removeObjectForKey:AWSNetworkingRequestMetricsCurrentMetricsKey];
+    }
+}
+
++ (NSString *)nameForPhase:(AWSNetworkingRequestPhase)phase {
+    switch (phase) {
+        case AWSNetworkingRequestPhaseModelSerialization:
+            return @"ModelSerialization";
+        case AWSNetworkingRequestPhaseRequestSerialization:
+            return @"RequestSerialization";
+        case AWSNetworkingRequestPhaseCredentialRetrieval:
+            return @"CredentialRetrieval";
+        case AWSNetworkingRequestPhaseSigning:
+            return @"Signing";
+        case AWSNetworkingRequestPhaseQueueWait:
+            return @"QueueWait";
+        case AWSNetworkingRequestPhaseDomainLookup:
+            return @"DomainLookup";
+        case AWSNetworkingRequestPhaseConnect:
+            return @"Connect";
+        case AWSNetworkingRequestPhaseSecureConnection:
+            return @"SecureConnection";
+        case AWSNetworkingRequestPhaseTimeToFirstByte:
+            return @"TimeToFirstByte";
+        case AWSNetworkingRequestPhaseBodyTransfer:
+            return @"BodyTransfer";
+        case AWSNetworkingRequestPhaseResponseParsing:
+            return @"ResponseParsing";
+        case AWSNetworkingRequestPhaseModelMapping:
+            return @"ModelMapping";
+
+        default:
+            return @"Unknown";
+    }
+}
+
+- (instancetype)init {
+    return [self initWithServiceName:nil
+                       operationName:nil];
+}
+
+- (instancetype)initWithServiceName:(NSString *)serviceName
+                      operationName:(NSString *)operationName {
+    if (self = [super init]) {
+        _serviceName = serviceName;
+        _operationName = operationName;
+        _startTime = [AWSNetworkingRequestMetrics currentTime];
+    }
+
+    return self;
+}
+
+- (NSTimeInterval)durationForPhase:(AWSNetworkingRequestPhase)phase {
+    if (phase < 0 || phase >= AWSNetworkingRequestPhaseCount) {
+        return 0;
+    }
+    @synchronized(self) {
+        return _durations[phase];
+    }
+}
+
+- (NSDictionary<NSString *, NSNumber *> *)phaseDurations {
+    NSMutableDictionary *phaseDurations = [NSMutableDictionary dictionaryWithCapacity:AWSNetworkingRequestPhaseCount];
+    @synchronized(self) {
+        for (NSInteger phase = 0; phase < AWSNetworkingRequestPhaseCount; phase++) {
+            phaseDurations[[AWSNetworkingRequestMetrics nameForPhase:phase]] = @(_durations[phase]);
+        }
+    }
+
+    return phaseDurations;
+}
+
+- (void)beginPhase:(AWSNetworkingRequestPhase)phase {
+    if (phase < 0 || phase >= AWSNetworkingRequestPhaseCount) {
+        return;
+    }
+    NSTimeInterval now = [AWSNetworkingRequestMetrics currentTime];
+    @synchronized(self) {
+        _phaseStartTimes[phase] = now;
+    }
+}
+
+- (void)endPhase:(AWSNetworkingRequestPhase)phase {
+    if (phase < 0 || phase >= AWSNetworkingRequestPhaseCount) {
+        return;
+    }
+    NSTimeInterval now = [AWSNetworkingRequestMetrics currentTime];
+    @synchronized(self) {
+        if (_phaseStartTimes[phase] > 0) {
+            _durations[phase] += now - _phaseStartTimes[phase];
+            _phaseStartTimes[phase] = 0;
+        }
+    }
+}
+
+- (void)addDuration:(NSTimeInterval)duration
+           forPhase:(AWSNetworkingRequestPhase)phase {
+    if (phase < 0 || phase >= AWSNetworkingRequestPhaseCount || duration <= 0) {
+        return;
+    }
+    @synchronized(self) {
+        _durations[phase] += duration;
+    }
+}
+
+- (void)recordTaskMetrics:(NSURLSessionTaskMetrics *)taskMetrics {
+    self.taskMetrics = taskMetrics;
+
+    // Only the transaction that went to the network carries connection timings; redirects add earlier ones.
+    NSURLSessionTaskTransactionMetrics *transactionMetrics = nil;
+    for (NSURLSessionTaskTransactionMetrics *metrics in [taskMetrics.transactionMetrics reverseObjectEnumerator]) {
+        if (metrics.resourceFetchType == NSURLSessionTaskMetricsResourceFetchTypeNetworkLoad) {
+            transactionMetrics = metrics;
+            break;
+        }
+    }
+    if (!transactionMetrics) {
+        return;
+    }
+
+    NSDate *taskStartDate = taskMetrics.taskInterval.startDate;
+    [self addDuration:AWSTimeIntervalBetweenDates(taskStartDate, transactionMetrics.fetchStartDate)
+             forPhase:AWSNetworkingRequestPhaseQueueWait];
+    [self addDuration:AWSTimeIntervalBetweenDates(transactionMetrics.domainLookupStartDate, transactionMetrics.domainLookupEndDate)
+             forPhase:AWSNetworkingRequestPhaseDomainLookup];
+    if (transactionMetrics.secureConnectionStartDate) {
+        [self addDuration:AWSTimeIntervalBetweenDates(transactionMetrics.connectStartDate, transactionMetrics.secureConnectionStartDate)
+                 forPhase:AWSNetworkingRequestPhaseConnect];
+        [self addDuration:AWSTimeIntervalBetweenDates(transactionMetrics.secureConnectionStartDate, transactionMetrics.secureConnectionEndDate)
+                 forPhase:AWSNetworkingRequestPhaseSecureConnection];
+    } else {
+        [self addDuration:AWSTimeIntervalBetweenDates(transactionMetrics.connectStartDate, transactionMetrics.connectEndDate)
+                 forPhase:AWSNetworkingRequestPhaseConnect];
+    }
+    [self addDuration:AWSTimeIntervalBetweenDates(transactionMetrics.requestStartDate, transactionMetrics.responseStartDate)
+             forPhase:AWSNetworkingRequestPhaseTimeToFirstByte];
+    [self addDuration:AWSTimeIntervalBetweenDates(transactionMetrics.responseStartDate, transactionMetrics.responseEndDate)
+             forPhase:AWSNetworkingRequestPhaseBodyTransfer];
+}
+
+- (void)recordHedgeDecision:(AWSNetworkingHedgeDecision)hedgeDecision
+                 hedgeDelay:(NSTimeInterval)hedgeDelay {
+    self.hedgeDecision = hedgeDecision;
+    self.hedgeDelay = hedgeDelay;
+}
+
+- (void)recordHedgeWon {
+    self.hedgeWon = YES;
+}
+
+- (void)finishWithStatusCode:(NSInteger)HTTPStatusCode
+                  retryCount:(uint32_t)retryCount
+                       error:(NSError *)error {
+    self.HTTPStatusCode = HTTPStatusCode;
+    self.retryCount = retryCount;
+    self.error = error;
+    self.totalDuration = [AWSNetworkingRequestMetrics currentTime] - _startTime;
+
+    NSHashTable *observers = [AWSNetworkingRequestMetrics observers];
+    NSArray<id<AWSNetworkingMetricsObserver>> *observersToNotify = nil;
+    @synchronized(observers) {
+        observersToNotify = [observers allObjects];
+    }
+    for (id<AWSNetworkingMetricsObserver> observer in observersToNotify) {
+        [observer networkingRequestDidFinishWithMetrics:self];
+    }
+}
+
+- (NSString *)description {
+    return [NSString stringWithFormat:@"<%@: %@ %@ total=%.3fs retries=%u status=%ld phases=%@>",
+            NSStringFromClass([self class]),
+            self.serviceName,
+            self.operationName,
+            self.totalDuration,
+            self.retryCount,
+            (long)self.HTTPStatusCode,
+            [self phaseDurations]];
+}
+
+@end
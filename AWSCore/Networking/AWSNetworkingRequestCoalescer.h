@@ -0,0 +1,75 @@
+//
+// Copyright 2010-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+@class AWSNetworkingRequest;
+@class AWSTask<__covariant ResultType>;
+
+/**
+ A point-in-time snapshot of the counters of an `AWSNetworkingRequestCoalescer`.
+ */
+@interface AWSNetworkingRequestCoalescingStatistics : NSObject
+
+/**
+ The number of coalescable requests that were sent.
+ */
+@property (nonatomic, assign, readonly) NSUInteger requestCount;
+
+/**
+ The number of requests that attached to an identical request already in flight instead of being sent.
+ */
+@property (nonatomic, assign, readonly) NSUInteger coalescedRequestCount;
+
+/**
+ The number of requests that were cancelled while waiting for a shared response.
+ */
+@property (nonatomic, assign, readonly) NSUInteger cancelledRequestCount;
+
+/**
+ `coalescedRequestCount` divided by `requestCount`.
+ */
+@property (nonatomic, assign, readonly) double hitRate;
+
+@end
+
+/**
+ Sends identical idempotent reads that are in flight at the same time only once. A request that serializes to the same
+ HTTP method, URL, headers and body as one already in flight on the same client waits for that request's response
+ instead of going out on the wire. Every waiter receives its own copy of the response object.
+
+ Cancelling a waiter, or its cancellation token or deadline firing, only completes that waiter's task; the shared
+ request is cancelled when all its waiters are.
+
+ Set an instance on `AWSNetworkingConfiguration.requestCoalescer` to opt in. Sharing the instance between clients
+ aggregates the counters; requests of different clients are never coalesced.
+ */
+@interface AWSNetworkingRequestCoalescer : NSObject
+
+/**
+ Operations that are coalesced although they are not GET or HEAD requests. The default value contains the DynamoDB
+ `GetItem` and `BatchGetItem` operations.
+ */
+@property (nonatomic, copy) NSSet<NSString *> *coalescableOperationNames;
+
+- (BOOL)isRequestCoalescable:(AWSNetworkingRequest *)request;
+
+- (AWSNetworkingRequestCoalescingStatistics *)statistics;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,282 @@
+//
+// Copyright 2010-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import "AWSNetworkingRequestCoalescer.h"
+#import "AWSNetworking.h"
+#import "AWSNetworkingMetrics.h"
+#import "AWSBolts.h"
+#import "AWSSignature.h"
+
+#pragma mark - AWSNetworkingRequestCoalescingStatistics
+
+@interface AWSNetworkingRequestCoalescingStatistics()
+
+@property (nonatomic, assign) NSUInteger requestCount;
+@property (nonatomic, assign) NSUInteger coalescedRequestCount;
+@property (nonatomic, assign) NSUInteger cancelledRequestCount;
+
+@end
+
+@implementation AWSNetworkingRequestCoalescingStatistics
+
+- (double)hitRate {
+    if (self.requestCount == 0) {
+        return 0;
+    }
+
+    return (double)self.coalescedRequestCount / self.requestCount;
+}
+
+- (NSString *)description {
+    return [NSString stringWithFormat:@"<%@: requests=%lu coalesced=%lu cancelled=%lu hitRate=%.3f>",
+            NSStringFromClass([self class]),
+            (unsigned long)self.requestCount,
+            (unsigned long)self.coalescedRequestCount,
+            (unsigned long)self.cancelledRequestCount,
+            self.hitRate];
+}
+
+@end
+
+#pragma mark - AWSCoalescedRequest
+
+/**
+ A request on the wire and the callers waiting for its response.
+ */
+@interface AWSCoalescedRequest : NSObject
+
+@property (nonatomic, strong) AWSNetworkingRequest *sharedRequest;
+@property (nonatomic, strong) NSMapTable<AWSNetworkingRequest *, AWSTaskCompletionSource *> *waiters;
+
+@end
+
+@implementation AWSCoalescedRequest
+
+- (instancetype)init {
+    if (self = [super init]) {
+        _waiters = [NSMapTable mapTableWithKeyOptions:NSPointerFunctionsStrongMemory | NSPointerFunctionsObjectPointerPersonality
+                                         valueOptions:NSPointerFunctionsStrongMemory];
+    }
+
+    return self;
+}
+
+@end
+
+#pragma mark - AWSNetworkingRequestCoalescer
+
+@interface AWSNetworkingRequestCoalescer()
+
+@property (nonatomic, strong) NSMutableDictionary<NSString *, AWSCoalescedRequest *> *coalescedRequests;
+@property (nonatomic, assign) NSUInteger requestCount;
+@property (nonatomic, assign) NSUInteger coalescedRequestCount;
+@property (nonatomic, assign) NSUInteger cancelledRequestCount;
+
+@end
+
+@implementation AWSNetworkingRequestCoalescer
+
+- (instancetype)init {
+    if (self = [super init]) {
+        _coalescableOperationNames = [NSSet setWithObjects:@"GetItem", @"BatchGetItem", nil];
+        _coalescedRequests = [NSMutableDictionary new];
+    }
+
+    return self;
+}
+
+- (BOOL)isRequestCoalescable:(AWSNetworkingRequest *)request {
+    // Each of these belongs to one caller and cannot be shared.
+    if (request.uploadingFileURL
+        || request.downloadingFileURL
+        || request.responseDataHandler
+        || request.responseOutputStream
+        || request.uploadProgress
+        || request.downloadProgress) {
+        return NO;
+    }
+
+    return request.HTTPMethod == AWSHTTPMethodGET
+    || request.HTTPMethod == AWSHTTPMethodHEAD
+    || [self.coalescableOperationNames containsObject:request.metrics.operationName ?: @""];
+}
+
+- (AWSNetworkingRequestCoalescingStatistics *)statistics {
+    AWSNetworkingRequestCoalescingStatistics *statistics = [AWSNetworkingRequestCoalescingStatistics new];
+    @synchronized(self) {
+        statistics.requestCount = self.requestCount;
+        statistics.coalescedRequestCount = self.coalescedRequestCount;
+        statistics.cancelledRequestCount = self.cancelledRequestCount;
+    }
+
+    return statistics;
+}
+
+/**
+ Serializes the request the way it goes on the wire and keys it by HTTP method, URL, the headers that are signed and a
+ hash of the body. Returns nil when the request cannot be serialized up front, e.g. because its body is a stream.
+ */
+- (NSString *)keyForRequest:(AWSNetworkingRequest *)request
+                      scope:(id)scope {
+    NSMutableURLRequest *URLRequest = [NSMutableURLRequest requestWithURL:request.URL];
+    URLRequest.HTTPMethod = [NSString aws_stringWithHTTPMethod:request.HTTPMethod];
+    if (request.requestSerializer) {
+        AWSTask *task = [request.requestSerializer serializeRequest:URLRequest
+                                                            headers:request.headers
+                                                         parameters:request.parameters];
+        if (!task.completed || task.error || URLRequest.HTTPBodyStream) {
+            return nil;
+        }
+    } else {
+        for (NSString *headerName in request.headers) {
+            [URLRequest setValue:request.headers[headerName] forHTTPHeaderField:headerName];
+        }
+    }
+
+    NSDictionary<NSString *, NSString *> *headers = URLRequest.allHTTPHeaderFields;
+    NSMutableString *key = [NSMutableString stringWithFormat:@"%p %@ %@",
+                            scope,
+                            URLRequest.HTTPMethod,
+                            URLRequest.URL.absoluteString];
+    for (NSString *headerName in [[headers allKeys] sortedArrayUsingSelector:@selector(caseInsensitiveCompare:)]) {
+        [key appendFormat:@"\n%@:%@", [headerName lowercaseString], headers[headerName]];
+    }
+    if ([URLRequest.HTTPBody length] > 0) {
+        [key appendFormat:@"\n%@", [AWSSignatureSignerUtility hexEncodeData:[AWSSignatureSignerUtility hash:URLRequest.HTTPBody]]];
+    }
+
+    return key;
+}
+
+- (AWSTask *)sendRequest:(AWSNetworkingRequest *)request
+                     key:(NSString *)key
+              usingBlock:(AWSTask *(^)(AWSNetworkingRequest *sharedRequest))block {
+    AWSTaskCompletionSource *taskCompletionSource = [AWSTaskCompletionSource taskCompletionSource];
+    AWSCoalescedRequest *coalescedRequest = nil;
+    BOOL isFollower = NO;
+    @synchronized(self) {
+        self.requestCount++;
+        coalescedRequest = self.coalescedRequests[key];
+        if (coalescedRequest) {
+            self.coalescedRequestCount++;
+            isFollower = YES;
+        } else {
+            coalescedRequest = [AWSCoalescedRequest new];
+            coalescedRequest.sharedRequest = [self sharedRequestForRequest:request];
+            self.coalescedRequests[key] = coalescedRequest;
+        }
+        [coalescedRequest.waiters setObject:taskCompletionSource forKey:request];
+    }
+
+    // A cancellation token or deadline that fired before the request was attached found nothing to detach.
+    if (request.isCancelled) {
+        [self cancelRequest:request
+                        key:key];
+    }
+    if (isFollower) {
+        return taskCompletionSource.task;
+    }
+
+    [block(coalescedRequest.sharedRequest) continueWithBlock:^id _Nullable(AWSTask * _Nonnull task) {
+        NSArray<AWSTaskCompletionSource *> *waiters = nil;
+        @synchronized(self) {
+            if (self.coalescedRequests[key] == coalescedRequest) {
+                [self.coalescedRequests removeObjectForKey:key];
+            }
+            waiters = [[coalescedRequest.waiters objectEnumerator] allObjects];
+            [coalescedRequest.waiters removeAllObjects];
+        }
+
+        if (task.error) {
+            for (AWSTaskCompletionSource *waiter in waiters) {
+                [waiter trySetError:task.error];
+            }
+            return nil;
+        }
+
+        // Every waiter gets its own output so one caller changing it is not seen by the others.
+        NSData *archivedResult = nil;
+        if ([waiters count] > 1 && [task.result conformsToProtocol:@protocol(NSCoding)]) {
+            archivedResult = [NSKeyedArchiver archivedDataWithRootObject:task.result
+                                                   requiringSecureCoding:NO
+                                                                   error:nil];
+        }
+        for (AWSTaskCompletionSource *waiter in waiters) {
+            id result = task.result;
+            if (waiter != [waiters firstObject]) {
+                result = [self copyOfResult:result archivedResult:archivedResult];
+            }
+            [waiter trySetResult:result];
+        }
+        return nil;
+    }];
+
+    return taskCompletionSource.task;
+}
+
+- (void)cancelRequest:(AWSNetworkingRequest *)request
+                  key:(NSString *)key {
+    AWSTaskCompletionSource *taskCompletionSource = nil;
+    AWSNetworkingRequest *requestToCancel = nil;
+    @synchronized(self) {
+        AWSCoalescedRequest *coalescedRequest = self.coalescedRequests[key];
+        taskCompletionSource = [coalescedRequest.waiters objectForKey:request];
+        if (!taskCompletionSource) {
+            return;
+        }
+        self.cancelledRequestCount++;
+        [coalescedRequest.waiters removeObjectForKey:request];
+        if ([coalescedRequest.waiters count] == 0) {
+            [self.coalescedRequests removeObjectForKey:key];
+            requestToCancel = coalescedRequest.sharedRequest;
+        }
+    }
+
+    [taskCompletionSource trySetError:[NSError errorWithDomain:AWSNetworkingErrorDomain
+                                                          code:AWSNetworkingErrorCancelled
+                                                      userInfo:nil]];
+    [requestToCancel cancel];
+}
+
+- (id)copyOfResult:(id)result
+    archivedResult:(NSData *)archivedResult {
+    if (archivedResult) {
+        NSKeyedUnarchiver *unarchiver = [[NSKeyedUnarchiver alloc] initForReadingFromData:archivedResult
+                                                                                    error:nil];
+        unarchiver.requiresSecureCoding = NO;
+        id copy = [unarchiver decodeObjectForKey:NSKeyedArchiveRootObjectKey];
+        [unarchiver finishDecoding];
+        if (copy) {
+            return copy;
+        }
+    }
+    if ([result conformsToProtocol:@protocol(NSCopying)]) {
+        return [result copy];
+    }
+
+    return result;
+}
+
+- (AWSNetworkingRequest *)sharedRequestForRequest:(AWSNetworkingRequest *)request {
+    AWSNetworkingRequest *sharedRequest = [request copy];
+    sharedRequest.parameters = request.parameters;
+    sharedRequest.priority = request.priority;
+    sharedRequest.metrics = [[AWSNetworkingRequestMetrics alloc] initWithServiceName:request.metrics.serviceName
+                                                                       operationName:request.metrics.operationName];
+
+    return sharedRequest;
+}
+
+@end
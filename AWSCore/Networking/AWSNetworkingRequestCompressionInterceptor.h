@@ -0,0 +1,75 @@
+//
+// Copyright 2010-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <Foundation/Foundation.h>
+#import "AWSNetworking.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ A point-in-time snapshot of the counters of an `AWSNetworkingRequestCompressionInterceptor`, to weigh the bytes saved
+ on the wire against the time spent compressing.
+ */
+@interface AWSNetworkingRequestCompressionStatistics : NSObject
+
+@property (nonatomic, assign, readonly) NSUInteger compressedRequestCount;
+
+/**
+ The number of eligible requests sent uncompressed because compressing did not make them smaller.
+ */
+@property (nonatomic, assign, readonly) NSUInteger incompressibleRequestCount;
+
+@property (nonatomic, assign, readonly) int64_t uncompressedByteCount;
+@property (nonatomic, assign, readonly) int64_t compressedByteCount;
+@property (nonatomic, assign, readonly) NSTimeInterval compressionDuration;
+
+@end
+
+/**
+ Compresses request bodies with gzip and sets `Content-Encoding: gzip`. The body is signed as compressed, so the
+ interceptor must come before the signer in `requestInterceptors`. Bodies smaller than `minimumCompressionSize` and
+ streamed bodies are sent as they are.
+ */
+@interface AWSNetworkingRequestCompressionInterceptor : NSObject <AWSNetworkingRequestInterceptor>
+
+/**
+ The smallest body that is compressed. The default value is 10 KB.
+ */
+@property (nonatomic, assign) NSUInteger minimumCompressionSize;
+
+/**
+ The zlib compression level between `0.0` and `1.0`, or `-1.0` for the zlib default. The default value is `-1.0`.
+ */
+@property (nonatomic, assign) float compressionLevel;
+
+/**
+ The operations whose requests are compressed, or `nil` to compress every request. `nil` as well when the operations
+ are read from a definition.
+ */
+@property (nonatomic, copy, readonly, nullable) NSSet<NSString *> *operationNames;
+
+- (instancetype)initWithOperationNames:(nullable NSSet<NSString *> *)operationNames;
+
+/**
+ Compresses the operations whose definition has a `requestcompression` trait that lists the `gzip` encoding. An
+ operation is looked up the first time one of its requests is sent.
+ */
+- (instancetype)initWithJSONDefinition:(NSDictionary *)JSONDefinition;
+
+- (AWSNetworkingRequestCompressionStatistics *)statistics;
+
+@end
+
+NS_ASSUME_NONNULL_END
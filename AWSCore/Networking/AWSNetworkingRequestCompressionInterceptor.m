@@ -0,0 +1,173 @@
+//
+// Copyright 2010-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import "AWSNetworkingRequestCompressionInterceptor.h"
+#import "AWSNetworkingMetrics.h"
+#import "AWSGZIP.h"
+#import "AWSBolts.h"
+
+static const NSUInteger AWSNetworkingRequestCompressionDefaultMinimumCompressionSize = 10 * 1024;
+static NSString *const AWSNetworkingRequestCompressionEncoding = @"gzip";
+
+#pragma mark - AWSNetworkingRequestCompressionStatistics
+
+@interface AWSNetworkingRequestCompressionStatistics()
+
+@property (nonatomic, assign) NSUInteger compressedRequestCount;
+@property (nonatomic, assign) NSUInteger incompressibleRequestCount;
+@property (nonatomic, assign) int64_t uncompressedByteCount;
+@property (nonatomic, assign) int64_t compressedByteCount;
+@property (nonatomic, assign) NSTimeInterval compressionDuration;
+
+@end
+
+@implementation AWSNetworkingRequestCompressionStatistics
+
+- (NSString *)description {
+    return [NSString stringWithFormat:@"<%@: compressed=%lu incompressible=%lu uncompressedBytes=%lld compressedBytes=%lld duration=%.3fs>",
+            NSStringFromClass([self class]),
+            (unsigned long)self.compressedRequestCount,
+            (unsigned long)self.incompressibleRequestCount,
+            self.uncompressedByteCount,
+            self.compressedByteCount,
+            self.compressionDuration];
+}
+
+@end
+
+#pragma mark - AWSNetworkingRequestCompressionInterceptor
+
+@interface AWSNetworkingRequestCompressionInterceptor()
+
+@property (nonatomic, copy) NSSet<NSString *> *operationNames;
+@property (nonatomic, strong) NSDictionary *JSONDefinition;
+@property (nonatomic, strong) NSMutableDictionary<NSString *, NSNumber *> *compressedOperations;
+@property (nonatomic, strong) AWSNetworkingRequestCompressionStatistics *counters;
+
+@end
+
+@implementation AWSNetworkingRequestCompressionInterceptor
+
+- (instancetype)init {
+    return [self initWithOperationNames:nil];
+}
+
+- (instancetype)initWithOperationNames:(NSSet<NSString *> *)operationNames {
+    if (self = [super init]) {
+        _minimumCompressionSize = AWSNetworkingRequestCompressionDefaultMinimumCompressionSize;
+        _compressionLevel = -1.0f;
+        _operationNames = [operationNames copy];
+        _counters = [AWSNetworkingRequestCompressionStatistics new];
+    }
+
+    return self;
+}
+
+- (instancetype)initWithJSONDefinition:(NSDictionary *)JSONDefinition {
+    if (self = [self initWithOperationNames:nil]) {
+        _JSONDefinition = JSONDefinition;
+        _compressedOperations = [NSMutableDictionary new];
+    }
+
+    return self;
+}
+
+- (AWSNetworkingRequestCompressionStatistics *)statistics {
+    AWSNetworkingRequestCompressionStatistics *statistics = [AWSNetworkingRequestCompressionStatistics new];
+    @synchronized(self) {
+        statistics.compressedRequestCount = self.counters.compressedRequestCount;
+        statistics.incompressibleRequestCount = self.counters.incompressibleRequestCount;
+        statistics.uncompressedByteCount = self.counters.uncompressedByteCount;
+        statistics.compressedByteCount = self.counters.compressedByteCount;
+        statistics.compressionDuration = self.counters.compressionDuration;
+    }
+
+    return statistics;
+}
+
+/**
+ Only the definitions of the operations that are sent are read, so a lazily parsed definition stays unparsed.
+ */
+- (BOOL)compressesOperationName:(NSString *)operationName {
+    if (!self.JSONDefinition) {
+        return [self.operationNames containsObject:operationName];
+    }
+
+    @synchronized(self) {
+        NSNumber *compressed = self.compressedOperations[operationName];
+        if (!compressed) {
+            NSArray *encodings = self.JSONDefinition[@"operations"][operationName][@"requestcompression"][@"encodings"];
+            compressed = @([encodings containsObject:AWSNetworkingRequestCompressionEncoding]);
+            self.compressedOperations[operationName] = compressed;
+        }
+        return [compressed boolValue];
+    }
+}
+
+- (AWSTask *)interceptRequest:(NSMutableURLRequest *)request {
+    NSData *body = request.HTTPBody;
+    if ([body length] < MAX(self.minimumCompressionSize, 1)) {
+        return [AWSTask taskWithResult:nil];
+    }
+
+    if (self.operationNames || self.JSONDefinition) {
+        NSString *operationName = [NSURLProtocol propertyForKey:AWSNetworkingRequestOperationNameKey
+                                                      inRequest:request];
+        if (!operationName || ![self compressesOperationName:operationName]) {
+            return [AWSTask taskWithResult:nil];
+        }
+    }
+
+    NSString *contentEncoding = [request valueForHTTPHeaderField:@"Content-Encoding"];
+    if ([contentEncoding rangeOfString:AWSNetworkingRequestCompressionEncoding options:NSCaseInsensitiveSearch].location != NSNotFound) {
+        return [AWSTask taskWithResult:nil];
+    }
+
+    NSTimeInterval startTime = [AWSNetworkingRequestMetrics currentTime];
+    NSData *compressedBody = [body awsgzip_gzippedDataWithCompressionLevel:self.compressionLevel];
+    NSTimeInterval compressionDuration = [AWSNetworkingRequestMetrics currentTime] - startTime;
+
+    BOOL compressed = compressedBody && [compressedBody length] < [body length];
+    @synchronized(self) {
+        self.counters.compressionDuration += compressionDuration;
+        if (compressed) {
+            self.counters.compressedRequestCount++;
+            self.counters.uncompressedByteCount += [body length];
+            self.counters.compressedByteCount += [compressedBody length];
+        } else {
+            self.counters.incompressibleRequestCount++;
+        }
+    }
+    if (!compressed) {
+        return [AWSTask taskWithResult:nil];
+    }
+
+    request.HTTPBody = compressedBody;
+    if (contentEncoding) {
+        contentEncoding = [NSString stringWithFormat:@"%@, %@", contentEncoding, AWSNetworkingRequestCompressionEncoding];
+    } else {
+        contentEncoding = AWSNetworkingRequestCompressionEncoding;
+    }
+    [request setValue:contentEncoding
+   forHTTPHeaderField:@"Content-Encoding"];
+    if ([request valueForHTTPHeaderField:@"Content-Length"]) {
+        [request setValue:[NSString stringWithFormat:@"%lu", (unsigned long)[compressedBody length]]
+       forHTTPHeaderField:@"Content-Length"];
+    }
+
+    return [AWSTask taskWithResult:nil];
+}
+
+@end
@@ -0,0 +1,106 @@
+//
+// Copyright 2010-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+typedef NS_ENUM(NSInteger, AWSNetworkingRequestPriority) {
+    /** Requests that do not set a priority. */
+    AWSNetworkingRequestPriorityDefault,
+    /** Latency-sensitive requests a user is waiting for. */
+    AWSNetworkingRequestPriorityInteractive,
+    /** Large transfers that may be delayed, such as the uploads and downloads of `AWSS3TransferManager`. */
+    AWSNetworkingRequestPriorityBulk
+};
+
+/**
+ A point-in-time snapshot of the counters of an `AWSNetworkingRequestScheduler`.
+ */
+@interface AWSNetworkingRequestSchedulerStatistics : NSObject
+
+- (NSUInteger)inFlightRequestCountForPriority:(AWSNetworkingRequestPriority)priority;
+- (int64_t)inFlightByteCountForPriority:(AWSNetworkingRequestPriority)priority;
+
+/**
+ The number of requests waiting to be admitted.
+ */
+- (NSUInteger)pendingRequestCountForPriority:(AWSNetworkingRequestPriority)priority;
+
+/**
+ The number of requests admitted since the scheduler was created. Retries are admitted again and counted again.
+ */
+- (NSUInteger)admittedRequestCountForPriority:(AWSNetworkingRequestPriority)priority;
+
+/**
+ The number of requests that had to wait before they were admitted.
+ */
+- (NSUInteger)queuedRequestCountForPriority:(AWSNetworkingRequestPriority)priority;
+
+@end
+
+/**
+ Limits the requests that are on the wire at the same time, per priority class and per host. A request that would
+ exceed a limit waits in its class's queue after it has been serialized and before it is signed, so the task returned
+ by `AWSNetworking`'s `sendRequest:` stays pending instead of another task being handed to `NSURLSession`. Whenever a
+ request completes, the waiting requests are admitted by weighted fair queuing: each class gets a share of the
+ admissions proportional to its weight, and a class that was idle does not build up credit.
+
+ The byte limits count the request body, so they mostly apply to uploads. A request larger than a byte limit is
+ admitted once no other request body of its class or host is in flight. A limit of `0` means no limit. Limits and
+ weights may be changed at any time; raising one admits the waiting requests it makes room for.
+
+ Set an instance on `AWSNetworkingConfiguration.requestScheduler` to opt in. Share the instance between clients to
+ schedule their requests together.
+ */
+@interface AWSNetworkingRequestScheduler : NSObject
+
+/**
+ The maximum number of requests in flight to one host, over all classes. The default value is `16`.
+ */
+@property (nonatomic, assign) NSUInteger maximumInFlightRequestCountPerHost;
+
+/**
+ The maximum number of request body bytes in flight to one host, over all classes. The default value is `0`.
+ */
+@property (nonatomic, assign) int64_t maximumInFlightByteCountPerHost;
+
+/**
+ The default values are `32` for interactive, `16` for default and `4` for bulk requests.
+ */
+- (NSUInteger)maximumInFlightRequestCountForPriority:(AWSNetworkingRequestPriority)priority;
+- (void)setMaximumInFlightRequestCount:(NSUInteger)maximumInFlightRequestCount
+                           forPriority:(AWSNetworkingRequestPriority)priority;
+
+/**
+ The default values are `0` for interactive and default requests and 32 MB for bulk requests.
+ */
+- (int64_t)maximumInFlightByteCountForPriority:(AWSNetworkingRequestPriority)priority;
+- (void)setMaximumInFlightByteCount:(int64_t)maximumInFlightByteCount
+                        forPriority:(AWSNetworkingRequestPriority)priority;
+
+/**
+ The relative share of admissions a class gets while several classes are waiting. The default values are `8` for
+ interactive, `4` for default and `1` for bulk requests.
+ */
+- (NSUInteger)weightForPriority:(AWSNetworkingRequestPriority)priority;
+- (void)setWeight:(NSUInteger)weight
+      forPriority:(AWSNetworkingRequestPriority)priority;
+
+- (AWSNetworkingRequestSchedulerStatistics *)statistics;
+
+@end
+
+NS_ASSUME_NONNULL_END
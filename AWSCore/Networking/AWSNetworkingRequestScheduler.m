@@ -0,0 +1,432 @@
+//
+// Copyright 2010-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import "AWSNetworkingRequestScheduler.h"
+#import "AWSNetworking.h"
+#import "AWSBolts.h"
+
+static const NSUInteger AWSNetworkingRequestPriorityClassCount = 3;
+static const NSUInteger AWSNetworkingRequestSchedulerDefaultMaximumInFlightRequestCountPerHost = 16;
+
+typedef struct {
+    NSUInteger maximumInFlightRequestCount;
+    int64_t maximumInFlightByteCount;
+    NSUInteger weight;
+    NSUInteger inFlightRequestCount;
+    int64_t inFlightByteCount;
+    NSUInteger admittedRequestCount;
+    NSUInteger queuedRequestCount;
+    // The stride scheduling position of the class: the waiting class with the lowest pass is admitted next.
+    double pass;
+} AWSRequestPriorityClass;
+
+static NSUInteger AWSRequestPriorityClassIndex(AWSNetworkingRequestPriority priority) {
+    if (priority < 0 || priority >= (NSInteger)AWSNetworkingRequestPriorityClassCount) {
+        return AWSNetworkingRequestPriorityDefault;
+    }
+    return (NSUInteger)priority;
+}
+
+#pragma mark - AWSRequestSchedulerTicket
+
+/**
+ A request waiting for admission or in flight. It is handed back to the scheduler when the attempt completes.
+ */
+@interface AWSRequestSchedulerTicket : NSObject
+
+@property (nonatomic, weak) AWSNetworkingRequest *request;
+@property (nonatomic, assign) NSUInteger priorityIndex;
+@property (nonatomic, strong) NSString *host;
+@property (nonatomic, assign) int64_t byteCount;
+@property (nonatomic, assign) BOOL admitted;
+@property (nonatomic, strong) AWSTaskCompletionSource *taskCompletionSource;
+
+@end
+
+@implementation AWSRequestSchedulerTicket
+
+@end
+
+#pragma mark - AWSRequestSchedulerHostState
+
+@interface AWSRequestSchedulerHostState : NSObject
+
+@property (nonatomic, assign) NSUInteger inFlightRequestCount;
+@property (nonatomic, assign) int64_t inFlightByteCount;
+
+@end
+
+@implementation AWSRequestSchedulerHostState
+
+@end
+
+#pragma mark - AWSNetworkingRequestSchedulerStatistics
+
+@implementation AWSNetworkingRequestSchedulerStatistics {
+    @package
+    NSUInteger _inFlightRequestCounts[AWSNetworkingRequestPriorityClassCount];
+    int64_t _inFlightByteCounts[AWSNetworkingRequestPriorityClassCount];
+    NSUInteger _pendingRequestCounts[AWSNetworkingRequestPriorityClassCount];
+    NSUInteger _admittedRequestCounts[AWSNetworkingRequestPriorityClassCount];
+    NSUInteger _queuedRequestCounts[AWSNetworkingRequestPriorityClassCount];
+}
+
+- (NSUInteger)inFlightRequestCountForPriority:(AWSNetworkingRequestPriority)priority {
+    return _inFlightRequestCounts[AWSRequestPriorityClassIndex(priority)];
+}
+
+- (int64_t)inFlightByteCountForPriority:(AWSNetworkingRequestPriority)priority {
+    return _inFlightByteCounts[AWSRequestPriorityClassIndex(priority)];
+}
+
+- (NSUInteger)pendingRequestCountForPriority:(AWSNetworkingRequestPriority)priority {
+    return _pendingRequestCounts[AWSRequestPriorityClassIndex(priority)];
+}
+
+- (NSUInteger)admittedRequestCountForPriority:(AWSNetworkingRequestPriority)priority {
+    return _admittedRequestCounts[AWSRequestPriorityClassIndex(priority)];
+}
+
+- (NSUInteger)queuedRequestCountForPriority:(AWSNetworkingRequestPriority)priority {
+    return _queuedRequestCounts[AWSRequestPriorityClassIndex(priority)];
+}
+
+- (NSString *)description {
+    NSMutableString *description = [NSMutableString stringWithFormat:@"<%@:", NSStringFromClass([self class])];
+    NSArray<NSString *> *names = @[@"default", @"interactive", @"bulk"];
+    for (NSUInteger i = 0; i < AWSNetworkingRequestPriorityClassCount; i++) {
+        [description appendFormat:@" %@={inFlight=%lu bytes=%lld pending=%lu admitted=%lu queued=%lu}",
+         names[i],
+         (unsigned long)_inFlightRequestCounts[i],
+         _inFlightByteCounts[i],
+         (unsigned long)_pendingRequestCounts[i],
+         (unsigned long)_admittedRequestCounts[i],
+         (unsigned long)_queuedRequestCounts[i]];
+    }
+    [description appendString:@">"];
+
+    return description;
+}
+
+@end
+
+#pragma mark - AWSNetworkingRequestScheduler
+
+@interface AWSNetworkingRequestScheduler()
+
+@property (nonatomic, strong) NSMutableDictionary<NSString *, AWSRequestSchedulerHostState *> *hostStates;
+
+@end
+
+@implementation AWSNetworkingRequestScheduler {
+    AWSRequestPriorityClass _priorityClasses[AWSNetworkingRequestPriorityClassCount];
+    NSMutableArray<AWSRequestSchedulerTicket *> *_pendingTickets[AWSNetworkingRequestPriorityClassCount];
+    // The pass of the last admission. A class that starts waiting again resumes from here.
+    double _virtualTime;
+}
+
+@synthesize maximumInFlightRequestCountPerHost = _maximumInFlightRequestCountPerHost;
+@synthesize maximumInFlightByteCountPerHost = _maximumInFlightByteCountPerHost;
+
+- (instancetype)init {
+    if (self = [super init]) {
+        _maximumInFlightRequestCountPerHost = AWSNetworkingRequestSchedulerDefaultMaximumInFlightRequestCountPerHost;
+        _hostStates = [NSMutableDictionary new];
+
+        _priorityClasses[AWSNetworkingRequestPriorityInteractive].maximumInFlightRequestCount = 32;
+        _priorityClasses[AWSNetworkingRequestPriorityInteractive].weight = 8;
+        _priorityClasses[AWSNetworkingRequestPriorityDefault].maximumInFlightRequestCount = 16;
+        _priorityClasses[AWSNetworkingRequestPriorityDefault].weight = 4;
+        _priorityClasses[AWSNetworkingRequestPriorityBulk].maximumInFlightRequestCount = 4;
+        _priorityClasses[AWSNetworkingRequestPriorityBulk].maximumInFlightByteCount = 32 * 1024 * 1024;
+        _priorityClasses[AWSNetworkingRequestPriorityBulk].weight = 1;
+        for (NSUInteger i = 0; i < AWSNetworkingRequestPriorityClassCount; i++) {
+            _pendingTickets[i] = [NSMutableArray new];
+        }
+    }
+
+    return self;
+}
+
+- (NSUInteger)maximumInFlightRequestCountPerHost {
+    @synchronized(self) {
+        return _maximumInFlightRequestCountPerHost;
+    }
+}
+
+- (void)setMaximumInFlightRequestCountPerHost:(NSUInteger)maximumInFlightRequestCountPerHost {
+    NSMutableArray<AWSRequestSchedulerTicket *> *admittedTickets = [NSMutableArray new];
+    @synchronized(self) {
+        _maximumInFlightRequestCountPerHost = maximumInFlightRequestCountPerHost;
+        [self dequeueTicketsInto:admittedTickets];
+    }
+    [self resumeAdmittedTickets:admittedTickets];
+}
+
+- (int64_t)maximumInFlightByteCountPerHost {
+    @synchronized(self) {
+        return _maximumInFlightByteCountPerHost;
+    }
+}
+
+- (void)setMaximumInFlightByteCountPerHost:(int64_t)maximumInFlightByteCountPerHost {
+    NSMutableArray<AWSRequestSchedulerTicket *> *admittedTickets = [NSMutableArray new];
+    @synchronized(self) {
+        _maximumInFlightByteCountPerHost = maximumInFlightByteCountPerHost;
+        [self dequeueTicketsInto:admittedTickets];
+    }
+    [self resumeAdmittedTickets:admittedTickets];
+}
+
+- (NSUInteger)maximumInFlightRequestCountForPriority:(AWSNetworkingRequestPriority)priority {
+    @synchronized(self) {
+        return _priorityClasses[AWSRequestPriorityClassIndex(priority)].maximumInFlightRequestCount;
+    }
+}
+
+- (void)setMaximumInFlightRequestCount:(NSUInteger)maximumInFlightRequestCount
+                           forPriority:(AWSNetworkingRequestPriority)priority {
+    NSMutableArray<AWSRequestSchedulerTicket *> *admittedTickets = [NSMutableArray new];
+    @synchronized(self) {
+        _priorityClasses[AWSRequestPriorityClassIndex(priority)].maximumInFlightRequestCount = maximumInFlightRequestCount;
+        [self dequeueTicketsInto:admittedTickets];
+    }
+    [self resumeAdmittedTickets:admittedTickets];
+}
+
+- (int64_t)maximumInFlightByteCountForPriority:(AWSNetworkingRequestPriority)priority {
+    @synchronized(self) {
+        return _priorityClasses[AWSRequestPriorityClassIndex(priority)].maximumInFlightByteCount;
+    }
+}
+
+- (void)setMaximumInFlightByteCount:(int64_t)maximumInFlightByteCount
+                        forPriority:(AWSNetworkingRequestPriority)priority {
+    NSMutableArray<AWSRequestSchedulerTicket *> *admittedTickets = [NSMutableArray new];
+    @synchronized(self) {
+        _priorityClasses[AWSRequestPriorityClassIndex(priority)].maximumInFlightByteCount = maximumInFlightByteCount;
+        [self dequeueTicketsInto:admittedTickets];
+    }
+    [self resumeAdmittedTickets:admittedTickets];
+}
+
+- (NSUInteger)weightForPriority:(AWSNetworkingRequestPriority)priority {
+    @synchronized(self) {
+        return _priorityClasses[AWSRequestPriorityClassIndex(priority)].weight;
+    }
+}
+
+- (void)setWeight:(NSUInteger)weight
+      forPriority:(AWSNetworkingRequestPriority)priority {
+    NSMutableArray<AWSRequestSchedulerTicket *> *admittedTickets = [NSMutableArray new];
+    @synchronized(self) {
+        _priorityClasses[AWSRequestPriorityClassIndex(priority)].weight = weight;
+        [self dequeueTicketsInto:admittedTickets];
+    }
+    [self resumeAdmittedTickets:admittedTickets];
+}
+
+- (AWSNetworkingRequestSchedulerStatistics *)statistics {
+    AWSNetworkingRequestSchedulerStatistics *statistics = [AWSNetworkingRequestSchedulerStatistics new];
+    @synchronized(self) {
+        for (NSUInteger i = 0; i < AWSNetworkingRequestPriorityClassCount; i++) {
+            statistics->_inFlightRequestCounts[i] = _priorityClasses[i].inFlightRequestCount;
+            statistics->_inFlightByteCounts[i] = _priorityClasses[i].inFlightByteCount;
+            statistics->_pendingRequestCounts[i] = [_pendingTickets[i] count];
+            statistics->_admittedRequestCounts[i] = _priorityClasses[i].admittedRequestCount;
+            statistics->_queuedRequestCounts[i] = _priorityClasses[i].queuedRequestCount;
+        }
+    }
+
+    return statistics;
+}
+
+/**
+ Returns a task that completes with a ticket once the request may be sent. The ticket must be handed back to
+ `releaseTicket:` when the attempt completes.
+ */
+- (AWSTask *)admitRequest:(AWSNetworkingRequest *)request
+                     host:(NSString *)host
+                byteCount:(int64_t)byteCount {
+    AWSRequestSchedulerTicket *ticket = [AWSRequestSchedulerTicket new];
+    ticket.request = request;
+    ticket.priorityIndex = AWSRequestPriorityClassIndex(request.priority);
+    ticket.host = host ?: @"";
+    ticket.byteCount = MAX(byteCount, 0);
+
+    @synchronized(self) {
+        // Checked under the lock so a request cancelled concurrently is either rejected here or found by cancelPendingRequest:.
+        if (request.isCancelled) {
+            return [AWSTask taskWithError:[NSError errorWithDomain:AWSNetworkingErrorDomain
+                                                              code:AWSNetworkingErrorCancelled
+                                                          userInfo:nil]];
+        }
+
+        AWSRequestPriorityClass *priorityClass = &_priorityClasses[ticket.priorityIndex];
+        NSMutableArray<AWSRequestSchedulerTicket *> *pendingTickets = _pendingTickets[ticket.priorityIndex];
+        if ([pendingTickets count] == 0) {
+            priorityClass->pass = MAX(priorityClass->pass, _virtualTime);
+            if ([self canAdmitTicket:ticket]) {
+                [self admitTicket:ticket];
+                return [AWSTask taskWithResult:ticket];
+            }
+        }
+
+        ticket.taskCompletionSource = [AWSTaskCompletionSource taskCompletionSource];
+        priorityClass->queuedRequestCount++;
+        [pendingTickets addObject:ticket];
+        return ticket.taskCompletionSource.task;
+    }
+}
+
+- (void)releaseTicket:(AWSRequestSchedulerTicket *)ticket {
+    NSMutableArray<AWSRequestSchedulerTicket *> *admittedTickets = [NSMutableArray new];
+    @synchronized(self) {
+        if (!ticket.admitted) {
+            return;
+        }
+        ticket.admitted = NO;
+
+        AWSRequestPriorityClass *priorityClass = &_priorityClasses[ticket.priorityIndex];
+        priorityClass->inFlightRequestCount--;
+        priorityClass->inFlightByteCount -= ticket.byteCount;
+
+        AWSRequestSchedulerHostState *hostState = self.hostStates[ticket.host];
+        hostState.inFlightRequestCount--;
+        hostState.inFlightByteCount -= ticket.byteCount;
+        if (hostState.inFlightRequestCount == 0) {
+            [self.hostStates removeObjectForKey:ticket.host];
+        }
+
+        [self dequeueTicketsInto:admittedTickets];
+    }
+
+    [self resumeAdmittedTickets:admittedTickets];
+}
+
+- (void)cancelPendingRequest:(AWSNetworkingRequest *)request {
+    AWSRequestSchedulerTicket *cancelledTicket = nil;
+    @synchronized(self) {
+        for (NSUInteger i = 0; i < AWSNetworkingRequestPriorityClassCount && !cancelledTicket; i++) {
+            for (AWSRequestSchedulerTicket *ticket in _pendingTickets[i]) {
+                if (ticket.request == request) {
+                    cancelledTicket = ticket;
+                    break;
+                }
+            }
+            if (cancelledTicket) {
+                [_pendingTickets[i] removeObjectIdenticalTo:cancelledTicket];
+            }
+        }
+    }
+
+    [cancelledTicket.taskCompletionSource trySetError:[NSError errorWithDomain:AWSNetworkingErrorDomain
+                                                                          code:AWSNetworkingErrorCancelled
+                                                                      userInfo:nil]];
+}
+
+#pragma mark - Admission
+
+- (BOOL)canAdmitTicket:(AWSRequestSchedulerTicket *)ticket {
+    AWSRequestPriorityClass *priorityClass = &_priorityClasses[ticket.priorityIndex];
+    if (priorityClass->maximumInFlightRequestCount > 0
+        && priorityClass->inFlightRequestCount >= priorityClass->maximumInFlightRequestCount) {
+        return NO;
+    }
+    if (priorityClass->maximumInFlightByteCount > 0
+        && priorityClass->inFlightByteCount > 0
+        && priorityClass->inFlightByteCount + ticket.byteCount > priorityClass->maximumInFlightByteCount) {
+        return NO;
+    }
+
+    AWSRequestSchedulerHostState *hostState = self.hostStates[ticket.host];
+    if (_maximumInFlightRequestCountPerHost > 0
+        && hostState.inFlightRequestCount >= _maximumInFlightRequestCountPerHost) {
+        return NO;
+    }
+    if (_maximumInFlightByteCountPerHost > 0
+        && hostState.inFlightByteCount > 0
+        && hostState.inFlightByteCount + ticket.byteCount > _maximumInFlightByteCountPerHost) {
+        return NO;
+    }
+
+    return YES;
+}
+
+/**
+ Completes the admission of tickets taken off the queues. The admitted requests continue with signing, which may fetch
+ credentials, so they do not run on the calling thread.
+ */
+- (void)resumeAdmittedTickets:(NSArray<AWSRequestSchedulerTicket *> *)admittedTickets {
+    for (AWSRequestSchedulerTicket *admittedTicket in admittedTickets) {
+        dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+            [admittedTicket.taskCompletionSource trySetResult:admittedTicket];
+        });
+    }
+}
+
+- (void)admitTicket:(AWSRequestSchedulerTicket *)ticket {
+    AWSRequestPriorityClass *priorityClass = &_priorityClasses[ticket.priorityIndex];
+    priorityClass->inFlightRequestCount++;
+    priorityClass->inFlightByteCount += ticket.byteCount;
+    priorityClass->admittedRequestCount++;
+    _virtualTime = priorityClass->pass;
+    priorityClass->pass += 1.0 / MAX(priorityClass->weight, 1);
+
+    AWSRequestSchedulerHostState *hostState = self.hostStates[ticket.host];
+    if (!hostState) {
+        hostState = [AWSRequestSchedulerHostState new];
+        self.hostStates[ticket.host] = hostState;
+    }
+    hostState.inFlightRequestCount++;
+    hostState.inFlightByteCount += ticket.byteCount;
+
+    ticket.admitted = YES;
+}
+
+/**
+ Admits waiting requests, always from the class with the lowest pass that has a request within the limits, until none fits.
+ A class is skipped past a request whose host is saturated, so one slow endpoint does not hold up the others.
+ */
+- (void)dequeueTicketsInto:(NSMutableArray<AWSRequestSchedulerTicket *> *)admittedTickets {
+    while (YES) {
+        NSInteger nextPriorityIndex = -1;
+        NSUInteger nextTicketIndex = NSNotFound;
+        for (NSUInteger i = 0; i < AWSNetworkingRequestPriorityClassCount; i++) {
+            if ([_pendingTickets[i] count] == 0
+                || (nextPriorityIndex >= 0 && _priorityClasses[i].pass >= _priorityClasses[nextPriorityIndex].pass)) {
+                continue;
+            }
+            NSUInteger ticketIndex = [_pendingTickets[i] indexOfObjectPassingTest:^BOOL(AWSRequestSchedulerTicket *ticket, NSUInteger idx, BOOL *stop) {
+                return [self canAdmitTicket:ticket];
+            }];
+            if (ticketIndex != NSNotFound) {
+                nextPriorityIndex = i;
+                nextTicketIndex = ticketIndex;
+            }
+        }
+
+        if (nextPriorityIndex < 0) {
+            return;
+        }
+
+        AWSRequestSchedulerTicket *ticket = _pendingTickets[nextPriorityIndex][nextTicketIndex];
+        [_pendingTickets[nextPriorityIndex] removeObjectAtIndex:nextTicketIndex];
+        [self admitTicket:ticket];
+        [admittedTickets addObject:ticket];
+    }
+}
+
+@end
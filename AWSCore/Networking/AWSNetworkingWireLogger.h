@@ -0,0 +1,63 @@
+//
+// Copyright 2010-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+typedef void (^AWSNetworkingWireLogHandler) (NSString *message);
+
+/**
+ Logs the requests as they are sent and the responses as they are received, after signing and before parsing.
+
+ Only one request in `samplingInterval` is logged, together with its response. Bodies are cut to
+ `maximumBodyLength` bytes before they are copied. The values of the headers in `redactedHeaderNames` and of the
+ JSON, XML and query string fields in `redactedFieldNames` are replaced with `[redacted]`; the rules are compiled
+ when the names are set, not for every message.
+
+ Set an instance on `AWSNetworkingConfiguration.wireLogger` to opt in. When it is `nil`, nothing is formatted or copied.
+ */
+@interface AWSNetworkingWireLogger : NSObject
+
+/**
+ Logs one request in this many. The default value is `1`, which logs every request.
+ */
+@property (nonatomic, assign) NSUInteger samplingInterval;
+
+/**
+ The number of bytes of a body that are logged. The default value is 4 KB.
+ */
+@property (nonatomic, assign) NSUInteger maximumBodyLength;
+
+/**
+ Matched case-insensitively. The default value contains `Authorization`, `X-Amz-Security-Token` and the
+ server-side encryption customer key headers.
+ */
+@property (nonatomic, copy) NSSet<NSString *> *redactedHeaderNames;
+
+/**
+ Matched case-insensitively. The default value contains the password fields of Cognito, the fields of temporary
+ credentials and the signature parameters of presigned URLs.
+ */
+@property (nonatomic, copy) NSSet<NSString *> *redactedFieldNames;
+
+/**
+ Receives the formatted messages. The default value is `nil`, which logs them with `AWSDDLogInfo`.
+ */
+@property (nonatomic, copy, nullable) AWSNetworkingWireLogHandler logHandler;
+
+@end
+
+NS_ASSUME_NONNULL_END
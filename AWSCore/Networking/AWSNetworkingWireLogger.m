@@ -0,0 +1,224 @@
+//
+// Copyright 2010-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import "AWSNetworkingWireLogger.h"
+#import "AWSCocoaLumberjack.h"
+
+static const NSUInteger AWSNetworkingWireLoggerDefaultMaximumBodyLength = 4 * 1024;
+static NSString *const AWSNetworkingWireLoggerRedactedValue = @"[redacted]";
+
+@interface AWSNetworkingWireLogger()
+
+// The compiled redaction rules are replaced as a whole when the names change, so they are read without a lock.
+@property (atomic, strong) NSSet<NSString *> *lowercaseRedactedHeaderNames;
+@property (atomic, strong) NSRegularExpression *JSONFieldExpression;
+@property (atomic, strong) NSRegularExpression *XMLFieldExpression;
+@property (atomic, strong) NSRegularExpression *queryFieldExpression;
+@property (nonatomic, assign) NSUInteger requestCount;
+
+@end
+
+@implementation AWSNetworkingWireLogger
+
+- (instancetype)init {
+    if (self = [super init]) {
+        _samplingInterval = 1;
+        _maximumBodyLength = AWSNetworkingWireLoggerDefaultMaximumBodyLength;
+        self.redactedHeaderNames = [NSSet setWithObjects:
+                                    @"Authorization",
+                                    @"X-Amz-Security-Token",
+                                    @"x-amz-server-side-encryption-customer-key",
+                                    @"x-amz-copy-source-server-side-encryption-customer-key",
+                                    nil];
+        self.redactedFieldNames = [NSSet setWithObjects:
+                                   @"Password",
+                                   @"PreviousPassword",
+                                   @"ProposedPassword",
+                                   @"SecretAccessKey",
+                                   @"SecretKey",
+                                   @"SessionToken",
+                                   @"X-Amz-Signature",
+                                   @"X-Amz-Security-Token",
+                                   @"X-Amz-Credential",
+                                   nil];
+    }
+
+    return self;
+}
+
+- (void)setRedactedHeaderNames:(NSSet<NSString *> *)redactedHeaderNames {
+    _redactedHeaderNames = [redactedHeaderNames copy];
+
+    NSMutableSet<NSString *> *lowercaseRedactedHeaderNames = [NSMutableSet setWithCapacity:[redactedHeaderNames count]];
+    for (NSString *headerName in redactedHeaderNames) {
+        [lowercaseRedactedHeaderNames addObject:[headerName lowercaseString]];
+    }
+    self.lowercaseRedactedHeaderNames = lowercaseRedactedHeaderNames;
+}
+
+- (void)setRedactedFieldNames:(NSSet<NSString *> *)redactedFieldNames {
+    _redactedFieldNames = [redactedFieldNames copy];
+
+    if ([redactedFieldNames count] == 0) {
+        self.JSONFieldExpression = nil;
+        self.XMLFieldExpression = nil;
+        self.queryFieldExpression = nil;
+        return;
+    }
+
+    NSMutableArray<NSString *> *escapedFieldNames = [NSMutableArray arrayWithCapacity:[redactedFieldNames count]];
+    for (NSString *fieldName in redactedFieldNames) {
+        [escapedFieldNames addObject:[NSRegularExpression escapedPatternForString:fieldName]];
+    }
+    NSString *fieldNames = [escapedFieldNames componentsJoinedByString:@"|"];
+
+    // Bodies are cut to `maximumBodyLength` before they are redacted, so a value may run to the end of the string.
+    // "Field":"value"
+    self.JSONFieldExpression = [NSRegularExpression regularExpressionWithPattern:[NSString stringWithFormat:@"(\"(?:%@)\"\\s*:\\s*\")(?:[^\"\\\\]|\\\\.)*(\"|\\\\?$)", fieldNames]
+                                                                         options:NSRegularExpressionCaseInsensitive
+                                                                           error:nil];
+    // <Field>value</Field>
+    self.XMLFieldExpression = [NSRegularExpression regularExpressionWithPattern:[NSString stringWithFormat:@"(<(?:%@)>)[^<]*(?=<|$)", fieldNames]
+                                                                        options:NSRegularExpressionCaseInsensitive
+                                                                          error:nil];
+    // Field=value in a query string or a form-encoded body
+    self.queryFieldExpression = [NSRegularExpression regularExpressionWithPattern:[NSString stringWithFormat:@"((?:^|[?&])(?:%@)=)[^&]*", fieldNames]
+                                                                          options:NSRegularExpressionCaseInsensitive
+                                                                            error:nil];
+}
+
+/**
+ Logs the request if it is sampled. Returns the number to pass to `logResponse:data:error:requestNumber:`, or `0` when
+ the request is not sampled.
+ */
+- (NSUInteger)logRequest:(NSURLRequest *)request {
+    NSUInteger requestNumber = 0;
+    @synchronized(self) {
+        requestNumber = ++self.requestCount;
+    }
+    if ((requestNumber - 1) % MAX(self.samplingInterval, 1) != 0) {
+        return 0;
+    }
+
+    NSMutableString *message = [NSMutableString stringWithFormat:@"Request %lu: %@ %@\n",
+                                (unsigned long)requestNumber,
+                                request.HTTPMethod,
+                                [self redactedString:request.URL.absoluteString]];
+    [self appendHeaders:request.allHTTPHeaderFields
+              toMessage:message];
+    if (request.HTTPBody) {
+        [self appendBody:request.HTTPBody
+               toMessage:message];
+    } else if (request.HTTPBodyStream) {
+        [message appendFormat:@"\n[Streamed body of %@ bytes]", [request valueForHTTPHeaderField:@"Content-Length"] ?: @"unknown"];
+    }
+    [self logMessage:message];
+
+    return requestNumber;
+}
+
+- (void)logResponse:(NSURLResponse *)response
+               data:(NSData *)data
+              error:(NSError *)error
+      requestNumber:(NSUInteger)requestNumber {
+    NSMutableString *message = nil;
+    if ([response isKindOfClass:[NSHTTPURLResponse class]]) {
+        NSHTTPURLResponse *HTTPResponse = (NSHTTPURLResponse *)response;
+        message = [NSMutableString stringWithFormat:@"Response %lu: %ld\n", (unsigned long)requestNumber, (long)HTTPResponse.statusCode];
+        [self appendHeaders:HTTPResponse.allHeaderFields
+                  toMessage:message];
+        if (data) {
+            [self appendBody:data
+                   toMessage:message];
+        }
+    } else {
+        message = [NSMutableString stringWithFormat:@"Response %lu: none\n", (unsigned long)requestNumber];
+    }
+    if (error) {
+        [message appendFormat:@"\nError: %@", error];
+    }
+    [self logMessage:message];
+}
+
+#pragma mark - Formatting
+
+- (void)appendHeaders:(NSDictionary *)headers
+            toMessage:(NSMutableString *)message {
+    NSSet<NSString *> *lowercaseRedactedHeaderNames = self.lowercaseRedactedHeaderNames;
+    for (NSString *headerName in [[headers allKeys] sortedArrayUsingSelector:@selector(caseInsensitiveCompare:)]) {
+        BOOL redacted = [lowercaseRedactedHeaderNames containsObject:[headerName lowercaseString]];
+        [message appendFormat:@"%@: %@\n", headerName, redacted ? AWSNetworkingWireLoggerRedactedValue : headers[headerName]];
+    }
+}
+
+- (void)appendBody:(NSData *)body
+         toMessage:(NSMutableString *)message {
+    // Only the logged prefix is copied, however large the body is.
+    NSUInteger length = MIN([body length], self.maximumBodyLength);
+    NSData *prefix = [body subdataWithRange:NSMakeRange(0, length)];
+
+    // A cut in the middle of a UTF-8 sequence fails to decode, so back off to the previous character boundary.
+    NSString *bodyString = nil;
+    for (NSUInteger trimmedLength = 0; !bodyString && trimmedLength < 4 && trimmedLength <= length; trimmedLength++) {
+        bodyString = [[NSString alloc] initWithBytes:[prefix bytes]
+                                              length:length - trimmedLength
+                                            encoding:NSUTF8StringEncoding];
+    }
+
+    if (!bodyString) {
+        [message appendFormat:@"\n[%lu bytes of binary data]", (unsigned long)[body length]];
+        return;
+    }
+    [message appendFormat:@"\n%@", [self redactedString:bodyString]];
+    if (length < [body length]) {
+        [message appendFormat:@"\n[The first %lu of %lu bytes are displayed.]", (unsigned long)length, (unsigned long)[body length]];
+    }
+}
+
+- (NSString *)redactedString:(NSString *)string {
+    NSRegularExpression *JSONFieldExpression = self.JSONFieldExpression;
+    NSRegularExpression *XMLFieldExpression = self.XMLFieldExpression;
+    NSRegularExpression *queryFieldExpression = self.queryFieldExpression;
+    if (!string || !JSONFieldExpression) {
+        return string;
+    }
+
+    NSMutableString *redactedString = [string mutableCopy];
+    [JSONFieldExpression replaceMatchesInString:redactedString
+                                        options:0
+                                          range:NSMakeRange(0, [redactedString length])
+                                   withTemplate:[NSString stringWithFormat:@"$1%@$2", AWSNetworkingWireLoggerRedactedValue]];
+    [XMLFieldExpression replaceMatchesInString:redactedString
+                                       options:0
+                                         range:NSMakeRange(0, [redactedString length])
+                                  withTemplate:[NSString stringWithFormat:@"$1%@", AWSNetworkingWireLoggerRedactedValue]];
+    [queryFieldExpression replaceMatchesInString:redactedString
+                                         options:0
+                                           range:NSMakeRange(0, [redactedString length])
+                                    withTemplate:[NSString stringWithFormat:@"$1%@", AWSNetworkingWireLoggerRedactedValue]];
+
+    return redactedString;
+}
+
+- (void)logMessage:(NSString *)message {
+    AWSNetworkingWireLogHandler logHandler = self.logHandler;
+    if (logHandler) {
+        logHandler(message);
+    } else {
+        AWSDDLogInfo(@"%@", message);
+    }
+}
+
+@end
@@ -14,18 +14,214 @@
 //
 #import "AWSURLSessionManager.h"
 
+#import "AWSURLSessionPool.h"
+#import "AWSNetworkingMetrics.h"
+#import "AWSNetworkingCircuitBreaker.h"
+#import "AWSNetworkingRequestScheduler.h"
+#import "AWSNetworkingWireLogger.h"
 #import "AWSSynchronizedMutableDictionary.h"
 #import "AWSCocoaLumberjack.h"
 #import "AWSCategory.h"
 #import "AWSSignature.h"
 #import "AWSBolts.h"
 #import "AWSCredentialsProvider.h"
+#import <fcntl.h>
+#import <unistd.h>
 
 NSString* const AWSResponseObjectErrorUserInfoKey = @"ResponseObjectError";
-
-#pragma mark - AWSURLSessionManagerDelegate
+NSString *const AWSNetworkingRequestOperationNameKey = @"com.amazonaws.AWSNetworkingRequest.operationName";
 
 static NSString* const AWSMobileURLSessionManagerCacheDomain = @"com.amazonaws.AWSURLSessionManager";
+static const NSUInteger AWSURLSessionManagerDefaultStreamingWindowSize = 1024 * 1024;
+// Bounds what a Content-Length can reserve before any byte arrived; larger bodies grow the buffer as they are received.
+static const NSUInteger AWSURLSessionManagerMaximumInitialResponseBufferCapacity = 4 * 1024 * 1024;
+static const NSUInteger AWSURLSessionFileSinkBufferSize = 1024 * 1024;
+static const NSUInteger AWSURLSessionFileSinkMaxBuffersInFlight = 4;
+
+#pragma mark - AWSURLSessionFileSink
+
+/**
+ Writes a downloaded body to disk without blocking the session delegate queue. Small network chunks
+ are coalesced into large buffers that are written with `pwrite` in order on a serial queue of the sink,
+ so concurrent downloads do not compete for threads of a shared queue. The data task is suspended while
+ too many buffers are waiting for the disk, which bounds the memory in flight.
+ */
+@interface AWSURLSessionFileSink : NSObject
+
+@property (nonatomic, readonly) NSError *error;
+
+- (instancetype)initWithFileURL:(NSURL *)fileURL
+                         append:(BOOL)append
+          expectedContentLength:(int64_t)expectedContentLength
+                          error:(NSError *__autoreleasing *)error;
+
+- (void)appendData:(NSData *)data
+          dataTask:(NSURLSessionDataTask *)dataTask;
+
+/**
+ Flushes the pending buffer and closes the file once every write has landed. The returned task always succeeds; check `error` afterwards.
+ */
+- (AWSTask *)finish;
+
+@end
+
+@implementation AWSURLSessionFileSink {
+    int _fileDescriptor;
+    off_t _offset;
+    NSMutableData *_buffer;
+    NSUInteger _buffersInFlight;
+    BOOL _isSuspended;
+    __weak NSURLSessionDataTask *_dataTask;
+    dispatch_queue_t _ioQueue;
+    dispatch_group_t _writeGroup;
+    NSError *_error;
+}
+
+- (instancetype)initWithFileURL:(NSURL *)fileURL
+                         append:(BOOL)append
+          expectedContentLength:(int64_t)expectedContentLength
+                          error:(NSError *__autoreleasing *)error {
+    if (self = [super init]) {
+        _fileDescriptor = open([fileURL fileSystemRepresentation], O_WRONLY | O_CREAT | (append ? 0 : O_TRUNC), 0644);
+        if (_fileDescriptor < 0) {
+            if (error) {
+                *error = [NSError errorWithDomain:NSPOSIXErrorDomain
+                                             code:errno
+                                         userInfo:@{NSFilePathErrorKey: fileURL.path ?: @""}];
+            }
+            return nil;
+        }
+        _offset = append ? lseek(_fileDescriptor, 0, SEEK_END) : 0;
+        _ioQueue = dispatch_queue_create("com.amazonaws.AWSURLSessionFileSink.ioQueue", DISPATCH_QUEUE_SERIAL);
+        _writeGroup = dispatch_group_create();
+
+#if defined(F_PREALLOCATE)
+        // Reserve the space up front so the file does not fragment as it grows. This is only a hint.
+        if (expectedContentLength > 0) {
+            fstore_t store = {F_ALLOCATECONTIG, F_PEOFPOSMODE, 0, expectedContentLength, 0};
+            if (fcntl(_fileDescriptor, F_PREALLOCATE, &store) == -1) {
+                store.fst_flags = F_ALLOCATEALL;
+                fcntl(_fileDescriptor, F_PREALLOCATE, &store);
+            }
+        }
+#endif
+    }
+
+    return self;
+}
+
+- (void)dealloc {
+    if (_fileDescriptor >= 0) {
+        close(_fileDescriptor);
+    }
+}
+
+- (NSError *)error {
+    @synchronized(self) {
+        return _error;
+    }
+}
+
+- (void)appendData:(NSData *)data
+          dataTask:(NSURLSessionDataTask *)dataTask {
+    _dataTask = dataTask;
+    if (self.error) {
+        return;
+    }
+
+    [data enumerateByteRangesUsingBlock:^(const void *bytes, NSRange byteRange, BOOL *stop) {
+        const uint8_t *source = bytes;
+        NSUInteger remaining = byteRange.length;
+        while (remaining > 0) {
+            if (!self->_buffer) {
+                self->_buffer = [NSMutableData dataWithCapacity:AWSURLSessionFileSinkBufferSize];
+            }
+            NSUInteger length = MIN(remaining, AWSURLSessionFileSinkBufferSize - [self->_buffer length]);
+            [self->_buffer appendBytes:source length:length];
+            source += length;
+            remaining -= length;
+
+            if ([self->_buffer length] == AWSURLSessionFileSinkBufferSize) {
+                [self flushBuffer];
+            }
+        }
+    }];
+}
+
+- (void)flushBuffer {
+    if ([_buffer length] == 0) {
+        return;
+    }
+
+    NSData *buffer = _buffer;
+    off_t offset = _offset;
+    _buffer = nil;
+    _offset += [buffer length];
+
+    @synchronized(self) {
+        _buffersInFlight++;
+        if (_buffersInFlight >= AWSURLSessionFileSinkMaxBuffersInFlight && !_isSuspended) {
+            _isSuspended = YES;
+            [_dataTask suspend];
+        }
+    }
+
+    dispatch_group_async(_writeGroup, _ioQueue, ^{
+        NSError *writeError = [self writeBuffer:buffer atOffset:offset];
+        @synchronized(self) {
+            if (writeError && !self->_error) {
+                AWSDDLogError(@"Error: [%@]", writeError);
+                self->_error = writeError;
+                [self->_dataTask cancel];
+            }
+            self->_buffersInFlight--;
+            if (self->_isSuspended && self->_buffersInFlight <= AWSURLSessionFileSinkMaxBuffersInFlight / 2) {
+                self->_isSuspended = NO;
+                [self->_dataTask resume];
+            }
+        }
+    });
+}
+
+- (NSError *)writeBuffer:(NSData *)buffer atOffset:(off_t)offset {
+    const uint8_t *bytes = [buffer bytes];
+    size_t remaining = [buffer length];
+    while (remaining > 0) {
+        ssize_t written = pwrite(_fileDescriptor, bytes, remaining, offset);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return [NSError errorWithDomain:NSPOSIXErrorDomain
+                                       code:errno
+                                   userInfo:@{NSLocalizedDescriptionKey: @"Failed to write data."}];
+        }
+        bytes += written;
+        offset += written;
+        remaining -= written;
+    }
+
+    return nil;
+}
+
+- (AWSTask *)finish {
+    [self flushBuffer];
+
+    AWSTaskCompletionSource *taskCompletionSource = [AWSTaskCompletionSource taskCompletionSource];
+    dispatch_group_notify(_writeGroup, _ioQueue, ^{
+        if (self->_fileDescriptor >= 0) {
+            close(self->_fileDescriptor);
+            self->_fileDescriptor = -1;
+        }
+        taskCompletionSource.result = nil;
+    });
+
+    return taskCompletionSource.task;
+}
+
+@end
+
+#pragma mark - AWSURLSessionManagerDelegate
 
 typedef NS_ENUM(NSInteger, AWSURLSessionTaskType) {
     AWSURLSessionTaskTypeUnknown,
@@ -45,15 +241,37 @@ typedef NS_ENUM(NSInteger, AWSURLSessionTaskType) {
 @property (nonatomic, assign) uint32_t currentRetryCount;
 @property (nonatomic, strong) NSError *error;
 @property (nonatomic, strong) id responseObject;
-@property (nonatomic, strong) NSMutableData *responseData;
-@property (nonatomic, strong) NSFileHandle *responseFilehandle;
+@property (nonatomic, strong) NSData *responseData;
+@property (nonatomic, strong) NSMutableData *responseBuffer;
+@property (nonatomic, strong) NSMutableArray<NSData *> *responseDataChunks;
+@property (nonatomic, assign) NSUInteger responseDataChunksLength;
+@property (nonatomic, strong) AWSURLSessionFileSink *responseFileSink;
 @property (nonatomic, strong) NSURL *tempDownloadedFileURL;
 @property (nonatomic, assign) BOOL shouldWriteDirectly;
 @property (nonatomic, assign) BOOL shouldWriteToFile;
+@property (nonatomic, assign) BOOL shouldStreamResponse;
+@property (nonatomic, strong) dispatch_queue_t streamingQueue;
+@property (nonatomic, assign) int64_t pendingStreamingBytes;
+@property (nonatomic, assign) BOOL isStreamingSuspended;
+
+/**
+ The admission of the current attempt by the request scheduler, handed back when the attempt ends.
+ */
+@property (nonatomic, strong) id schedulerTicket;
+
+/**
+ The number the wire logger gave the current attempt, or `0` when it is not logged.
+ */
+@property (nonatomic, assign) NSUInteger wireLogRequestNumber;
 
 @property (atomic, assign) int64_t lastTotalLengthOfChunkSignatureSent;
 @property (atomic, assign) int64_t payloadTotalBytesWritten;
 
+- (void)prepareResponseBufferWithExpectedContentLength:(int64_t)expectedContentLength;
+- (void)appendResponseData:(NSData *)data;
+- (void)flattenResponseData;
+- (void)resetResponseData;
+
 @end
 
 @implementation AWSURLSessionManagerDelegate
@@ -66,6 +284,50 @@ typedef NS_ENUM(NSInteger, AWSURLSessionTaskType) {
     return self;
 }
 
+- (void)prepareResponseBufferWithExpectedContentLength:(int64_t)expectedContentLength {
+    if (expectedContentLength > 0) {
+        self.responseBuffer = [NSMutableData dataWithCapacity:(NSUInteger)MIN(expectedContentLength, (int64_t)AWSURLSessionManagerMaximumInitialResponseBufferCapacity)];
+    }
+}
+
+- (void)appendResponseData:(NSData *)data {
+    if (self.responseBuffer) {
+        [self.responseBuffer appendData:data];
+        return;
+    }
+
+    // The length is unknown: keep the chunks as they are and copy them once when the body is needed.
+    if (!self.responseDataChunks) {
+        self.responseDataChunks = [NSMutableArray new];
+    }
+    [self.responseDataChunks addObject:data];
+    self.responseDataChunksLength += [data length];
+}
+
+- (void)flattenResponseData {
+    if (self.responseBuffer) {
+        self.responseData = self.responseBuffer;
+        self.responseBuffer = nil;
+    } else if ([self.responseDataChunks count] == 1) {
+        self.responseData = [self.responseDataChunks firstObject];
+    } else if ([self.responseDataChunks count] > 1) {
+        NSMutableData *responseData = [NSMutableData dataWithCapacity:self.responseDataChunksLength];
+        for (NSData *chunk in self.responseDataChunks) {
+            [responseData appendData:chunk];
+        }
+        self.responseData = responseData;
+    }
+    self.responseDataChunks = nil;
+    self.responseDataChunksLength = 0;
+}
+
+- (void)resetResponseData {
+    self.responseData = nil;
+    self.responseBuffer = nil;
+    self.responseDataChunks = nil;
+    self.responseDataChunksLength = 0;
+}
+
 @end
 
 #pragma mark - AWSNetworkingRequest
@@ -76,6 +338,37 @@ typedef NS_ENUM(NSInteger, AWSURLSessionTaskType) {
 
 @end
 
+#pragma mark - AWSNetworking
+
+@interface AWSNetworking()
+
++ (NSError *)deadlineExceededErrorWithUnderlyingError:(NSError *)underlyingError;
+
+@end
+
+#pragma mark - AWSNetworkingWireLogger
+
+@interface AWSNetworkingWireLogger()
+
+- (NSUInteger)logRequest:(NSURLRequest *)request;
+- (void)logResponse:(NSURLResponse *)response
+               data:(NSData *)data
+              error:(NSError *)error
+      requestNumber:(NSUInteger)requestNumber;
+
+@end
+
+#pragma mark - AWSNetworkingRequestScheduler
+
+@interface AWSNetworkingRequestScheduler()
+
+- (AWSTask *)admitRequest:(AWSNetworkingRequest *)request
+                     host:(NSString *)host
+                byteCount:(int64_t)byteCount;
+- (void)releaseTicket:(id)ticket;
+
+@end
+
 #pragma mark - AWSURLSessionManager
 
 //const int64_t AWSMinimumDownloadTaskSize = 1000000;
@@ -84,6 +377,9 @@ typedef NS_ENUM(NSInteger, AWSURLSessionTaskType) {
 
 @property (nonatomic, strong) NSURLSession *session;
 @property (nonatomic, strong) AWSSynchronizedMutableDictionary *sessionManagerDelegates;
+@property (nonatomic, strong) dispatch_queue_t retryQueue;
+// Receives this manager's session callbacks, so clients sharing a pooled session parse responses in parallel.
+@property (nonatomic, strong) dispatch_queue_t delegateQueue;
 @property (nonatomic) BOOL isSessionValid;
 
 @end
@@ -98,29 +394,19 @@ typedef NS_ENUM(NSInteger, AWSURLSessionTaskType) {
 }
 
 - (void)dealloc {
-    // Do nothing
+    // Hand the pooled session back if the owner never called `invalidate`.
+    [self invalidate];
 }
 
 - (instancetype)initWithConfiguration:(AWSNetworkingConfiguration *)configuration {
     if (self = [super init]) {
         _configuration = configuration;
 
-
-        NSURLSessionConfiguration *sessionConfiguration = [NSURLSessionConfiguration defaultSessionConfiguration];
-        sessionConfiguration.URLCache = nil;
-        if (configuration.timeoutIntervalForRequest > 0) {
-            sessionConfiguration.timeoutIntervalForRequest = configuration.timeoutIntervalForRequest;
-        }
-        if (configuration.timeoutIntervalForResource > 0) {
-            sessionConfiguration.timeoutIntervalForResource = configuration.timeoutIntervalForResource;
-        }
-        sessionConfiguration.allowsCellularAccess = configuration.allowsCellularAccess;
-        sessionConfiguration.sharedContainerIdentifier = configuration.sharedContainerIdentifier;
-        
-        _session = [NSURLSession sessionWithConfiguration:sessionConfiguration
-                                                 delegate:self
-                                            delegateQueue:nil];
+        // Clients with compatible configurations share one session and its connections.
+        _session = [[AWSURLSessionPool defaultSessionPool] acquireSessionWithConfiguration:configuration];
         _sessionManagerDelegates = [AWSSynchronizedMutableDictionary new];
+        _retryQueue = dispatch_queue_create("com.amazonaws.AWSURLSessionManager.retryQueue", DISPATCH_QUEUE_CONCURRENT);
+        _delegateQueue = dispatch_queue_create("com.amazonaws.AWSURLSessionManager.delegateQueue", DISPATCH_QUEUE_SERIAL);
         _isSessionValid = YES;
     }
 
@@ -129,6 +415,9 @@ typedef NS_ENUM(NSInteger, AWSURLSessionTaskType) {
 
 - (AWSTask *)dataTaskWithRequest:(AWSNetworkingRequest *)request {
     [request assignProperties:self.configuration];
+    if (!request.metrics) {
+        request.metrics = [AWSNetworkingRequestMetrics new];
+    }
 
     AWSURLSessionManagerDelegate *delegate = [AWSURLSessionManagerDelegate new];
     delegate.taskCompletionSource = [AWSTaskCompletionSource taskCompletionSource];
@@ -145,14 +434,21 @@ typedef NS_ENUM(NSInteger, AWSURLSessionTaskType) {
 
 - (void)taskWithDelegate:(AWSURLSessionManagerDelegate *)delegate {
     if (!self.session || !self.isSessionValid) {
-        delegate.taskCompletionSource.error = [NSError errorWithDomain:AWSNetworkingErrorDomain
-                                                                  code:AWSNetworkingErrorSessionInvalid
-                                                              userInfo:@{NSLocalizedDescriptionKey: @"URLSession is nil or invalidated"}];
+        NSError *error = [NSError errorWithDomain:AWSNetworkingErrorDomain
+                                             code:AWSNetworkingErrorSessionInvalid
+                                         userInfo:@{NSLocalizedDescriptionKey: @"URLSession is nil or invalidated"}];
+        [self finishMetricsWithDelegate:delegate
+                               response:nil
+                                  error:error];
+        delegate.taskCompletionSource.error = error;
         return;
     }
 
     if (delegate.downloadingFileURL) delegate.shouldWriteToFile = YES;
-    delegate.responseData = nil;
+    delegate.shouldStreamResponse = NO;
+    delegate.pendingStreamingBytes = 0;
+    delegate.isStreamingSuspended = NO;
+    [delegate resetResponseData];
     delegate.responseObject = nil;
     delegate.error = nil;
     NSMutableURLRequest *mutableRequest = [NSMutableURLRequest requestWithURL:delegate.request.URL];
@@ -160,32 +456,114 @@ typedef NS_ENUM(NSInteger, AWSURLSessionTaskType) {
 
     AWSNetworkingRequest *request = delegate.request;
     if (request.isCancelled) {
-        delegate.taskCompletionSource.error = [NSError errorWithDomain:AWSNetworkingErrorDomain
-                                                                  code:AWSNetworkingErrorCancelled
-                                                              userInfo:nil];
+        NSError *error = [NSError errorWithDomain:AWSNetworkingErrorDomain
+                                             code:AWSNetworkingErrorCancelled
+                                         userInfo:nil];
+        [self finishMetricsWithDelegate:delegate
+                               response:nil
+                                  error:error];
+        delegate.taskCompletionSource.error = error;
         return;
     }
 
     mutableRequest.HTTPMethod = [NSString aws_stringWithHTTPMethod:delegate.request.HTTPMethod];
 
     AWSTask *task = [AWSTask taskWithResult:nil];
+    AWSNetworkingRequestMetrics *metrics = request.metrics;
+
+    id retryHandler = request.retryHandler;
+    if ([retryHandler respondsToSelector:@selector(timeIntervalBeforeSendingRequest:)]) {
+        // Wait for the client-side rate limiter before signing so the request is not sent with a stale date.
+        NSTimeInterval timeIntervalToWait = [retryHandler timeIntervalBeforeSendingRequest:request];
+        if (request.deadline && [request.deadline timeIntervalSinceNow] <= timeIntervalToWait) {
+            NSError *error = [AWSNetworking deadlineExceededErrorWithUnderlyingError:nil];
+            [self finishMetricsWithDelegate:delegate
+                                   response:nil
+                                      error:error];
+            delegate.taskCompletionSource.error = error;
+            return;
+        }
+        if (timeIntervalToWait > 0) {
+            [metrics addDuration:timeIntervalToWait
+                        forPhase:AWSNetworkingRequestPhaseQueueWait];
+            task = [AWSTask taskWithDelay:(int)(timeIntervalToWait * 1000)];
+        }
+    }
 
     if (request.requestSerializer) {
-        task = [request.requestSerializer serializeRequest:mutableRequest
-                                                   headers:request.headers
-                                                parameters:request.parameters];
+        task = [task continueWithSuccessBlock:^id _Nullable(AWSTask * _Nonnull task) {
+            [metrics beginPhase:AWSNetworkingRequestPhaseRequestSerialization];
+            return [[request.requestSerializer serializeRequest:mutableRequest
+                                                        headers:request.headers
+                                                     parameters:request.parameters] continueWithBlock:^id _Nullable(AWSTask * _Nonnull task) {
+                [metrics endPhase:AWSNetworkingRequestPhaseRequestSerialization];
+                return task;
+            }];
+        }];
+    }
+
+    // Admitted once the body size is known and before signing, so a request that waited is not sent with a stale date.
+    AWSNetworkingRequestScheduler *requestScheduler = request.requestScheduler;
+    if (requestScheduler) {
+        task = [task continueWithSuccessBlock:^id _Nullable(AWSTask * _Nonnull task) {
+            NSTimeInterval admissionStartTime = [AWSNetworkingRequestMetrics currentTime];
+            return [[requestScheduler admitRequest:request
+                                              host:mutableRequest.URL.host
+                                         byteCount:[self bodyByteCountForRequest:mutableRequest]] continueWithSuccessBlock:^id _Nullable(AWSTask * _Nonnull task) {
+                @synchronized(delegate) {
+                    delegate.schedulerTicket = task.result;
+                }
+                [metrics addDuration:[AWSNetworkingRequestMetrics currentTime] - admissionStartTime
+                            forPhase:AWSNetworkingRequestPhaseQueueWait];
+                return nil;
+            }];
+        }];
     }
 
+    // The signer reports the time it waited for credentials; the rest of the interceptor chain counts as signing.
+    __block NSTimeInterval interceptorsStartTime = 0;
+    task = [task continueWithSuccessBlock:^id _Nullable(AWSTask * _Nonnull task) {
+        interceptorsStartTime = [AWSNetworkingRequestMetrics currentTime];
+        if (metrics.operationName) {
+            [NSURLProtocol setProperty:metrics.operationName
+                                forKey:AWSNetworkingRequestOperationNameKey
+                             inRequest:mutableRequest];
+        }
+        return nil;
+    }];
+
     for(id<AWSNetworkingRequestInterceptor>interceptor in request.requestInterceptors) {
         task = [task continueWithSuccessBlock:^id(AWSTask *task) {
             return [interceptor interceptRequest:mutableRequest];
         }];
     }
 
+    task = [task continueWithSuccessBlock:^id _Nullable(AWSTask * _Nonnull task) {
+        NSTimeInterval interceptorsDuration = [AWSNetworkingRequestMetrics currentTime] - interceptorsStartTime;
+        NSTimeInterval credentialRetrievalDuration = [[NSURLProtocol propertyForKey:AWSNetworkingRequestMetricsCredentialRetrievalDurationKey
+                                                                          inRequest:mutableRequest] doubleValue];
+        [NSURLProtocol removePropertyForKey:AWSNetworkingRequestMetricsCredentialRetrievalDurationKey
+                                  inRequest:mutableRequest];
+        [NSURLProtocol removePropertyForKey:AWSNetworkingRequestOperationNameKey
+                                  inRequest:mutableRequest];
+        [metrics addDuration:credentialRetrievalDuration
+                    forPhase:AWSNetworkingRequestPhaseCredentialRetrieval];
+        [metrics addDuration:interceptorsDuration - credentialRetrievalDuration
+                    forPhase:AWSNetworkingRequestPhaseSigning];
+        return nil;
+    }];
+
     [[[task continueWithSuccessBlock:^id _Nullable(AWSTask * _Nonnull task) {
         AWSNetworkingRequest *request = delegate.request;
         return [request.requestSerializer validateRequest:mutableRequest];
     }] continueWithSuccessBlock:^id _Nullable(AWSTask * _Nonnull task) {
+        // Serialization, admission and credential retrieval take time; a request cancelled meanwhile, e.g. by its deadline, is not sent.
+        if (delegate.request.isCancelled) {
+            return [AWSTask taskWithError:[NSError errorWithDomain:AWSNetworkingErrorDomain
+                                                              code:AWSNetworkingErrorCancelled
+                                                          userInfo:nil]];
+        }
+
         switch (delegate.taskType) {
             case AWSURLSessionTaskTypeData:
                 delegate.request.task = [self.session dataTaskWithRequest:mutableRequest];
@@ -203,10 +581,27 @@ typedef NS_ENUM(NSInteger, AWSURLSessionTaskType) {
                                                               userInfo:@{NSLocalizedDescriptionKey: @"URLSession is nil or invalidated."}]];
             }
 
+            // Checked right before resuming so a probe slot of a half-open circuit is only taken by an attempt that is really sent.
+            AWSNetworkingCircuitBreaker *circuitBreaker = self.configuration.circuitBreaker;
+            NSString *host = delegate.request.baseURL.host;
+            if (circuitBreaker && ![circuitBreaker allowAttemptForHost:host]) {
+                [delegate.request.task cancel];
+                return [AWSTask taskWithError:[NSError errorWithDomain:AWSNetworkingErrorDomain
+                                                                  code:AWSNetworkingErrorCircuitOpen
+                                                              userInfo:@{NSLocalizedDescriptionKey: [NSString stringWithFormat:@"The circuit for %@ is open.", host]}]];
+            }
+
             [self.sessionManagerDelegates setObject:delegate
                                              forKey:@(((NSURLSessionTask *)delegate.request.task).taskIdentifier)];
-
-            [self printHTTPHeadersAndBodyForRequest:delegate.request.task.originalRequest];
+            [[AWSURLSessionPool defaultSessionPool] setDelegate:self
+                                                        forTask:delegate.request.task
+                                                      inSession:self.session
+                                                  delegateQueue:self.delegateQueue];
+
+            AWSNetworkingWireLogger *wireLogger = self.configuration.wireLogger;
+            if (wireLogger) {
+                delegate.wireLogRequestNumber = [wireLogger logRequest:delegate.request.task.originalRequest];
+            }
 
             [delegate.request.task resume];
         } else {
@@ -220,6 +615,10 @@ typedef NS_ENUM(NSInteger, AWSURLSessionTaskType) {
     }] continueWithBlock:^id(AWSTask *task) {
         if (task.error) {
             NSError *error = task.error;
+            [self releaseSchedulerTicketWithDelegate:delegate];
+            [self finishMetricsWithDelegate:delegate
+                                   response:nil
+                                      error:error];
             delegate.taskCompletionSource.error = error;
         }
         return nil;
@@ -227,27 +626,34 @@ typedef NS_ENUM(NSInteger, AWSURLSessionTaskType) {
 }
 
 /**
- Invalidates the underlying NSURLSession to avoid memory leaks. Internally, calls
- `-[NSURLSession finishTasksAndInvalidate]` so that any in-process tasks are allowed
- to complete before invalidating.
-
- @warning Before calling this method, make sure no method is running on this manager.
+ Re-enters `taskWithDelegate:` once the retry back-off has elapsed. The wait is driven by a
+ dispatch timer on `retryQueue`, so no thread is parked while a request is backing off.
  */
-- (void)invalidate {
-    // Invalidate the session so its strong reference to self is released.
-    self.isSessionValid = NO;
-    [self.session finishTasksAndInvalidate];
+- (void)scheduleRetryWithDelegate:(AWSURLSessionManagerDelegate *)delegate
+                afterTimeInterval:(NSTimeInterval)timeInterval {
+    if (timeInterval <= 0) {
+        [self taskWithDelegate:delegate];
+        return;
+    }
+
+    dispatch_time_t retryTime = dispatch_time(DISPATCH_TIME_NOW, (int64_t)(timeInterval * NSEC_PER_SEC));
+    dispatch_after(retryTime, self.retryQueue, ^{
+        [self taskWithDelegate:delegate];
+    });
 }
 
-#pragma mark - NSURLSessionDelegate
+/**
+ Returns the underlying NSURLSession to the session pool. Any in-process tasks are allowed
+ to complete; the pool invalidates the session once no client has used it for a while.
 
-- (void)URLSession:(NSURLSession *)session didBecomeInvalidWithError:(NSError *)error {
-    if (session == self.session) {
-        // If the session became invalid because of a call to `invalidate`, this should already be set, but we'll
-        // set it defensively in case there are other paths to invalidation.
-        self.isSessionValid = NO;
-        self.session = nil;
+ @warning Before calling this method, make sure no method is running on this manager.
+ */
+- (void)invalidate {
+    if (!self.isSessionValid) {
+        return;
     }
+    self.isSessionValid = NO;
+    [[AWSURLSessionPool defaultSessionPool] releaseSession:self.session];
 }
 
 #pragma mark - NSURLSessionTaskDelegate
@@ -257,19 +663,52 @@ typedef NS_ENUM(NSInteger, AWSURLSessionTaskType) {
         AWSDDLogError(@"Session task failed with error: %@", error);
     }
 
-    [self printHTTPHeadersForResponse:sessionTask.response];
+    // A streamed or file-backed response completes only after the consumer or the disk has received every chunk.
+    AWSTask *streamingTask = [AWSTask taskWithResult:nil];
+    AWSURLSessionManagerDelegate *streamingDelegate = [self.sessionManagerDelegates objectForKey:@(sessionTask.taskIdentifier)];
+    if (streamingDelegate.responseFileSink) {
+        streamingTask = [streamingDelegate.responseFileSink finish];
+    } else if (streamingDelegate.shouldStreamResponse) {
+        AWSTaskCompletionSource *drainedTaskCompletionSource = [AWSTaskCompletionSource taskCompletionSource];
+        NSOutputStream *outputStream = streamingDelegate.request.responseOutputStream;
+        dispatch_async(streamingDelegate.streamingQueue, ^{
+            [outputStream close];
+            drainedTaskCompletionSource.result = nil;
+        });
+        streamingTask = drainedTaskCompletionSource.task;
+    }
 
-    [[[AWSTask taskWithResult:nil] continueWithSuccessBlock:^id(AWSTask *task) {
+    [[[streamingTask continueWithSuccessBlock:^id(AWSTask *task) {
         AWSURLSessionManagerDelegate *delegate = [self.sessionManagerDelegates objectForKey:@(sessionTask.taskIdentifier)];
 
-        if (delegate.responseFilehandle) {
-            [delegate.responseFilehandle closeFile];
+        if (delegate.responseFileSink) {
+            if (!delegate.error) {
+                delegate.error = delegate.responseFileSink.error;
+            }
+            delegate.responseFileSink = nil;
+        }
+
+        [delegate flattenResponseData];
+
+        if (delegate.wireLogRequestNumber > 0) {
+            [self.configuration.wireLogger logResponse:sessionTask.response
+                                                  data:delegate.responseData
+                                                 error:error
+                                         requestNumber:delegate.wireLogRequestNumber];
+            delegate.wireLogRequestNumber = 0;
         }
 
         if (!delegate.error) {
             delegate.error = error;
         }
 
+        // The body of a request cancelled while its last bytes arrived is not parsed.
+        if (!delegate.error && delegate.request.isCancelled) {
+            delegate.error = [NSError errorWithDomain:AWSNetworkingErrorDomain
+                                                 code:AWSNetworkingErrorCancelled
+                                             userInfo:nil];
+        }
+
         //delete temporary file if the task contains error (e.g. has been canceled)
         if (error && delegate.tempDownloadedFileURL) {
             [[NSFileManager defaultManager] removeItemAtPath:delegate.tempDownloadedFileURL.path error:nil];
@@ -302,11 +741,11 @@ typedef NS_ENUM(NSInteger, AWSURLSessionTaskType) {
                 } else {
                     if ([delegate.request.responseSerializer respondsToSelector:@selector(responseObjectForResponse:originalRequest:currentRequest:data:error:)]) {
                         NSError *error = nil;
-                        delegate.responseObject = [delegate.request.responseSerializer responseObjectForResponse:httpResponse
-                                                                                                 originalRequest:sessionTask.originalRequest
-                                                                                                  currentRequest:sessionTask.currentRequest
-                                                                                                            data:delegate.downloadingFileURL
-                                                                                                           error:&error];
+                        delegate.responseObject = [self responseObjectForResponse:httpResponse
+                                                                         delegate:delegate
+                                                                      sessionTask:sessionTask
+                                                                             data:delegate.downloadingFileURL
+                                                                            error:&error];
                         if (error) {
                             delegate.error = error;
                         }
@@ -319,11 +758,11 @@ typedef NS_ENUM(NSInteger, AWSURLSessionTaskType) {
                 // need to call responseSerializer if there is no client-side error.
                 if ([delegate.request.responseSerializer respondsToSelector:@selector(responseObjectForResponse:originalRequest:currentRequest:data:error:)]) {
                     NSError *error = nil;
-                    delegate.responseObject = [delegate.request.responseSerializer responseObjectForResponse:httpResponse
-                                                                                             originalRequest:sessionTask.originalRequest
-                                                                                              currentRequest:sessionTask.currentRequest
-                                                                                                        data:delegate.responseData
-                                                                                                       error:&error];
+                    delegate.responseObject = [self responseObjectForResponse:httpResponse
+                                                                     delegate:delegate
+                                                                  sessionTask:sessionTask
+                                                                         data:delegate.responseData
+                                                                        error:&error];
                     if (error) {
                         if ([delegate.responseObject isKindOfClass:[NSDictionary class]]) {
                             NSDictionary *responseObject = (NSDictionary *)delegate.responseObject;
@@ -348,14 +787,38 @@ typedef NS_ENUM(NSInteger, AWSURLSessionTaskType) {
             }
         }
 
+        // Handed back before a retry is scheduled, which waits for admission again.
+        [self releaseSchedulerTicketWithDelegate:delegate];
+
+        [self.configuration.circuitBreaker recordAttemptForHost:delegate.request.baseURL.host
+                                                       response:(NSHTTPURLResponse *)sessionTask.response
+                                                          error:error];
+
+        if ([delegate.request.retryHandler respondsToSelector:@selector(didCompleteRequest:response:error:)]) {
+            [delegate.request.retryHandler didCompleteRequest:delegate.request
+                                                     response:(NSHTTPURLResponse *)sessionTask.response
+                                                        error:delegate.error];
+        }
+
+        // Chunks of a streamed response have already been consumed, so it cannot be transparently retried.
         if (delegate.error
             && ([sessionTask.response isKindOfClass:[NSHTTPURLResponse class]] || sessionTask.response == nil)
-            && delegate.request.retryHandler) {
+            && delegate.request.retryHandler
+            && !delegate.shouldStreamResponse
+            && !delegate.request.isCancelled) {
             AWSNetworkingRetryType retryType = [delegate.request.retryHandler shouldRetry:delegate.currentRetryCount
                                                                           originalRequest:delegate.request
                                                                                  response:(NSHTTPURLResponse *)sessionTask.response
                                                                                      data:delegate.responseData
                                                                                     error:delegate.error];
+            if (retryType != AWSNetworkingRetryTypeShouldNotRetry
+                && [delegate.request.retryHandler respondsToSelector:@selector(acquireRetryQuotaForRequest:response:error:)]
+                && ![delegate.request.retryHandler acquireRetryQuotaForRequest:delegate.request
+                                                                      response:(NSHTTPURLResponse *)sessionTask.response
+                                                                         error:delegate.error]) {
+                AWSDDLogDebug(@"Retry quota for %@ is exhausted. The request will not be retried.", delegate.request.baseURL.host);
+                retryType = AWSNetworkingRetryTypeShouldNotRetry;
+            }
             switch (retryType) {
                 case AWSNetworkingRetryTypeShouldCorrectClockSkewAndRetry: {
                     //Correct Clock Skew
@@ -392,17 +855,30 @@ typedef NS_ENUM(NSInteger, AWSURLSessionTaskType) {
                 }
                     // Keep going to the next 'case' statement.
                 case AWSNetworkingRetryTypeShouldRetry: {
-                    NSTimeInterval timeIntervalToSleep = [delegate.request.retryHandler timeIntervalForRetry:delegate.currentRetryCount
-                                                                                                    response:(NSHTTPURLResponse *)sessionTask.response
-                                                                                                        data:delegate.responseData
-                                                                                                       error:delegate.error];
-                    [NSThread sleepForTimeInterval:timeIntervalToSleep];
+                    NSTimeInterval timeIntervalToWait = [delegate.request.retryHandler timeIntervalForRetry:delegate.currentRetryCount
+                                                                                                   response:(NSHTTPURLResponse *)sessionTask.response
+                                                                                                       data:delegate.responseData
+                                                                                                      error:delegate.error];
+                    NSDate *deadline = delegate.request.deadline;
+                    if (deadline && [deadline timeIntervalSinceNow] <= timeIntervalToWait) {
+                        AWSDDLogDebug(@"The retry of %@ would start after the deadline of the request. It will not be retried.", delegate.request.URL);
+                        NSError *error = [AWSNetworking deadlineExceededErrorWithUnderlyingError:delegate.error];
+                        [self finishMetricsWithDelegate:delegate
+                                               response:sessionTask.response
+                                                  error:error];
+                        delegate.taskCompletionSource.error = error;
+                        break;
+                    }
                     delegate.currentRetryCount++;
-                    [self taskWithDelegate:delegate];
+                    [self scheduleRetryWithDelegate:delegate
+                                  afterTimeInterval:timeIntervalToWait];
                 }
                     break;
 
                 case AWSNetworkingRetryTypeShouldNotRetry: {
+                    [self finishMetricsWithDelegate:delegate
+                                           response:sessionTask.response
+                                              error:delegate.error];
                     if (delegate.error) {
                         NSError *error = delegate.error;
                         delegate.taskCompletionSource.error = error;
@@ -425,6 +901,9 @@ typedef NS_ENUM(NSInteger, AWSURLSessionTaskType) {
                 [retryHandler setValue:@NO forKey:@"isClockSkewRetried"];
             }
 
+            [self finishMetricsWithDelegate:delegate
+                                   response:sessionTask.response
+                                      error:delegate.error];
             if (delegate.error) {
                 NSError *error = delegate.error;
                 delegate.taskCompletionSource.error = error;
@@ -464,6 +943,11 @@ typedef NS_ENUM(NSInteger, AWSURLSessionTaskType) {
     }
 }
 
+- (void)URLSession:(NSURLSession *)session task:(NSURLSessionTask *)task didFinishCollectingMetrics:(NSURLSessionTaskMetrics *)metrics {
+    AWSURLSessionManagerDelegate *delegate = [self.sessionManagerDelegates objectForKey:@(task.taskIdentifier)];
+    [delegate.request.metrics recordTaskMetrics:metrics];
+}
+
 #pragma mark - NSURLSessionDataDelegate
 
 - (void)URLSession:(NSURLSession *)session dataTask:(NSURLSessionDataTask *)dataTask didReceiveResponse:(NSURLResponse *)response
@@ -480,6 +964,28 @@ typedef NS_ENUM(NSInteger, AWSURLSessionTaskType) {
             // got error status code, avoid write data to disk
             delegate.shouldWriteToFile = NO;
         }
+
+        // Only the body of a successful response is streamed; error bodies are still parsed by the response serializer.
+        if (!delegate.shouldWriteToFile
+            && (delegate.request.responseDataHandler || delegate.request.responseOutputStream)
+            && httpResponse.statusCode >= 200 && httpResponse.statusCode < 300) {
+            delegate.shouldStreamResponse = YES;
+            if (!delegate.streamingQueue) {
+                delegate.streamingQueue = dispatch_queue_create("com.amazonaws.AWSURLSessionManager.streamingQueue", DISPATCH_QUEUE_SERIAL);
+            }
+            NSOutputStream *outputStream = delegate.request.responseOutputStream;
+            if (outputStream) {
+                dispatch_async(delegate.streamingQueue, ^{
+                    if (outputStream.streamStatus == NSStreamStatusNotOpen) {
+                        [outputStream open];
+                    }
+                });
+            }
+        }
+    }
+
+    if (!delegate.shouldWriteToFile && !delegate.shouldStreamResponse) {
+        [delegate prepareResponseBufferWithExpectedContentLength:response.expectedContentLength];
     }
     
     @try {
@@ -493,11 +999,14 @@ typedef NS_ENUM(NSInteger, AWSURLSessionTaskType) {
                 NSError *error = nil;
                 if ([[NSFileManager defaultManager] fileExistsAtPath:delegate.downloadingFileURL.path]) {
                     AWSDDLogDebug(@"target file already exists, will be appended at the file path: %@",delegate.downloadingFileURL);
-                    delegate.responseFilehandle = [NSFileHandle fileHandleForUpdatingURL:delegate.downloadingFileURL error:&error];
+                    delegate.responseFileSink = [[AWSURLSessionFileSink alloc] initWithFileURL:delegate.downloadingFileURL
+                                                                                        append:YES
+                                                                         expectedContentLength:response.expectedContentLength
+                                                                                         error:&error];
                     if (error) {
                         AWSDDLogError(@"Error: [%@]", error);
+                        delegate.error = error;
                     }
-                    [delegate.responseFilehandle seekToEndOfFile];
 
                 } else {
                     //Create the file
@@ -505,9 +1014,13 @@ typedef NS_ENUM(NSInteger, AWSURLSessionTaskType) {
                         AWSDDLogError(@"Error: Can not create file with file path:%@",delegate.downloadingFileURL.path);
                     }
                     error = nil;
-                    delegate.responseFilehandle = [NSFileHandle fileHandleForWritingToURL:delegate.downloadingFileURL error:&error];
+                    delegate.responseFileSink = [[AWSURLSessionFileSink alloc] initWithFileURL:delegate.downloadingFileURL
+                                                                                        append:NO
+                                                                         expectedContentLength:response.expectedContentLength
+                                                                                         error:&error];
                     if (error) {
                         AWSDDLogError(@"Error: [%@]", error);
+                        delegate.error = error;
                     }
                 }
 
@@ -536,9 +1049,13 @@ typedef NS_ENUM(NSInteger, AWSURLSessionTaskType) {
                     AWSDDLogError(@"Error: Can not create file with file path:%@",delegate.tempDownloadedFileURL.path);
                 }
                 error = nil;
-                delegate.responseFilehandle = [NSFileHandle fileHandleForWritingToURL:delegate.tempDownloadedFileURL error:&error];
+                delegate.responseFileSink = [[AWSURLSessionFileSink alloc] initWithFileURL:delegate.tempDownloadedFileURL
+                                                                                    append:NO
+                                                                     expectedContentLength:response.expectedContentLength
+                                                                                     error:&error];
                 if (error) {
                     AWSDDLogError(@"Error: [%@]", error);
+                    delegate.error = error;
                 }
             }
         }
@@ -551,6 +1068,12 @@ typedef NS_ENUM(NSInteger, AWSURLSessionTaskType) {
         AWSDDLogError(@"Error: [%@]", exception);
         delegate.error = [NSError errorWithDomain:AWSNetworkingErrorDomain code:AWSNetworkingErrorUnknown userInfo: userInfo];
     }
+
+    // The body has nowhere to go without a file, so the task fails with the reason instead of buffering it in memory.
+    if (delegate.shouldWriteToFile && !delegate.responseFileSink) {
+        completionHandler(NSURLSessionResponseCancel);
+        return;
+    }
     completionHandler(NSURLSessionResponseAllow);
 }
 
@@ -558,25 +1081,15 @@ typedef NS_ENUM(NSInteger, AWSURLSessionTaskType) {
 - (void)URLSession:(NSURLSession *)session dataTask:(NSURLSessionDataTask *)dataTask didReceiveData:(NSData *)data {
     AWSURLSessionManagerDelegate *delegate = [self.sessionManagerDelegates objectForKey:@(dataTask.taskIdentifier)];
     
-    if (delegate.responseFilehandle) {
-        @try{
-            [delegate.responseFilehandle writeData:data];
-        }
-        @catch (NSException *exception) {
-            NSString *desc = [NSString stringWithFormat:@"Failed to write data: %@", exception];
-            NSDictionary *userInfo = @{
-                                       NSLocalizedDescriptionKey:  desc
-                                       };
-            AWSDDLogError(@"Error: [%@]", exception);
-            delegate.error = [NSError errorWithDomain:AWSNetworkingErrorDomain code:AWSNetworkingErrorUnknown userInfo: userInfo];
-            [dataTask cancel];
-        }
+    if (delegate.shouldWriteToFile) {
+        [delegate.responseFileSink appendData:data
+                                     dataTask:dataTask];
+    } else if (delegate.shouldStreamResponse) {
+        [self streamData:data
+                delegate:delegate
+                dataTask:dataTask];
     } else {
-        if (!delegate.responseData) {
-            delegate.responseData = [NSMutableData dataWithData:data];
-        } else if ([delegate.responseData isKindOfClass:[NSMutableData class]]) {
-            [delegate.responseData appendData:data];
-        }
+        [delegate appendResponseData:data];
     }
     
     AWSNetworkingDownloadProgressBlock downloadProgress = delegate.request.downloadProgress;
@@ -602,39 +1115,136 @@ typedef NS_ENUM(NSInteger, AWSURLSessionTaskType) {
 
 #pragma mark - Helper methods
 
-- (void)printHTTPHeadersAndBodyForRequest:(NSURLRequest *)request {
- //   AWSDDLogDebug(@"Request headers:\n%@", request.allHTTPHeaderFields);
-    if([AWSDDLog sharedInstance].logLevel & AWSDDLogFlagDebug){
-        if(request.HTTPBody) {
-            NSMutableString *bodyString = [[NSMutableString alloc] initWithData:request.HTTPBody
-                                                                       encoding:NSUTF8StringEncoding];
-            
-            if ([request.URL.absoluteString containsString:@"cognito-idp."]) {
-                NSError *error = nil;
-                NSRegularExpression *regex = [NSRegularExpression regularExpressionWithPattern:@"(Password)\":\".*?\""
-                                                                                       options:NSRegularExpressionCaseInsensitive
-                                                                                         error:&error];
-                [regex replaceMatchesInString:bodyString
-                                      options:0
-                                        range:NSMakeRange(0, bodyString.length)
-                                 withTemplate:@"$1\":\"[redacted]\""];
+/**
+ Runs the response serializer, splitting its time between parsing and the model mapping the serializer reports through `+[AWSNetworkingRequestMetrics currentMetrics]`.
+ */
+- (id)responseObjectForResponse:(NSHTTPURLResponse *)response
+                       delegate:(AWSURLSessionManagerDelegate *)delegate
+                    sessionTask:(NSURLSessionTask *)sessionTask
+                           data:(id)data
+                          error:(NSError *__autoreleasing *)error {
+    AWSNetworkingRequestMetrics *metrics = delegate.request.metrics;
+    NSTimeInterval modelMappingDuration = [metrics durationForPhase:AWSNetworkingRequestPhaseModelMapping];
+    NSTimeInterval startTime = [AWSNetworkingRequestMetrics currentTime];
+
+    [AWSNetworkingRequestMetrics setCurrentMetrics:metrics];
+    id responseObject = [delegate.request.responseSerializer responseObjectForResponse:response
+                                                                       originalRequest:sessionTask.originalRequest
+                                                                        currentRequest:sessionTask.currentRequest
+                                                                                  data:data
+                                                                                 error:error];
+    [AWSNetworkingRequestMetrics setCurrentMetrics:nil];
+
+    NSTimeInterval serializationDuration = [AWSNetworkingRequestMetrics currentTime] - startTime;
+    modelMappingDuration = [metrics durationForPhase:AWSNetworkingRequestPhaseModelMapping] - modelMappingDuration;
+    [metrics addDuration:serializationDuration - modelMappingDuration
+                forPhase:AWSNetworkingRequestPhaseResponseParsing];
+
+    return responseObject;
+}
+
+- (int64_t)bodyByteCountForRequest:(NSURLRequest *)request {
+    if (request.HTTPBody) {
+        return [request.HTTPBody length];
+    }
+
+    return [[request valueForHTTPHeaderField:@"Content-Length"] longLongValue];
+}
+
+- (void)releaseSchedulerTicketWithDelegate:(AWSURLSessionManagerDelegate *)delegate {
+    id schedulerTicket = nil;
+    @synchronized(delegate) {
+        schedulerTicket = delegate.schedulerTicket;
+        delegate.schedulerTicket = nil;
+    }
+    if (schedulerTicket) {
+        [delegate.request.requestScheduler releaseTicket:schedulerTicket];
+    }
+}
+
+- (void)finishMetricsWithDelegate:(AWSURLSessionManagerDelegate *)delegate
+                         response:(NSURLResponse *)response
+                            error:(NSError *)error {
+    NSInteger statusCode = 0;
+    if ([response isKindOfClass:[NSHTTPURLResponse class]]) {
+        statusCode = ((NSHTTPURLResponse *)response).statusCode;
+    }
+    [delegate.request.metrics finishWithStatusCode:statusCode
+                                        retryCount:delegate.currentRetryCount
+                                             error:error];
+}
+
+/**
+ Hands a chunk of a streamed response to the request's consumer on the delegate's streaming queue.
+ The task is suspended while more than `responseStreamingWindowSize` bytes wait for the consumer,
+ which bounds the memory held for a slow consumer.
+ */
+- (void)streamData:(NSData *)data
+          delegate:(AWSURLSessionManagerDelegate *)delegate
+          dataTask:(NSURLSessionDataTask *)dataTask {
+    NSUInteger windowSize = delegate.request.responseStreamingWindowSize ?: AWSURLSessionManagerDefaultStreamingWindowSize;
+
+    @synchronized(delegate) {
+        delegate.pendingStreamingBytes += [data length];
+        if (delegate.pendingStreamingBytes > windowSize && !delegate.isStreamingSuspended) {
+            delegate.isStreamingSuspended = YES;
+            [dataTask suspend];
+        }
+    }
+
+    dispatch_async(delegate.streamingQueue, ^{
+        if (!delegate.error) {
+            NSError *error = nil;
+            AWSNetworkingResponseDataBlock responseDataHandler = delegate.request.responseDataHandler;
+            if (responseDataHandler) {
+                responseDataHandler(data);
             }
-            
-            if (bodyString.length <= 100 * 1024) {
-                AWSDDLogDebug(@"Request body:\n%@", bodyString);
-            } else {
-                AWSDDLogDebug(@"Request body (Partial data. The first 100KB is displayed.):\n%@", [bodyString substringWithRange:NSMakeRange(0, 100 * 1024)]);
+
+            NSOutputStream *outputStream = delegate.request.responseOutputStream;
+            if (outputStream && ![self writeData:data toStream:outputStream error:&error]) {
+                AWSDDLogError(@"Error: [%@]", error);
+                delegate.error = error;
+                [dataTask cancel];
             }
         }
-    }
+
+        @synchronized(delegate) {
+            delegate.pendingStreamingBytes -= [data length];
+            if (delegate.isStreamingSuspended && delegate.pendingStreamingBytes <= windowSize / 2) {
+                delegate.isStreamingSuspended = NO;
+                [dataTask resume];
+            }
+        }
+    });
 }
 
-- (void)printHTTPHeadersForResponse:(NSURLResponse *)response {
-    if([AWSDDLog sharedInstance].logLevel & AWSDDLogFlagDebug){
-        if ([response isKindOfClass:[NSHTTPURLResponse class]]) {
-  //          AWSDDLogDebug(@"Response headers:\n%@", ((NSHTTPURLResponse *)response).allHeaderFields);
+- (BOOL)writeData:(NSData *)data
+         toStream:(NSOutputStream *)outputStream
+            error:(NSError *__autoreleasing *)error {
+    __block BOOL succeeded = YES;
+    // Walk the byte ranges so a discontiguous chunk is not flattened into a copy first.
+    [data enumerateByteRangesUsingBlock:^(const void *bytes, NSRange byteRange, BOOL *stop) {
+        const uint8_t *buffer = bytes;
+        NSUInteger remaining = byteRange.length;
+        while (remaining > 0) {
+            NSInteger written = [outputStream write:buffer maxLength:remaining];
+            if (written <= 0) {
+                succeeded = NO;
+                *stop = YES;
+                return;
+            }
+            buffer += written;
+            remaining -= written;
         }
+    }];
+
+    if (!succeeded && error) {
+        *error = outputStream.streamError ?: [NSError errorWithDomain:AWSNetworkingErrorDomain
+                                                                 code:AWSNetworkingErrorUnknown
+                                                             userInfo:@{NSLocalizedDescriptionKey: @"Failed to write the response data to the output stream."}];
     }
+
+    return succeeded;
 }
 
 @end
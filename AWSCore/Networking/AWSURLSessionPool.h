@@ -0,0 +1,110 @@
+//
+// Copyright 2010-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+@class AWSNetworkingConfiguration;
+
+/**
+ A point-in-time snapshot of the state of an `AWSURLSessionPool`.
+ */
+@interface AWSURLSessionPoolStatistics : NSObject
+
+/**
+ The number of sessions in the pool, including idle ones.
+ */
+@property (nonatomic, assign, readonly) NSUInteger sessionCount;
+
+/**
+ The number of sessions that no client is using and that are kept warm until `idleTimeout` elapses.
+ */
+@property (nonatomic, assign, readonly) NSUInteger idleSessionCount;
+
+/**
+ The number of clients currently holding a session.
+ */
+@property (nonatomic, assign, readonly) NSUInteger clientCount;
+
+/**
+ The number of tasks currently running on pooled sessions.
+ */
+@property (nonatomic, assign, readonly) NSUInteger activeTaskCount;
+
+/**
+ The number of sessions created since the pool was created.
+ */
+@property (nonatomic, assign, readonly) NSUInteger sessionsCreated;
+
+/**
+ The number of times a client was handed an existing session instead of a new one.
+ */
+@property (nonatomic, assign, readonly) NSUInteger sessionsReused;
+
+/**
+ The number of tasks started on pooled sessions since the pool was created.
+ */
+@property (nonatomic, assign, readonly) NSUInteger tasksStarted;
+
+@end
+
+/**
+ Shares `NSURLSession` objects, and with them their connection pools and TLS sessions, between service clients whose networking configurations are compatible.
+
+ Session delegate callbacks are routed to the object registered for each task with `setDelegate:forTask:inSession:delegateQueue:`,
+ on the queue registered with it, so clients sharing a session do not wait on each other's callbacks.
+ */
+@interface AWSURLSessionPool : NSObject
+
+/**
+ The maximum number of simultaneous connections per host for sessions created after this is set. `0` uses the system default.
+ */
+@property (nonatomic, assign) NSInteger maximumConnectionsPerHost;
+
+/**
+ How long a session nobody uses is kept, with its connections, before it is invalidated. The default value is 60 seconds.
+ */
+@property (nonatomic, assign) NSTimeInterval idleTimeout;
+
+/**
+ Returns the pool used by all `AWSURLSessionManager` instances.
+ */
++ (instancetype)defaultSessionPool;
+
+/**
+ Returns a session compatible with `configuration`, creating one if needed. Every call must be balanced with `releaseSession:`.
+ */
+- (NSURLSession *)acquireSessionWithConfiguration:(AWSNetworkingConfiguration *)configuration;
+
+/**
+ Gives back a session obtained from `acquireSessionWithConfiguration:`. Running tasks are allowed to complete.
+ */
+- (void)releaseSession:(NSURLSession *)session;
+
+/**
+ Routes the delegate callbacks of `task` to `delegate` on `delegateQueue` until the task completes. The callbacks of a task
+ arrive in order when `delegateQueue` is serial. Must be called before the task is resumed.
+ */
+- (void)setDelegate:(id<NSURLSessionDataDelegate>)delegate
+            forTask:(NSURLSessionTask *)task
+          inSession:(NSURLSession *)session
+      delegateQueue:(dispatch_queue_t)delegateQueue;
+
+- (AWSURLSessionPoolStatistics *)statistics;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,353 @@
+//
+// Copyright 2010-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import "AWSURLSessionPool.h"
+#import "AWSNetworking.h"
+#import "AWSCocoaLumberjack.h"
+
+static const NSTimeInterval AWSURLSessionPoolDefaultIdleTimeout = 60.0;
+
+#pragma mark - AWSURLSessionPoolStatistics
+
+@interface AWSURLSessionPoolStatistics()
+
+@property (nonatomic, assign) NSUInteger sessionCount;
+@property (nonatomic, assign) NSUInteger idleSessionCount;
+@property (nonatomic, assign) NSUInteger clientCount;
+@property (nonatomic, assign) NSUInteger activeTaskCount;
+@property (nonatomic, assign) NSUInteger sessionsCreated;
+@property (nonatomic, assign) NSUInteger sessionsReused;
+@property (nonatomic, assign) NSUInteger tasksStarted;
+
+@end
+
+@implementation AWSURLSessionPoolStatistics
+
+- (NSString *)description {
+    return [NSString stringWithFormat:@"<%@: sessions=%lu idle=%lu clients=%lu activeTasks=%lu created=%lu reused=%lu tasksStarted=%lu>",
+            NSStringFromClass([self class]),
+            (unsigned long)self.sessionCount,
+            (unsigned long)self.idleSessionCount,
+            (unsigned long)self.clientCount,
+            (unsigned long)self.activeTaskCount,
+            (unsigned long)self.sessionsCreated,
+            (unsigned long)self.sessionsReused,
+            (unsigned long)self.tasksStarted];
+}
+
+@end
+
+#pragma mark - AWSURLSessionPoolTaskRoute
+
+@interface AWSURLSessionPoolTaskRoute : NSObject
+
+@property (nonatomic, strong) id<NSURLSessionDataDelegate> delegate;
+@property (nonatomic, strong) dispatch_queue_t delegateQueue;
+
+@end
+
+@implementation AWSURLSessionPoolTaskRoute
+
+@end
+
+#pragma mark - AWSURLSessionPoolEntry
+
+/**
+ Owns one pooled session and acts as its delegate, forwarding every task callback to the delegate
+ registered for that task on the delegate's own queue. The session's queue only routes, so one
+ client parsing a response does not hold up the callbacks of the others.
+ */
+@interface AWSURLSessionPoolEntry : NSObject <NSURLSessionDataDelegate>
+
+@property (nonatomic, strong) NSString *key;
+@property (nonatomic, strong) NSURLSession *session;
+@property (nonatomic, assign) NSUInteger clientCount;
+@property (nonatomic, assign) NSUInteger idleGeneration;
+@property (nonatomic, strong) NSMutableDictionary<NSNumber *, AWSURLSessionPoolTaskRoute *> *taskRoutes;
+@property (nonatomic, weak) AWSURLSessionPool *pool;
+
+- (AWSURLSessionPoolTaskRoute *)routeForTask:(NSURLSessionTask *)task;
+- (NSUInteger)activeTaskCount;
+
+@end
+
+@interface AWSURLSessionPool()
+
+@property (nonatomic, strong) NSMutableDictionary<NSString *, AWSURLSessionPoolEntry *> *entries;
+@property (nonatomic, assign) NSUInteger sessionsCreated;
+@property (nonatomic, assign) NSUInteger sessionsReused;
+@property (nonatomic, assign) NSUInteger tasksStarted;
+
+- (void)entryDidBecomeInvalid:(AWSURLSessionPoolEntry *)entry;
+
+@end
+
+@implementation AWSURLSessionPoolEntry
+
+- (instancetype)init {
+    if (self = [super init]) {
+        _taskRoutes = [NSMutableDictionary new];
+    }
+
+    return self;
+}
+
+- (void)setDelegate:(id<NSURLSessionDataDelegate>)delegate
+            forTask:(NSURLSessionTask *)task
+      delegateQueue:(dispatch_queue_t)delegateQueue {
+    AWSURLSessionPoolTaskRoute *route = [AWSURLSessionPoolTaskRoute new];
+    route.delegate = delegate;
+    route.delegateQueue = delegateQueue;
+    @synchronized(self) {
+        self.taskRoutes[@(task.taskIdentifier)] = route;
+    }
+}
+
+- (AWSURLSessionPoolTaskRoute *)routeForTask:(NSURLSessionTask *)task {
+    @synchronized(self) {
+        return self.taskRoutes[@(task.taskIdentifier)];
+    }
+}
+
+- (void)removeRouteForTask:(NSURLSessionTask *)task {
+    @synchronized(self) {
+        [self.taskRoutes removeObjectForKey:@(task.taskIdentifier)];
+    }
+}
+
+- (NSUInteger)activeTaskCount {
+    @synchronized(self) {
+        return [self.taskRoutes count];
+    }
+}
+
+#pragma mark - NSURLSessionDelegate
+
+- (void)URLSession:(NSURLSession *)session didBecomeInvalidWithError:(NSError *)error {
+    [self.pool entryDidBecomeInvalid:self];
+}
+
+#pragma mark - NSURLSessionTaskDelegate
+
+- (void)URLSession:(NSURLSession *)session task:(NSURLSessionTask *)task didCompleteWithError:(NSError *)error {
+    AWSURLSessionPoolTaskRoute *route = [self routeForTask:task];
+    [self removeRouteForTask:task];
+    id<NSURLSessionDataDelegate> delegate = route.delegate;
+    if ([delegate respondsToSelector:@selector(URLSession:task:didCompleteWithError:)]) {
+        dispatch_async(route.delegateQueue, ^{
+            [delegate URLSession:session task:task didCompleteWithError:error];
+        });
+    }
+}
+
+- (void)URLSession:(NSURLSession *)session task:(NSURLSessionTask *)task didSendBodyData:(int64_t)bytesSent totalBytesSent:(int64_t)totalBytesSent totalBytesExpectedToSend:(int64_t)totalBytesExpectedToSend {
+    AWSURLSessionPoolTaskRoute *route = [self routeForTask:task];
+    id<NSURLSessionDataDelegate> delegate = route.delegate;
+    if ([delegate respondsToSelector:@selector(URLSession:task:didSendBodyData:totalBytesSent:totalBytesExpectedToSend:)]) {
+        dispatch_async(route.delegateQueue, ^{
+            [delegate URLSession:session task:task didSendBodyData:bytesSent totalBytesSent:totalBytesSent totalBytesExpectedToSend:totalBytesExpectedToSend];
+        });
+    }
+}
+
+- (void)URLSession:(NSURLSession *)session task:(NSURLSessionTask *)task didFinishCollectingMetrics:(NSURLSessionTaskMetrics *)metrics {
+    AWSURLSessionPoolTaskRoute *route = [self routeForTask:task];
+    id<NSURLSessionDataDelegate> delegate = route.delegate;
+    if ([delegate respondsToSelector:@selector(URLSession:task:didFinishCollectingMetrics:)]) {
+        dispatch_async(route.delegateQueue, ^{
+            [delegate URLSession:session task:task didFinishCollectingMetrics:metrics];
+        });
+    }
+}
+
+#pragma mark - NSURLSessionDataDelegate
+
+- (void)URLSession:(NSURLSession *)session dataTask:(NSURLSessionDataTask *)dataTask didReceiveResponse:(NSURLResponse *)response
+ completionHandler:(void (^)(NSURLSessionResponseDisposition disposition))completionHandler {
+    AWSURLSessionPoolTaskRoute *route = [self routeForTask:dataTask];
+    id<NSURLSessionDataDelegate> delegate = route.delegate;
+    if ([delegate respondsToSelector:@selector(URLSession:dataTask:didReceiveResponse:completionHandler:)]) {
+        dispatch_async(route.delegateQueue, ^{
+            [delegate URLSession:session dataTask:dataTask didReceiveResponse:response completionHandler:completionHandler];
+        });
+    } else {
+        completionHandler(NSURLSessionResponseAllow);
+    }
+}
+
+- (void)URLSession:(NSURLSession *)session dataTask:(NSURLSessionDataTask *)dataTask didReceiveData:(NSData *)data {
+    AWSURLSessionPoolTaskRoute *route = [self routeForTask:dataTask];
+    id<NSURLSessionDataDelegate> delegate = route.delegate;
+    if ([delegate respondsToSelector:@selector(URLSession:dataTask:didReceiveData:)]) {
+        dispatch_async(route.delegateQueue, ^{
+            [delegate URLSession:session dataTask:dataTask didReceiveData:data];
+        });
+    }
+}
+
+@end
+
+#pragma mark - AWSURLSessionPool
+
+@implementation AWSURLSessionPool
+
++ (instancetype)defaultSessionPool {
+    static AWSURLSessionPool *_defaultSessionPool = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        _defaultSessionPool = [AWSURLSessionPool new];
+    });
+
+    return _defaultSessionPool;
+}
+
+- (instancetype)init {
+    if (self = [super init]) {
+        _entries = [NSMutableDictionary new];
+        _idleTimeout = AWSURLSessionPoolDefaultIdleTimeout;
+    }
+
+    return self;
+}
+
+- (NSString *)keyForConfiguration:(AWSNetworkingConfiguration *)configuration {
+    return [NSString stringWithFormat:@"%f|%f|%d|%@|%ld",
+            configuration.timeoutIntervalForRequest,
+            configuration.timeoutIntervalForResource,
+            configuration.allowsCellularAccess,
+            configuration.sharedContainerIdentifier ?: @"",
+            (long)self.maximumConnectionsPerHost];
+}
+
+- (NSURLSession *)acquireSessionWithConfiguration:(AWSNetworkingConfiguration *)configuration {
+    NSString *key = [self keyForConfiguration:configuration];
+
+    @synchronized(self) {
+        AWSURLSessionPoolEntry *entry = self.entries[key];
+        if (entry) {
+            entry.clientCount++;
+            self.sessionsReused++;
+            return entry.session;
+        }
+
+        NSURLSessionConfiguration *sessionConfiguration = [NSURLSessionConfiguration defaultSessionConfiguration];
+        sessionConfiguration.URLCache = nil;
+        if (configuration.timeoutIntervalForRequest > 0) {
+            sessionConfiguration.timeoutIntervalForRequest = configuration.timeoutIntervalForRequest;
+        }
+        if (configuration.timeoutIntervalForResource > 0) {
+            sessionConfiguration.timeoutIntervalForResource = configuration.timeoutIntervalForResource;
+        }
+        sessionConfiguration.allowsCellularAccess = configuration.allowsCellularAccess;
+        sessionConfiguration.sharedContainerIdentifier = configuration.sharedContainerIdentifier;
+        if (self.maximumConnectionsPerHost > 0) {
+            sessionConfiguration.HTTPMaximumConnectionsPerHost = self.maximumConnectionsPerHost;
+        }
+
+        entry = [AWSURLSessionPoolEntry new];
+        entry.key = key;
+        entry.pool = self;
+        entry.clientCount = 1;
+        entry.session = [NSURLSession sessionWithConfiguration:sessionConfiguration
+                                                      delegate:entry
+                                                 delegateQueue:nil];
+        self.entries[key] = entry;
+        self.sessionsCreated++;
+
+        return entry.session;
+    }
+}
+
+- (void)releaseSession:(NSURLSession *)session {
+    @synchronized(self) {
+        AWSURLSessionPoolEntry *entry = [self entryForSession:session];
+        if (!entry || entry.clientCount == 0) {
+            return;
+        }
+
+        entry.clientCount--;
+        if (entry.clientCount > 0) {
+            return;
+        }
+
+        // Keep the session and its warm connections around in case another client shows up soon.
+        NSUInteger idleGeneration = ++entry.idleGeneration;
+        dispatch_time_t idleTime = dispatch_time(DISPATCH_TIME_NOW, (int64_t)(self.idleTimeout * NSEC_PER_SEC));
+        dispatch_after(idleTime, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_LOW, 0), ^{
+            @synchronized(self) {
+                if (entry.clientCount == 0 && entry.idleGeneration == idleGeneration
+                    && self.entries[entry.key] == entry) {
+                    AWSDDLogDebug(@"Invalidating idle pooled URLSession.");
+                    [self.entries removeObjectForKey:entry.key];
+                    [entry.session finishTasksAndInvalidate];
+                }
+            }
+        });
+    }
+}
+
+- (void)setDelegate:(id<NSURLSessionDataDelegate>)delegate
+            forTask:(NSURLSessionTask *)task
+          inSession:(NSURLSession *)session
+      delegateQueue:(dispatch_queue_t)delegateQueue {
+    AWSURLSessionPoolEntry *entry = nil;
+    @synchronized(self) {
+        entry = [self entryForSession:session];
+        self.tasksStarted++;
+    }
+    [entry setDelegate:delegate forTask:task delegateQueue:delegateQueue];
+}
+
+- (AWSURLSessionPoolStatistics *)statistics {
+    AWSURLSessionPoolStatistics *statistics = [AWSURLSessionPoolStatistics new];
+    @synchronized(self) {
+        for (AWSURLSessionPoolEntry *entry in [self.entries allValues]) {
+            statistics.sessionCount++;
+            if (entry.clientCount == 0) {
+                statistics.idleSessionCount++;
+            }
+            statistics.clientCount += entry.clientCount;
+            statistics.activeTaskCount += [entry activeTaskCount];
+        }
+        statistics.sessionsCreated = self.sessionsCreated;
+        statistics.sessionsReused = self.sessionsReused;
+        statistics.tasksStarted = self.tasksStarted;
+    }
+
+    return statistics;
+}
+
+#pragma mark - Helpers
+
+// Must be called while synchronized on self.
+- (AWSURLSessionPoolEntry *)entryForSession:(NSURLSession *)session {
+    for (AWSURLSessionPoolEntry *entry in [self.entries allValues]) {
+        if (entry.session == session) {
+            return entry;
+        }
+    }
+
+    return nil;
+}
+
+- (void)entryDidBecomeInvalid:(AWSURLSessionPoolEntry *)entry {
+    @synchronized(self) {
+        if (self.entries[entry.key] == entry) {
+            [self.entries removeObjectForKey:entry.key];
+        }
+    }
+}
+
+@end
@@ -16,6 +16,7 @@
 #import "AWSSTSService.h"
 #import "AWSCategory.h"
 #import "AWSNetworking.h"
+#import "AWSNetworkingMetrics.h"
 #import "AWSSignature.h"
 #import "AWSService.h"
 #import "AWSURLRequestSerialization.h"
@@ -90,9 +91,12 @@ static NSDictionary *errorCodeDictionary = nil;
 
     if (!*error && [responseObject isKindOfClass:[NSDictionary class]]) {
         if (self.outputClass) {
+            AWSNetworkingRequestMetrics *metrics = [AWSNetworkingRequestMetrics currentMetrics];
+            [metrics beginPhase:AWSNetworkingRequestPhaseModelMapping];
             responseObject = [AWSMTLJSONAdapter modelOfClass:self.outputClass
                                           fromJSONDictionary:responseObject
                                                        error:error];
+            [metrics endPhase:AWSNetworkingRequestPhaseModelMapping];
         }
     }
 
@@ -228,7 +232,8 @@ static AWSSynchronizedMutableDictionary *_serviceClients = nil;
         _configuration.requestInterceptors = @[baseInterceptor, signer];
 
         _configuration.baseURL = _configuration.endpoint.URL;
-        _configuration.retryHandler = [[AWSSTSRequestRetryHandler alloc] initWithMaximumRetryCount:_configuration.maxRetryCount];
+        _configuration.retryHandler = [[AWSSTSRequestRetryHandler alloc] initWithMaximumRetryCount:_configuration.maxRetryCount
+                                                                                         retryMode:_configuration.retryMode];
          
 		
         _networking = [[AWSNetworking alloc] initWithConfiguration:_configuration];
@@ -250,18 +255,28 @@ static AWSSynchronizedMutableDictionary *_serviceClients = nil;
         }
 
         AWSNetworkingRequest *networkingRequest = request.internalRequest;
+        networkingRequest.metrics = [[AWSNetworkingRequestMetrics alloc] initWithServiceName:self.configuration.endpoint.serviceName
+                                                                               operationName:operationName];
         if (request) {
+            [networkingRequest.metrics beginPhase:AWSNetworkingRequestPhaseModelSerialization];
             networkingRequest.parameters = [[AWSMTLJSONAdapter JSONDictionaryFromModel:request] aws_removeNullValues];
+            [networkingRequest.metrics endPhase:AWSNetworkingRequestPhaseModelSerialization];
         } else {
             networkingRequest.parameters = @{};
         }
 
         networkingRequest.HTTPMethod = HTTPMethod;
-        networkingRequest.requestSerializer = [[AWSQueryStringRequestSerializer alloc] initWithJSONDefinition:[[AWSSTSResources sharedInstance] JSONObject]
-                                                                                                   actionName:operationName];
-        networkingRequest.responseSerializer = [[AWSSTSResponseSerializer alloc] initWithJSONDefinition:[[AWSSTSResources sharedInstance] JSONObject]
-                                                                                             actionName:operationName
-                                                                                            outputClass:outputClass];
+        networkingRequest.requestSerializer = [self requestSerializerForOperationName:operationName
+                                                                           usingBlock:^id<AWSURLRequestSerializer> {
+            return [[AWSQueryStringRequestSerializer alloc] initWithJSONDefinition:[[AWSSTSResources sharedInstance] JSONObject]
+                                                                        actionName:operationName];
+        }];
+        networkingRequest.responseSerializer = [self responseSerializerForOperationName:operationName
+                                                                             usingBlock:^id<AWSHTTPURLResponseSerializer> {
+            return [[AWSSTSResponseSerializer alloc] initWithJSONDefinition:[[AWSSTSResources sharedInstance] JSONObject]
+                                                                 actionName:operationName
+                                                                outputClass:outputClass];
+        }];
         
         return [self.networking sendRequest:networkingRequest];
     }
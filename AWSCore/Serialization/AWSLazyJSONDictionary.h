@@ -0,0 +1,39 @@
+//
+// Copyright 2010-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ An immutable dictionary backed by the text of a JSON object, for the service definitions of the `*Resources` classes.
+
+ Creating it only scans the text for the offsets of the top-level values and of the values of the objects they
+ contain, such as each operation and each shape. A value is parsed the first time it is looked up and the same object
+ is returned after that, so a client parses only the operations it calls and the shapes they use. Enumerating the
+ dictionary parses every value.
+ */
+@interface AWSLazyJSONDictionary : NSDictionary
+
+/**
+ Reads the string in place when it is a constant ASCII string, as the definition strings of the `*Resources` classes
+ are, and copies it otherwise. Returns `nil` if the string is not a JSON object.
+ */
+- (nullable instancetype)initWithJSONString:(NSString *)JSONString
+                                      error:(NSError *__autoreleasing *)error;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,269 @@
+//
+// Copyright 2010-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import "AWSLazyJSONDictionary.h"
+#import "AWSSerialization.h"
+
+// The root is at depth 0. The objects it contains are indexed as well; the values inside them are parsed whole.
+static const NSUInteger AWSLazyJSONDictionaryMaximumIndexedDepth = 1;
+
+#pragma mark - Scanning
+
+static NSUInteger AWSLazyJSONSkipWhitespace(const char *bytes, NSUInteger index, NSUInteger end) {
+    while (index < end
+           && (bytes[index] == ' ' || bytes[index] == '\n' || bytes[index] == '\r' || bytes[index] == '\t')) {
+        index++;
+    }
+    return index;
+}
+
+// `index` is at the opening quote. Returns the index after the closing quote, or `NSNotFound`.
+static NSUInteger AWSLazyJSONStringEnd(const char *bytes, NSUInteger index, NSUInteger end) {
+    for (index++; index < end; index++) {
+        if (bytes[index] == '\\') {
+            index++;
+        } else if (bytes[index] == '"') {
+            return index + 1;
+        }
+    }
+    return NSNotFound;
+}
+
+// Returns the index after the value that starts at `index`, or `NSNotFound`.
+static NSUInteger AWSLazyJSONValueEnd(const char *bytes, NSUInteger index, NSUInteger end) {
+    if (index >= end) {
+        return NSNotFound;
+    }
+
+    if (bytes[index] == '"') {
+        return AWSLazyJSONStringEnd(bytes, index, end);
+    }
+
+    if (bytes[index] == '{' || bytes[index] == '[') {
+        NSUInteger level = 0;
+        while (index < end) {
+            char c = bytes[index];
+            if (c == '"') {
+                index = AWSLazyJSONStringEnd(bytes, index, end);
+                if (index == NSNotFound) {
+                    return NSNotFound;
+                }
+                continue;
+            }
+            if (c == '{' || c == '[') {
+                level++;
+            } else if (c == '}' || c == ']') {
+                level--;
+                if (level == 0) {
+                    return index + 1;
+                }
+            }
+            index++;
+        }
+        return NSNotFound;
+    }
+
+    NSUInteger start = index;
+    while (index < end
+           && bytes[index] != ',' && bytes[index] != '}' && bytes[index] != ']'
+           && bytes[index] != ' ' && bytes[index] != '\n' && bytes[index] != '\r' && bytes[index] != '\t') {
+        index++;
+    }
+    return index > start ? index : NSNotFound;
+}
+
+#pragma mark - AWSLazyJSONDictionary
+
+@interface AWSLazyJSONDictionary()
+
+// Owns the bytes `data` points to when they are read in place.
+@property (nonatomic, strong) id storage;
+@property (nonatomic, strong) NSData *data;
+@property (nonatomic, assign) NSUInteger depth;
+@property (nonatomic, strong) NSDictionary<NSString *, NSValue *> *valueRanges;
+@property (nonatomic, strong) NSMutableDictionary<NSString *, id> *values;
+// Lookups of parsed values run concurrently; values are added as barriers.
+@property (nonatomic, strong) dispatch_queue_t dispatchQueue;
+
+@end
+
+@implementation AWSLazyJSONDictionary
+
+- (instancetype)initWithJSONString:(NSString *)JSONString
+                             error:(NSError *__autoreleasing *)error {
+    NSData *data = nil;
+    const char *bytes = CFStringGetCStringPtr((__bridge CFStringRef)JSONString, kCFStringEncodingASCII);
+    if (bytes) {
+        data = [NSData dataWithBytesNoCopy:(void *)bytes
+                                    length:[JSONString length]
+                              freeWhenDone:NO];
+    } else {
+        data = [JSONString dataUsingEncoding:NSUTF8StringEncoding];
+    }
+
+    return [self initWithStorage:JSONString
+                            data:data
+                           range:NSMakeRange(0, [data length])
+                           depth:0
+                           error:error];
+}
+
+- (instancetype)initWithStorage:(id)storage
+                           data:(NSData *)data
+                          range:(NSRange)range
+                          depth:(NSUInteger)depth
+                          error:(NSError *__autoreleasing *)error {
+    if (self = [super init]) {
+        _storage = storage;
+        _data = data;
+        _depth = depth;
+        _values = [NSMutableDictionary new];
+        _dispatchQueue = dispatch_queue_create("com.amazonaws.AWSLazyJSONDictionary", DISPATCH_QUEUE_CONCURRENT);
+        _valueRanges = [self valueRangesInRange:range];
+        if (!_valueRanges) {
+            if (error) {
+                *error = [NSError errorWithDomain:AWSJSONParserErrorDomain
+                                             code:AWSJSONParserInvalidParameter
+                                         userInfo:@{NSLocalizedDescriptionKey : @"The service definition is not a JSON object."}];
+            }
+            return nil;
+        }
+    }
+
+    return self;
+}
+
+- (NSDictionary<NSString *, NSValue *> *)valueRangesInRange:(NSRange)range {
+    const char *bytes = [self.data bytes];
+    NSUInteger end = NSMaxRange(range);
+    NSMutableDictionary<NSString *, NSValue *> *valueRanges = [NSMutableDictionary new];
+
+    NSUInteger index = AWSLazyJSONSkipWhitespace(bytes, range.location, end);
+    if (index >= end || bytes[index] != '{') {
+        return nil;
+    }
+    index = AWSLazyJSONSkipWhitespace(bytes, index + 1, end);
+    if (index < end && bytes[index] == '}') {
+        return valueRanges;
+    }
+
+    while (index < end && bytes[index] == '"') {
+        NSUInteger keyEnd = AWSLazyJSONStringEnd(bytes, index, end);
+        if (keyEnd == NSNotFound) {
+            return nil;
+        }
+        NSString *key = [self keyWithBytes:bytes + index
+                                    length:keyEnd - index];
+
+        index = AWSLazyJSONSkipWhitespace(bytes, keyEnd, end);
+        if (!key || index >= end || bytes[index] != ':') {
+            return nil;
+        }
+        index = AWSLazyJSONSkipWhitespace(bytes, index + 1, end);
+        NSUInteger valueEnd = AWSLazyJSONValueEnd(bytes, index, end);
+        if (valueEnd == NSNotFound) {
+            return nil;
+        }
+        [valueRanges setObject:[NSValue valueWithRange:NSMakeRange(index, valueEnd - index)]
+                        forKey:key];
+
+        index = AWSLazyJSONSkipWhitespace(bytes, valueEnd, end);
+        if (index < end && bytes[index] == '}') {
+            return valueRanges;
+        }
+        if (index >= end || bytes[index] != ',') {
+            return nil;
+        }
+        index = AWSLazyJSONSkipWhitespace(bytes, index + 1, end);
+    }
+
+    return nil;
+}
+
+// `bytes` include the quotes.
+- (NSString *)keyWithBytes:(const char *)bytes
+                    length:(NSUInteger)length {
+    if (memchr(bytes, '\\', length)) {
+        return [NSJSONSerialization JSONObjectWithData:[NSData dataWithBytes:bytes length:length]
+                                               options:NSJSONReadingAllowFragments
+                                                 error:nil];
+    }
+    return [[NSString alloc] initWithBytes:bytes + 1
+                                    length:length - 2
+                                  encoding:NSUTF8StringEncoding];
+}
+
+- (NSUInteger)count {
+    return [self.valueRanges count];
+}
+
+- (id)objectForKey:(id)aKey {
+    NSValue *valueRange = [self.valueRanges objectForKey:aKey];
+    if (!valueRange) {
+        return nil;
+    }
+
+    __block id value = nil;
+    dispatch_sync(self.dispatchQueue, ^{
+        value = [self.values objectForKey:aKey];
+    });
+    if (value) {
+        return value;
+    }
+
+    NSRange range = [valueRange rangeValue];
+    const char *bytes = [self.data bytes];
+    if (self.depth < AWSLazyJSONDictionaryMaximumIndexedDepth && bytes[range.location] == '{') {
+        value = [[AWSLazyJSONDictionary alloc] initWithStorage:self.storage
+                                                          data:self.data
+                                                         range:range
+                                                         depth:self.depth + 1
+                                                         error:nil];
+    } else {
+        NSData *valueData = [NSData dataWithBytesNoCopy:(void *)(bytes + range.location)
+                                                 length:range.length
+                                           freeWhenDone:NO];
+        value = [NSJSONSerialization JSONObjectWithData:valueData
+                                                options:NSJSONReadingAllowFragments
+                                                  error:nil];
+    }
+    if (!value) {
+        return nil;
+    }
+
+    // Another thread may have parsed the same value meanwhile. Its copy is kept, so that every lookup returns the
+    // same object and the caches keyed by the identity of the definition's dictionaries stay valid.
+    dispatch_barrier_sync(self.dispatchQueue, ^{
+        id existingValue = [self.values objectForKey:aKey];
+        if (existingValue) {
+            value = existingValue;
+        } else {
+            [self.values setObject:value
+                            forKey:aKey];
+        }
+    });
+
+    return value;
+}
+
+- (NSEnumerator *)keyEnumerator {
+    return [self.valueRanges keyEnumerator];
+}
+
+- (id)copyWithZone:(NSZone *)zone {
+    return self;
+}
+
+@end
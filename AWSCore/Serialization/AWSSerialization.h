@@ -104,6 +104,26 @@ typedef NS_ENUM(NSInteger, AWSJSONParserErrorType) {
 
 @end
 
+/**
+ The shapes of a service definition compiled into an immutable graph of `AWSJSONDictionary`s. Each `shape` reference
+ and `metadata` entry is resolved once when the graph is built, so looking up a member list, a location name or a
+ flattened flag is a single dictionary lookup that allocates nothing.
+ */
+@interface AWSJSONShapeIndex : NSObject
+
+/**
+ Returns the index of the `shapes` of a service definition. An index is kept as long as the `shapes` it is built from,
+ which for the `*Resources` singletons is the life of the process.
+ */
++ (instancetype)shapeIndexForDefinitionRule:(NSDictionary *)rule;
+
+/**
+ Returns the compiled rules of an operation's `input` or `output`, compiling them on first use.
+ */
+- (AWSJSONDictionary *)rulesForDictionary:(NSDictionary *)dictionary;
+
+@end
+
 @interface AWSXMLBuilder : NSObject
 
 + (NSData *)xmlDataForDictionary:(NSDictionary *)params
@@ -122,6 +142,9 @@ typedef NS_ENUM(NSInteger, AWSJSONParserErrorType) {
 
 + (AWSXMLParser *)sharedInstance;
 
+/**
+ Can be called from several threads at once. Each call parses with its own state.
+ */
 - (NSMutableDictionary *)dictionaryForXMLData:(NSData *)data
                                    actionName:(NSString *)actionName
                         serviceDefinitionRule:(NSDictionary *)serviceDefinitionRule
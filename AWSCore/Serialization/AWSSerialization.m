@@ -13,10 +13,10 @@
 // permissions and limitations under the License.
 //
 #import "AWSSerialization.h"
+#import <objc/runtime.h>
 #import "AWSXMLWriter.h"
 #import "AWSCategory.h"
 #import "AWSCocoaLumberjack.h"
-#import "AWSXMLDictionary.h"
 
 NSString *const AWSXMLBuilderErrorDomain = @"com.amazonaws.AWSXMLBuilderErrorDomain";
 NSString *const AWSXMLParserErrorDomain = @"com.amazonaws.AWSXMLParserErrorDomain";
@@ -24,6 +24,10 @@ NSString *const AWSQueryParamBuilderErrorDomain = @"com.amazonaws.AWSQueryParamB
 NSString *const AWSEC2ParamBuilderErrorDomain = @"com.amazonaws.AWSEC2ParamBuilderErrorDomain";
 NSString *const AWSJSONBuilderErrorDomain = @"com.amazonaws.AWSJSONBuilderErrorDomain";
 NSString *const AWSJSONParserErrorDomain = @"com.amazonaws.AWSJSONParserErrorDomain";
+
+static const NSUInteger AWSJSONBuilderInitialCapacity = 1024;
+static void *AWSJSONShapeIndexKey = &AWSJSONShapeIndexKey;
+
 @interface AWSJSONDictionary()
 
 @property (nonatomic, strong) NSDictionary *embeddedDictionary;
@@ -92,6 +96,153 @@ NSString *const AWSJSONParserErrorDomain = @"com.amazonaws.AWSJSONParserErrorDom
 
 @end
 
+#pragma mark - AWSJSONShapeIndex
+
+/**
+ An `AWSJSONDictionary` whose lookups were resolved when its index was built. It enumerates its own keys, as the
+ dictionary it was compiled from does.
+ */
+@interface AWSJSONCompiledDictionary : AWSJSONDictionary {
+    NSDictionary *_resolvedDictionary;
+}
+
+@end
+
+@implementation AWSJSONCompiledDictionary
+
+- (void)setResolvedDictionary:(NSDictionary *)resolvedDictionary {
+    _resolvedDictionary = [resolvedDictionary copy];
+}
+
+- (id)objectForKey:(id)aKey {
+    return [_resolvedDictionary objectForKey:aKey];
+}
+
+@end
+
+@interface AWSJSONShapeIndex()
+
+// Weak, because the definition owns its index.
+@property (nonatomic, weak) NSDictionary *shapes;
+// Keyed by the identity of the definition's dictionaries; hashing them by value would walk their contents.
+@property (nonatomic, strong) NSMapTable<NSDictionary *, AWSJSONCompiledDictionary *> *compiledDictionaries;
+// Lookups run concurrently; compiling runs as a barrier.
+@property (nonatomic, strong) dispatch_queue_t dispatchQueue;
+
+@end
+
+@implementation AWSJSONShapeIndex
+
++ (instancetype)shapeIndexForDefinitionRule:(NSDictionary *)rule {
+    static dispatch_queue_t _shapeIndexesQueue = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        _shapeIndexesQueue = dispatch_queue_create("com.amazonaws.AWSJSONShapeIndex", DISPATCH_QUEUE_CONCURRENT);
+    });
+
+    if (![rule isKindOfClass:[NSDictionary class]]) {
+        rule = @{};
+    }
+    // Attached to the definition rather than kept in a table, so an index is released with the definition it was built
+    // from.
+    __block AWSJSONShapeIndex *shapeIndex = nil;
+    dispatch_sync(_shapeIndexesQueue, ^{
+        shapeIndex = objc_getAssociatedObject(rule, AWSJSONShapeIndexKey);
+    });
+    if (!shapeIndex) {
+        dispatch_barrier_sync(_shapeIndexesQueue, ^{
+            shapeIndex = objc_getAssociatedObject(rule, AWSJSONShapeIndexKey);
+            if (!shapeIndex) {
+                shapeIndex = [[AWSJSONShapeIndex alloc] initWithShapes:rule];
+                objc_setAssociatedObject(rule, AWSJSONShapeIndexKey, shapeIndex, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+            }
+        });
+    }
+    return shapeIndex;
+}
+
+- (instancetype)initWithShapes:(NSDictionary *)shapes {
+    if (self = [super init]) {
+        _shapes = shapes;
+        _compiledDictionaries = [[NSMapTable alloc] initWithKeyOptions:NSPointerFunctionsStrongMemory | NSPointerFunctionsObjectPointerPersonality
+                                                          valueOptions:NSPointerFunctionsStrongMemory
+                                                              capacity:0];
+        _dispatchQueue = dispatch_queue_create("com.amazonaws.AWSJSONShapeIndex.compiledDictionaries", DISPATCH_QUEUE_CONCURRENT);
+    }
+
+    return self;
+}
+
+- (AWSJSONDictionary *)rulesForDictionary:(NSDictionary *)dictionary {
+    if (![dictionary isKindOfClass:[NSDictionary class]]) {
+        dictionary = @{};
+    }
+    // The graph is published only once it is complete, so lookups in it need no lock.
+    __block AWSJSONCompiledDictionary *compiledDictionary = nil;
+    dispatch_sync(self.dispatchQueue, ^{
+        compiledDictionary = [self.compiledDictionaries objectForKey:dictionary];
+    });
+    if (!compiledDictionary) {
+        NSDictionary *shapes = self.shapes;
+        dispatch_barrier_sync(self.dispatchQueue, ^{
+            compiledDictionary = [self compiledDictionaryForDictionary:dictionary
+                                                                shapes:shapes];
+        });
+    }
+    return compiledDictionary;
+}
+
+- (AWSJSONCompiledDictionary *)compiledDictionaryForDictionary:(NSDictionary *)dictionary
+                                                       shapes:(NSDictionary *)shapes {
+    AWSJSONCompiledDictionary *compiledDictionary = [self.compiledDictionaries objectForKey:dictionary];
+    if (compiledDictionary) {
+        return compiledDictionary;
+    }
+
+    // Registered before its values are compiled, so that recursive shapes point back to it. Its lookups are resolved
+    // below, so it needs no reference to the shapes.
+    compiledDictionary = [[AWSJSONCompiledDictionary alloc] initWithDictionary:dictionary
+                                                            JSONDefinitionRule:nil];
+    [self.compiledDictionaries setObject:compiledDictionary
+                                  forKey:dictionary];
+
+    // Merged in the reverse of the order in which -[AWSJSONDictionary objectForKey:] looks them up.
+    NSMutableDictionary *resolvedDictionary = [NSMutableDictionary new];
+    NSString *shapeName = [dictionary objectForKey:@"shape"];
+    if ([shapeName isKindOfClass:[NSString class]] && shapeName.length != 0) {
+        NSDictionary *shape = [shapes objectForKey:shapeName];
+        if ([shape isKindOfClass:[NSDictionary class]]) {
+            [self addEntriesFromDictionary:[shape objectForKey:@"metadata"]
+                              toDictionary:resolvedDictionary];
+            [resolvedDictionary addEntriesFromDictionary:shape];
+        }
+    }
+    [self addEntriesFromDictionary:[dictionary objectForKey:@"metadata"]
+                      toDictionary:resolvedDictionary];
+    [resolvedDictionary addEntriesFromDictionary:dictionary];
+
+    for (id key in [resolvedDictionary allKeys]) {
+        id value = [resolvedDictionary objectForKey:key];
+        if ([value isKindOfClass:[NSDictionary class]]) {
+            [resolvedDictionary setObject:[self compiledDictionaryForDictionary:value
+                                                                        shapes:shapes]
+                                   forKey:key];
+        }
+    }
+    [compiledDictionary setResolvedDictionary:resolvedDictionary];
+
+    return compiledDictionary;
+}
+
+- (void)addEntriesFromDictionary:(id)entries
+                    toDictionary:(NSMutableDictionary *)dictionary {
+    if ([entries isKindOfClass:[NSDictionary class]]) {
+        [dictionary addEntriesFromDictionary:entries];
+    }
+}
+
+@end
+
 @implementation AWSXMLBuilder
 
 + (BOOL)failWithCode:(NSInteger)code description:(NSString *)description error:(NSError *__autoreleasing *)error {
@@ -136,7 +287,7 @@ NSString *const AWSJSONParserErrorDomain = @"com.amazonaws.AWSJSONParserErrorDom
 
 
     AWSXMLWriter* xmlWriter = [[AWSXMLWriter alloc]init];
-    AWSJSONDictionary *rules = [[AWSJSONDictionary alloc] initWithDictionary:actionRule JSONDefinitionRule:definitionRules];
+    AWSJSONDictionary *rules = [[AWSJSONShapeIndex shapeIndexForDefinitionRule:definitionRules] rulesForDictionary:actionRule];
 
     NSString *xmlElementName = rules[@"locationName"];
     if (xmlElementName) {
@@ -358,9 +509,538 @@ NSString *const AWSJSONParserErrorDomain = @"com.amazonaws.AWSJSONParserErrorDom
 
 @end
 
-@interface AWSXMLParser ()
+#pragma mark - AWSXMLParser
+
+@interface AWSXMLParser()
+
++ (id)valueForText:(NSString *)text rules:(NSDictionary *)rules error:(NSError *__autoreleasing *)error;
+
+@end
+
+typedef NS_ENUM(NSInteger, AWSXMLDecoderFrameType) {
+    AWSXMLDecoderFrameTypeStructure,
+    AWSXMLDecoderFrameTypeList,
+    AWSXMLDecoderFrameTypeMap,
+    AWSXMLDecoderFrameTypeMapEntry,
+    AWSXMLDecoderFrameTypeScalar,
+    AWSXMLDecoderFrameTypeUntyped, // Error responses, which have no shape.
+};
+
+/**
+ An element being decoded. Frames are reused from one element to the next at the same depth.
+ */
+@interface AWSXMLDecoderFrame : NSObject
+
+@property (nonatomic, assign) AWSXMLDecoderFrameType type;
+// The members of a structure, or the rules of any other type.
+@property (nonatomic, strong) NSDictionary *rules;
+// The container being filled, or the key and the value of a map entry.
+@property (nonatomic, strong) id value;
+@property (nonatomic, strong) NSString *text;
+@property (nonatomic, assign) BOOL hasChildElements;
+// Where the value goes when the element ends: set for `targetKey`, or appended to an array when it is `nil`.
+@property (nonatomic, strong) id target;
+@property (nonatomic, strong) NSString *targetKey;
+
+- (void)appendText:(NSString *)text;
+
+@end
+
+@interface AWSXMLDecoderFrame()
+
+// Set once the text arrives in more than one piece, as it does around entities.
+@property (nonatomic, strong) NSMutableString *mutableText;
+
+@end
+
+@implementation AWSXMLDecoderFrame
+
+- (void)setText:(NSString *)text {
+    _text = text;
+    _mutableText = nil;
+}
+
+- (void)appendText:(NSString *)text {
+    if (self.mutableText) {
+        [self.mutableText appendString:text];
+    } else if (self.text) {
+        NSMutableString *mutableText = [self.text mutableCopy];
+        [mutableText appendString:text];
+        self.text = mutableText;
+        self.mutableText = mutableText;
+    } else {
+        self.text = text;
+    }
+}
+
+@end
+
+/**
+ Decodes a rest-xml or query response in a single pass of `NSXMLParser`. The output shape decides what each element is
+ as it starts, so values are converted as their elements end and elements the shape does not describe are skipped
+ without being collected. Error responses are collected as untyped dictionaries, as `AWSXMLDictionaryParser` did.
+ */
+@interface AWSXMLResponseDecoder : NSObject <NSXMLParserDelegate>
+
+@property (nonatomic, assign, readonly, getter=isErrorResponse) BOOL errorResponse;
+
+- (instancetype)initWithMembers:(NSDictionary *)members
+             resultWrapperNames:(NSArray<NSString *> *)resultWrapperNames
+                  decodesResult:(BOOL)decodesResult;
+
+- (NSMutableDictionary *)dictionaryWithData:(NSData *)data
+                                      error:(NSError *__autoreleasing *)error;
+
+@end
+
+@interface AWSXMLResponseDecoder()
+
+@property (nonatomic, strong) NSDictionary *members;
+@property (nonatomic, strong) NSArray<NSString *> *resultWrapperNames;
+@property (nonatomic, assign) BOOL decodesResult;
+@property (nonatomic, assign, getter=isErrorResponse) BOOL errorResponse;
 
-@property (nonatomic, strong) AWSXMLDictionaryParser *xmlDictionaryParser;
+@property (nonatomic, strong) NSMutableArray<AWSXMLDecoderFrame *> *frames;
+@property (nonatomic, assign) NSUInteger depth;
+// The depth of the element being skipped, counted from 1; 0 when no element is skipped.
+@property (nonatomic, assign) NSUInteger skippedDepth;
+@property (nonatomic, strong) NSString *rootName;
+@property (nonatomic, strong) NSMutableDictionary *result;
+// The result wrappers and the error elements found under the root, by name.
+@property (nonatomic, strong) NSMutableDictionary *rootNodes;
+@property (nonatomic, strong) NSMapTable<NSDictionary *, NSDictionary<NSString *, NSString *> *> *memberNamesByXMLName;
+@property (nonatomic, strong) NSError *error;
+
+@end
+
+@implementation AWSXMLResponseDecoder
+
+- (instancetype)initWithMembers:(NSDictionary *)members
+             resultWrapperNames:(NSArray<NSString *> *)resultWrapperNames
+                  decodesResult:(BOOL)decodesResult {
+    if (self = [super init]) {
+        _members = members;
+        _resultWrapperNames = resultWrapperNames;
+        _decodesResult = decodesResult;
+        _frames = [NSMutableArray new];
+        _result = [NSMutableDictionary new];
+        _rootNodes = [NSMutableDictionary new];
+        _memberNamesByXMLName = [[NSMapTable alloc] initWithKeyOptions:NSPointerFunctionsStrongMemory | NSPointerFunctionsObjectPointerPersonality
+                                                          valueOptions:NSPointerFunctionsStrongMemory
+                                                              capacity:0];
+    }
+
+    return self;
+}
+
+- (NSMutableDictionary *)dictionaryWithData:(NSData *)data
+                                      error:(NSError *__autoreleasing *)error {
+    NSXMLParser *parser = [[NSXMLParser alloc] initWithData:data];
+    parser.delegate = self;
+    // As before, a body that is not XML, such as an empty one, decodes to an empty dictionary.
+    [parser parse];
+
+    if (self.error && error) {
+        *error = self.error;
+    }
+
+    if ([self.rootName isEqualToString:@"Error"]) {
+        //This is an S3 error response.
+        self.errorResponse = YES;
+        return [self.rootNodes mutableCopy];
+    }
+    if (self.rootNodes[@"Errors"]) {
+        //This is EC2 error response.
+        self.errorResponse = YES;
+        id errors = self.rootNodes[@"Errors"];
+        if ([errors isKindOfClass:[NSArray class]]) {
+            errors = [errors firstObject];
+        }
+        return [errors isKindOfClass:[NSMutableDictionary class]] ? errors : nil;
+    }
+    if (self.rootNodes[@"Error"]) {
+        //This is mostly used error response.
+        self.errorResponse = YES;
+        return self.rootNodes;
+    }
+
+    for (NSString *resultWrapperName in self.resultWrapperNames) {
+        if (self.rootNodes[resultWrapperName]) {
+            return self.rootNodes[resultWrapperName];
+        }
+    }
+    return self.result;
+}
+
+#pragma mark - Shapes
+
+- (NSDictionary<NSString *, NSString *> *)memberNamesForMembers:(NSDictionary *)members {
+    NSDictionary<NSString *, NSString *> *memberNames = [self.memberNamesByXMLName objectForKey:members];
+    if (memberNames) {
+        return memberNames;
+    }
+
+    NSMutableDictionary<NSString *, NSString *> *names = [NSMutableDictionary new];
+    for (NSString *memberName in members) {
+        id memberRules = members[memberName];
+        if (![memberRules isKindOfClass:[NSDictionary class]]) {
+            continue;
+        }
+        NSString *type = memberRules[@"type"];
+        if ([memberRules[@"flattened"] boolValue] && ([type isEqualToString:@"list"] || [type isEqualToString:@"map"])) {
+            NSString *xmlName = memberRules[@"member"][@"locationName"] ?: memberRules[@"locationName"];
+            names[xmlName ?: @"member"] = memberName;
+        } else if (memberRules[@"locationName"]) {
+            names[memberRules[@"locationName"]] = memberName;
+        }
+    }
+    // A member named after the element wins over a location name.
+    for (NSString *memberName in members) {
+        names[memberName] = memberName;
+    }
+
+    [self.memberNamesByXMLName setObject:names
+                                  forKey:members];
+    return names;
+}
+
+- (id)missingValueForRules:(NSDictionary *)rules {
+    NSString *type = rules[@"type"];
+    if ([type isEqualToString:@"structure"] || [type isEqualToString:@"map"]) {
+        return [NSMutableDictionary new];
+    }
+    if ([type isEqualToString:@"list"]) {
+        return [NSMutableArray new];
+    }
+    return @"XMLPARSER:ERROR";
+}
+
+#pragma mark - Frames
+
+- (AWSXMLDecoderFrame *)pushFrameWithType:(AWSXMLDecoderFrameType)type
+                                    rules:(NSDictionary *)rules
+                                   target:(id)target
+                                targetKey:(NSString *)targetKey {
+    AWSXMLDecoderFrame *frame = nil;
+    if (self.depth < [self.frames count]) {
+        frame = self.frames[self.depth];
+    } else {
+        frame = [AWSXMLDecoderFrame new];
+        [self.frames addObject:frame];
+    }
+    self.depth++;
+
+    frame.type = type;
+    frame.rules = rules;
+    frame.text = nil;
+    frame.hasChildElements = NO;
+    frame.target = target;
+    frame.targetKey = targetKey;
+    switch (type) {
+        case AWSXMLDecoderFrameTypeStructure:
+        case AWSXMLDecoderFrameTypeMap:
+        case AWSXMLDecoderFrameTypeMapEntry:
+        case AWSXMLDecoderFrameTypeUntyped:
+            frame.value = [NSMutableDictionary new];
+            break;
+        case AWSXMLDecoderFrameTypeList:
+            frame.value = [NSMutableArray new];
+            break;
+        case AWSXMLDecoderFrameTypeScalar:
+            frame.value = nil;
+            break;
+    }
+
+    return frame;
+}
+
+- (void)pushFrameWithRules:(NSDictionary *)rules
+                    target:(id)target
+                 targetKey:(NSString *)targetKey {
+    NSString *type = rules[@"type"];
+    if ([type isEqualToString:@"structure"]) {
+        [self pushFrameWithType:AWSXMLDecoderFrameTypeStructure
+                          rules:rules[@"members"] ?: @{}
+                         target:target
+                      targetKey:targetKey];
+    } else if ([type isEqualToString:@"list"]) {
+        [self pushFrameWithType:AWSXMLDecoderFrameTypeList
+                          rules:rules
+                         target:target
+                      targetKey:targetKey];
+    } else if ([type isEqualToString:@"map"]) {
+        [self pushFrameWithType:AWSXMLDecoderFrameTypeMap
+                          rules:rules
+                         target:target
+                      targetKey:targetKey];
+    } else {
+        [self pushFrameWithType:AWSXMLDecoderFrameTypeScalar
+                          rules:rules
+                         target:target
+                      targetKey:targetKey];
+    }
+}
+
+- (void)pushMemberFrameForElement:(NSString *)elementName
+                          inFrame:(AWSXMLDecoderFrame *)frame {
+    NSString *memberName = [self memberNamesForMembers:frame.rules][elementName];
+    if (!memberName) {
+        if (![elementName isEqualToString:@"requestId"]
+            && ![elementName isEqualToString:@"ResponseMetadata"]) {
+            AWSDDLogWarn(@"Response element ignored: no rule for %@", elementName);
+        }
+        self.skippedDepth = 1;
+        return;
+    }
+
+    NSDictionary *memberRules = frame.rules[memberName];
+    NSString *name = memberRules[@"name"] ?: memberName;
+    NSString *type = memberRules[@"type"];
+    if ([memberRules[@"flattened"] boolValue] && [type isEqualToString:@"list"]) {
+        // Each element of a flattened list is one of its members.
+        NSMutableArray *list = frame.value[name];
+        if (![list isKindOfClass:[NSMutableArray class]]) {
+            list = [NSMutableArray new];
+            frame.value[name] = list;
+        }
+        [self pushFrameWithRules:memberRules[@"member"] ?: @{}
+                          target:list
+                       targetKey:nil];
+    } else if ([memberRules[@"flattened"] boolValue] && [type isEqualToString:@"map"]) {
+        NSMutableDictionary *map = frame.value[name];
+        if (![map isKindOfClass:[NSMutableDictionary class]]) {
+            map = [NSMutableDictionary new];
+            frame.value[name] = map;
+        }
+        [self pushFrameWithType:AWSXMLDecoderFrameTypeMapEntry
+                          rules:memberRules
+                         target:map
+                      targetKey:nil];
+    } else {
+        [self pushFrameWithRules:memberRules
+                          target:frame.value
+                       targetKey:name];
+    }
+}
+
+- (void)popFrame {
+    AWSXMLDecoderFrame *frame = self.frames[self.depth - 1];
+    self.depth--;
+
+    id value = nil;
+    switch (frame.type) {
+        case AWSXMLDecoderFrameTypeStructure:
+        case AWSXMLDecoderFrameTypeList:
+        case AWSXMLDecoderFrameTypeMap:
+            value = frame.value;
+            break;
+        case AWSXMLDecoderFrameTypeMapEntry: {
+            NSString *key = frame.value[@"key"];
+            if ([key isKindOfClass:[NSString class]]) {
+                [frame.target setObject:frame.value[@"value"] ?: [self missingValueForRules:frame.rules[@"value"] ?: @{}]
+                                 forKey:key];
+            }
+            break;
+        }
+        case AWSXMLDecoderFrameTypeScalar: {
+            NSString *type = frame.rules[@"type"];
+            if (frame.text || !type || [type isEqualToString:@"string"] || [type isEqualToString:@"character"]) {
+                NSError *error = nil;
+                value = [AWSXMLParser valueForText:frame.text ?: @""
+                                             rules:frame.rules
+                                             error:&error];
+                if (error && !self.error) {
+                    self.error = error;
+                }
+            }
+            break;
+        }
+        case AWSXMLDecoderFrameTypeUntyped:
+            if ([frame.value count] > 0) {
+                value = frame.value;
+            } else {
+                value = frame.text ?: frame.value;
+            }
+            break;
+    }
+
+    if (value && frame.target) {
+        if (!frame.targetKey) {
+            [frame.target addObject:value];
+        } else if (frame.type == AWSXMLDecoderFrameTypeUntyped && frame.target[frame.targetKey]) {
+            // Repeated elements of an untyped element are collected in an array.
+            id existing = frame.target[frame.targetKey];
+            if ([existing isKindOfClass:[NSMutableArray class]]) {
+                [existing addObject:value];
+            } else {
+                frame.target[frame.targetKey] = [NSMutableArray arrayWithObjects:existing, value, nil];
+            }
+        } else {
+            frame.target[frame.targetKey] = value;
+        }
+    }
+
+    frame.value = nil;
+    frame.text = nil;
+    frame.target = nil;
+}
+
+#pragma mark - NSXMLParserDelegate
+
+- (void)parser:(NSXMLParser *)parser didStartElement:(NSString *)elementName namespaceURI:(NSString *)namespaceURI qualifiedName:(NSString *)qName attributes:(NSDictionary<NSString *, NSString *> *)attributeDict {
+    if (self.skippedDepth > 0) {
+        self.skippedDepth++;
+        return;
+    }
+
+    if (self.depth == 0) {
+        self.rootName = elementName;
+        if ([elementName isEqualToString:@"Error"]) {
+            [self pushFrameWithType:AWSXMLDecoderFrameTypeUntyped
+                              rules:nil
+                             target:self.rootNodes
+                          targetKey:elementName];
+        } else if (!self.decodesResult) {
+            [parser abortParsing];
+        } else {
+            [self pushFrameWithType:AWSXMLDecoderFrameTypeStructure
+                              rules:self.members
+                             target:nil
+                          targetKey:nil];
+            [self.frames firstObject].value = self.result;
+        }
+        return;
+    }
+
+    AWSXMLDecoderFrame *frame = self.frames[self.depth - 1];
+    frame.hasChildElements = YES;
+
+    if (self.depth == 1 && frame.type == AWSXMLDecoderFrameTypeStructure) {
+        if ([elementName isEqualToString:@"Error"]
+            || [elementName isEqualToString:@"Errors"]
+            || self.rootNodes[@"Error"]
+            || self.rootNodes[@"Errors"]) {
+            // The elements that follow an error are kept with it.
+            [self pushFrameWithType:AWSXMLDecoderFrameTypeUntyped
+                              rules:nil
+                             target:self.rootNodes
+                          targetKey:elementName];
+            return;
+        }
+        if ([self.resultWrapperNames containsObject:elementName]) {
+            [self pushFrameWithType:AWSXMLDecoderFrameTypeStructure
+                              rules:self.members
+                             target:self.rootNodes
+                          targetKey:elementName];
+            return;
+        }
+    }
+
+    switch (frame.type) {
+        case AWSXMLDecoderFrameTypeStructure:
+            [self pushMemberFrameForElement:elementName
+                                    inFrame:frame];
+            break;
+        case AWSXMLDecoderFrameTypeList: {
+            NSDictionary *memberRules = frame.rules[@"member"] ?: @{};
+            NSString *memberName = memberRules[@"locationName"] ?: @"member";
+            if ([elementName isEqualToString:memberName]) {
+                [self pushFrameWithRules:memberRules
+                                  target:frame.value
+                               targetKey:nil];
+            } else {
+                self.skippedDepth = 1;
+            }
+            break;
+        }
+        case AWSXMLDecoderFrameTypeMap:
+            if ([elementName isEqualToString:@"entry"]) {
+                [self pushFrameWithType:AWSXMLDecoderFrameTypeMapEntry
+                                  rules:frame.rules
+                                 target:frame.value
+                              targetKey:nil];
+            } else {
+                self.skippedDepth = 1;
+            }
+            break;
+        case AWSXMLDecoderFrameTypeMapEntry: {
+            NSDictionary *keyRules = frame.rules[@"key"] ?: @{};
+            NSDictionary *valueRules = frame.rules[@"value"] ?: @{};
+            if ([elementName isEqualToString:keyRules[@"locationName"] ?: @"key"]) {
+                [self pushFrameWithRules:keyRules
+                                  target:frame.value
+                               targetKey:@"key"];
+            } else if ([elementName isEqualToString:valueRules[@"locationName"] ?: @"value"]) {
+                [self pushFrameWithRules:valueRules
+                                  target:frame.value
+                               targetKey:@"value"];
+            } else {
+                self.skippedDepth = 1;
+            }
+            break;
+        }
+        case AWSXMLDecoderFrameTypeScalar:
+            self.skippedDepth = 1;
+            break;
+        case AWSXMLDecoderFrameTypeUntyped:
+            [self pushFrameWithType:AWSXMLDecoderFrameTypeUntyped
+                              rules:nil
+                             target:frame.value
+                          targetKey:elementName];
+            break;
+    }
+}
+
+- (void)parser:(NSXMLParser *)parser didEndElement:(NSString *)elementName namespaceURI:(NSString *)namespaceURI qualifiedName:(NSString *)qName {
+    if (self.skippedDepth > 0) {
+        self.skippedDepth--;
+        return;
+    }
+    if (self.depth == 0) {
+        return;
+    }
+
+    if (self.depth == 1 && self.frames[0].type == AWSXMLDecoderFrameTypeStructure) {
+        // A root element with only text, such as the `LocationConstraint` of GetBucketLocation, is its own member.
+        AWSXMLDecoderFrame *frame = self.frames[0];
+        NSString *text = frame.text;
+        if (!frame.hasChildElements && [text length] > 0) {
+            [self pushMemberFrameForElement:elementName
+                                    inFrame:frame];
+            if (self.skippedDepth > 0) {
+                self.skippedDepth = 0;
+            } else {
+                self.frames[self.depth - 1].text = text;
+                [self popFrame];
+            }
+        }
+    }
+
+    [self popFrame];
+    if (self.error) {
+        [parser abortParsing];
+    }
+}
+
+- (void)parser:(NSXMLParser *)parser foundCharacters:(NSString *)string {
+    if (self.skippedDepth > 0 || self.depth == 0) {
+        return;
+    }
+
+    AWSXMLDecoderFrame *frame = self.frames[self.depth - 1];
+    if (frame.type == AWSXMLDecoderFrameTypeScalar
+        || frame.type == AWSXMLDecoderFrameTypeUntyped
+        || (self.depth == 1 && !frame.hasChildElements)) {
+        [frame appendText:string];
+    }
+}
+
+- (void)parser:(NSXMLParser *)parser foundCDATA:(NSData *)CDATABlock {
+    NSString *string = [[NSString alloc] initWithData:CDATABlock encoding:NSUTF8StringEncoding];
+    if (string) {
+        [self parser:parser foundCharacters:string];
+    }
+}
 
 @end
 
@@ -375,19 +1055,6 @@ NSString *const AWSJSONParserErrorDomain = @"com.amazonaws.AWSJSONParserErrorDom
     return sharedInstance;
 }
 
-- (instancetype)init {
-    if (self = [super init]) {
-        _xmlDictionaryParser = [AWSXMLDictionaryParser new];
-        _xmlDictionaryParser.trimWhiteSpace = NO;
-        _xmlDictionaryParser.attributesMode = AWSXMLDictionaryAttributesModeDiscard; //discard all xml attributes. e.g. xmlns
-        _xmlDictionaryParser.stripEmptyNodes = NO;
-        _xmlDictionaryParser.wrapRootNode = YES; //wrapRootNode for easy process
-        _xmlDictionaryParser.nodeNameMode = AWSXMLDictionaryNodeNameModeNever; //do not need rootName anymore since rootNode is wrapped.
-    }
-
-    return self;
-}
-
 + (BOOL)failWithCode:(NSInteger)code description:(NSString *)description error:(NSError *__autoreleasing *)error {
     if (error) {
         *error = [NSError errorWithDomain:AWSXMLParserErrorDomain
@@ -397,37 +1064,28 @@ NSString *const AWSJSONParserErrorDomain = @"com.amazonaws.AWSJSONParserErrorDom
     return NO;
 }
 
-+ (NSMutableDictionary *)preprocessDictionary:(NSMutableDictionary *)fromDictionary operationName:(NSString *)operationName actionRule:(NSDictionary *)actionRule serviceDefinitionRule:(NSDictionary *)serviceDefinitionRule {
++ (NSArray<NSString *> *)resultWrapperNamesForOperationName:(NSString *)operationName actionRule:(NSDictionary *)actionRule serviceDefinitionRule:(NSDictionary *)serviceDefinitionRule {
 
     NSString *serviceTypeStr = serviceDefinitionRule[@"metadata"][@"type"]?serviceDefinitionRule[@"metadata"][@"type"]:serviceDefinitionRule[@"metadata"][@"protocol"];
 
-
     if ([serviceTypeStr isEqualToString:@"query"]) {
         NSNumber *isResultWrapped = serviceDefinitionRule[@"metadata"][@"resultWrapped"];
         if (isResultWrapped && ![isResultWrapped boolValue]) {
             //If resultWrapped is false
-            return fromDictionary;
-        } else {
-            //If not set, it is true by default
-            if (actionRule[@"resultWrapper"] && fromDictionary[actionRule[@"resultWrapper"]]) {
-                return fromDictionary[actionRule[@"resultWrapper"]];
-            } else if ([operationName stringByAppendingString:@"Result"] && fromDictionary[[operationName stringByAppendingString:@"Result"]]){
-                return fromDictionary[[operationName stringByAppendingString:@"Result"]];
-            } else {
-                return fromDictionary;
-            }
+            return @[];
         }
-
-    } else if ([serviceTypeStr isEqualToString:@"rest-xml"]) {
-        //TODO: handle rest-xml type for Route 53 and S3
-        return fromDictionary;
-    } else if ([serviceTypeStr isEqualToString:@"json"]) {
-        return fromDictionary;
-    } else if ([serviceTypeStr isEqualToString:@"rest-json"]) {
-        return fromDictionary;
-    } else {
-        return fromDictionary;
+        //If not set, it is true by default
+        NSMutableArray<NSString *> *resultWrapperNames = [NSMutableArray new];
+        if (actionRule[@"resultWrapper"]) {
+            [resultWrapperNames addObject:actionRule[@"resultWrapper"]];
+        }
+        if (operationName) {
+            [resultWrapperNames addObject:[operationName stringByAppendingString:@"Result"]];
+        }
+        return resultWrapperNames;
     }
+
+    return @[];
 }
 
 - (NSMutableDictionary *)dictionaryForXMLData:(NSData *)data
@@ -458,112 +1116,36 @@ NSString *const AWSJSONParserErrorDomain = @"com.amazonaws.AWSJSONParserErrorDom
         return nil;
     }
 
-    NSMutableDictionary *rootXmlDictionary = nil;
-    if ([data isKindOfClass:[NSData class]]) {
-        @synchronized (self) {
-            rootXmlDictionary = [[self.xmlDictionaryParser dictionaryWithData:data] mutableCopy]; //TODO: need error parameters for parsing
-        }
+    AWSJSONDictionary *rules = [[AWSJSONShapeIndex shapeIndexForDefinitionRule:definitionRules] rulesForDictionary:actionRule];
+    NSString *isPayloadData = rules[@"payload"];
+    NSDictionary *members = rules[@"members"]?rules[@"members"]:@{};
+    //A streaming payload is the body itself; it is only parsed to find an error response.
+    BOOL isStreaming = isPayloadData && members[isPayloadData][@"streaming"];
+    if (isPayloadData) {
+        members = members[isPayloadData][@"members"]?members[isPayloadData][@"members"]:@{};
     }
 
-    NSString *rootNodeName = [[rootXmlDictionary allKeys] firstObject];
-
-    NSMutableDictionary *xmlDictionary = ([rootXmlDictionary[rootNodeName] isKindOfClass:[NSDictionary class]] && [rootXmlDictionary[rootNodeName] count] > 0)?rootXmlDictionary[rootNodeName]:rootXmlDictionary;
-
-    if (*error) {
-        return nil;
-    } else if ([rootNodeName isEqualToString:@"Error"]) {
-        //This is an S3 error response, just return parsed xmlDictionary.
-        return [@{rootNodeName:xmlDictionary} mutableCopy];
-    } else if ([xmlDictionary objectForKey:@"Errors"]) {
-        //This is EC2 error response.
-        if ([[xmlDictionary objectForKey:@"Errors"] isKindOfClass:[NSDictionary class]]) {
-            return [xmlDictionary objectForKey:@"Errors"];
-        } else if  ([[xmlDictionary objectForKey:@"Errors"] isKindOfClass:[NSArray class]]) {
-            return [[xmlDictionary objectForKey:@"Errors"] firstObject];
-        }
-        return nil;
-    }else if ([xmlDictionary objectForKey:@"Error"]) {
-        //This is mostly used error response, return xmlDictionary
-        return [xmlDictionary mutableCopy];
-    }else {
-        AWSJSONDictionary *rules = [[AWSJSONDictionary alloc] initWithDictionary:actionRule JSONDefinitionRule:definitionRules];
-
-        xmlDictionary = [AWSXMLParser preprocessDictionary:xmlDictionary operationName:actionName actionRule:rules serviceDefinitionRule:serviceDefinitionRule];
-
-        NSString *isPayloadData = rules[@"payload"];
-        rules = rules[@"members"]?rules[@"members"]:@{};
-        NSMutableDictionary *parsedData = [NSMutableDictionary new];
-
-        if (isPayloadData) {
-            //check if it is streaming type
-            if (rules[isPayloadData][@"streaming"]) {
-                parsedData[isPayloadData] = data;
-                return parsedData;
-            }
-
-            rules = rules[isPayloadData][@"members"];
-            parsedData[isPayloadData] = [AWSXMLParser parseStructure:xmlDictionary rules:rules error:error];
-        } else {
-            parsedData = [AWSXMLParser parseStructure:xmlDictionary rules:rules error:error];
-        }
-
-
-        if ([parsedData count] == 0) {
-            //try again with rootDictionary if it is S3 response
-            NSString *serviceTypeStr = serviceDefinitionRule[@"metadata"][@"type"]?serviceDefinitionRule[@"metadata"][@"type"]:serviceDefinitionRule[@"metadata"][@"protocol"];
-            if ([serviceTypeStr isEqualToString:@"rest-xml"]) {
-                xmlDictionary = [AWSXMLParser preprocessDictionary:xmlDictionary operationName:actionName actionRule:actionRule serviceDefinitionRule:serviceDefinitionRule];
-                parsedData = [AWSXMLParser parseStructure:xmlDictionary rules:rules error:error];
-            }
-        }
+    AWSXMLResponseDecoder *decoder = [[AWSXMLResponseDecoder alloc] initWithMembers:members
+                                                                 resultWrapperNames:[AWSXMLParser resultWrapperNamesForOperationName:actionName actionRule:rules serviceDefinitionRule:serviceDefinitionRule]
+                                                                      decodesResult:!isStreaming];
+    NSMutableDictionary *parsedData = nil;
+    if ([data isKindOfClass:[NSData class]]) {
+        parsedData = [decoder dictionaryWithData:data error:error];
+    } else {
+        parsedData = [NSMutableDictionary new];
+    }
 
+    if (decoder.isErrorResponse) {
         return parsedData;
-    };
-}
-
-+ (NSString *)findKeyNameByXMLName:(NSString *)xmlName rules:(NSDictionary *)rules {
-    __block NSString *result;
-    [rules enumerateKeysAndObjectsUsingBlock:^(NSString *key, id obj, BOOL *stop) {
-
-        if ([key isEqualToString:xmlName]) {
-            result = key;
-            *stop = YES;
-            return;
-        }
-
-        if ([obj isKindOfClass:[NSDictionary class]] && ([obj[@"type"] isEqualToString:@"list"] || [obj[@"type"] isEqualToString:@"map"])) {
-            if ([obj[@"flattened"] boolValue]) {
-                NSString *objXMLName = obj[@"member"][@"locationName"]?obj[@"member"][@"locationName"]:obj[@"locationName"];
-                objXMLName = objXMLName?objXMLName:@"member";
-                if ([xmlName isEqualToString:objXMLName]) {
-                    result = key;
-                    *stop = YES;
-                    return;
-                }
-            } else {
-                if ([xmlName isEqualToString:obj[@"locationName"]]) {
-                    result = key;
-                    *stop = YES;
-                    return;
-                }
-            }
-
-        }
-
-        if ([obj isKindOfClass:[NSDictionary class]] && [obj objectForKey:@"locationName"]) {
-            if ([xmlName isEqualToString:[obj objectForKey:@"locationName"]]) {
-                result = key;
-                *stop = YES;
-                return;
-            }
-
-        }
-
-
+    }
 
+    if (isStreaming) {
+        return [@{isPayloadData : data} mutableCopy];
+    } else if (isPayloadData) {
+        return [@{isPayloadData : parsedData} mutableCopy];
+    }
 
-    }];
-    return result;
+    return parsedData;
 }
 
 + (BOOL)validateConstraint:(id)value rules:(NSDictionary *)rules error:(NSError *__autoreleasing *)error {
@@ -596,215 +1178,34 @@ NSString *const AWSJSONParserErrorDomain = @"com.amazonaws.AWSJSONParserErrorDom
     return YES;
 }
 
-
-+ (NSMutableDictionary *)parseStructure:(NSDictionary *)structure rules:(AWSJSONDictionary *)rules error:(NSError *__autoreleasing *)error {
-    NSMutableDictionary *data = [NSMutableDictionary dictionary];
-
-    if (![self validateConstraint:structure rules:rules error:error]) {
-        return data;
-    }
-
-    __block NSError *blockErr = nil;
-    [structure enumerateKeysAndObjectsUsingBlock:^(NSString *xmlName, id value, BOOL *stop) {
-        if ([xmlName isEqualToString:@"$"]) {
-        } else {
-            NSString *keyName = [self findKeyNameByXMLName:xmlName rules:rules];
-            if (!keyName) {
-                if (![xmlName isEqualToString:@"_xmlns"] &&
-                    ![xmlName isEqualToString:@"requestId"] &&
-                    ![xmlName isEqualToString:@"ResponseMetadata"] &&
-                    ![xmlName isEqualToString:@"__text"]) {
-                    AWSDDLogWarn(@"Response element ignored: no rule for %@ - %@", xmlName, [value description]);
-                }
-
-                /*[self failWithCode:AWSXMLParserXMLNameNotFoundInDefinition
-                 description:[NSString stringWithFormat:@"Can not find the xmlName:%@ in definition to validate xml data", xmlName]
-                 error:&blockErr];
-                 *stop = YES;
-                 */
-                return;
-            }
-            AWSJSONDictionary *rule = rules[keyName];
-            if ([rules count] == 0) {
-                [self failWithCode:AWSXMLParserUnexpectedXMLElement description:[NSString stringWithFormat:@"Unexpected XML Element found:%@",xmlName] error:&blockErr];
-                *stop = YES;
-            } else {
-                NSString *dicName = rule[@"name"]?rule[@"name"]:keyName;
-                data[dicName] = [self parseMember:value rules:rule error:&blockErr];
-                if (blockErr) *stop = YES;
-            }
-
-        }
-    }];
-
-    if (error) *error = blockErr;
-
-    return data;
-}
-
-+ (NSMutableDictionary *)parseMap:(id)map rules:(AWSJSONDictionary *)rules error:(NSError *__autoreleasing *)error {
-    AWSJSONDictionary *keyRules = rules[@"key"]?rules[@"key"]:@{};
-    AWSJSONDictionary *valueRules = rules[@"value"]?rules[@"value"]:@{};
-    NSString *keyName = keyRules[@"locationName"]?keyRules[@"locationName"]:@"key";
-    NSString *valueName = valueRules[@"locationName"]?valueRules[@"locationName"]:@"value";
-
-    __block NSMutableDictionary *data = [NSMutableDictionary dictionary];
-
-    if (![self validateConstraint:map rules:rules error:error]) return data;
-
-    NSArray *mapList = nil;
-    if ([rules[@"flattened"] boolValue] == NO) {
-        //If it is non-flatened map,retrive the array with key 'entry' if it has one
-        if ([map isKindOfClass:[NSDictionary class]] && [map objectForKey:@"entry"]) {
-            mapList = [map objectForKey:@"entry"];
-        } else {
-            mapList = map;
-        }
-    } else {
-        mapList = map;
-    }
-
-
-    //if no content, return empty dictionary
-    if (!mapList) {
-        return data;
-    }
-    // if 'map' array has only one entry, it will be treat as dictionary, we need to add a array wrapper for that.
-    if ([mapList isKindOfClass:[NSDictionary class]]) {
-        mapList = @[mapList];
-    }
-
-    if (![mapList isKindOfClass:[NSArray class]]) {
-        [self failWithCode:AWSXMLParserUnExpectedType description:[NSString stringWithFormat:@"xml(mapList type) should be an array but got:%@",NSStringFromClass([mapList class])] error:error];
-        return [NSMutableDictionary new];
-    } else {
-        __block NSError *blockErr = nil;
-        [mapList enumerateObjectsUsingBlock:^(id entry, NSUInteger idx, BOOL *stop) {
-            NSString *dataKeyName = entry[keyName];
-            if (dataKeyName) {
-                data[dataKeyName] = [self parseMember:entry[valueName] rules:valueRules error:&blockErr];
-                if (blockErr) *stop = YES;
-            }
-        }];
-        if (error) *error = blockErr;
-        return data;
-    }
-}
-
-+ (NSArray *)parseList:(id)list rules:(AWSJSONDictionary *)rules error:(NSError *__autoreleasing *)error {
-
-    AWSJSONDictionary *memberRules = rules[@"member"]?rules[@"member"]:@{};
-    __block NSMutableArray *data = [NSMutableArray array];
-
-    if (![self validateConstraint:list rules:rules error:error]) return data;
-    __block NSError *blockErr = nil;
-
-    //If not flattened, need to manually flatten it.
-    if (![rules[@"flattened"] boolValue]) {
-        NSString *memberName = memberRules[@"locationName"]?memberRules[@"locationName"]:@"member";
-        if (![list isKindOfClass:[NSDictionary class]]) {
-            [self failWithCode:AWSXMLParserUnExpectedType description:[NSString stringWithFormat:@"unflattened xml(list type) should be dictionary but got:%@",NSStringFromClass([list class])] error:error];
-            return @[];
-        }
-        if ([list count] == 0) {
-            return @[];
-        }
-
-        list = list[memberName];
-        if (!list) {
-            [self failWithCode:AWSXMLParserUnExpectedType description:[NSString stringWithFormat:@"Can not find the '%@' key-pair in un-falttened xml list type",memberName] error:error];
-            return @[@"XMLPARSER:ERROR"];
-        }
-    }
-
-    if ([list isKindOfClass:[NSDictionary class]]) {
-        // if 'list' isn't an array but a dictionary, we create a new array containing our object.
-        list = @[list];
-    }
-
-    if (![list isKindOfClass:[NSArray class]]) {
-        return @[list];
-    }
-    [list enumerateObjectsUsingBlock:^(id value, NSUInteger idx, BOOL *stop) {
-        [data addObject:[self parseMember:value rules:memberRules error:&blockErr]];
-        if (blockErr) *stop = YES;
-    }];
-    if (error) *error = blockErr;
-    return data;
-}
-
-+ (id)parseMember:(id)values rules:(AWSJSONDictionary *)rules error:(NSError *__autoreleasing *)error {
++ (id)valueForText:(NSString *)text rules:(NSDictionary *)rules error:(NSError *__autoreleasing *)error {
 
     NSString *rulesType = rules[@"type"];
 
-    //if value is nil, return error or empty array/dictionary.
-    if (!values) {
-        if ([rulesType isEqualToString:@"structure"]) return @{};
-        if ([rulesType isEqualToString:@"list"]) return @[];
-        if ([rulesType isEqualToString:@"map"]) return @{};
-        return @"XMLPARSER:ERROR";
-    }
-
     //if there is no 'type' key in rules, return nil with error
     if (!rulesType) {
-        [self failWithCode:AWSXMLParserNoTypeDefinitionInRule description:[NSString stringWithFormat:@"can not find the 'type' keywords in definition file:%@ for value:%@",[rules description],[values description]] error:error];
+        [self failWithCode:AWSXMLParserNoTypeDefinitionInRule description:[NSString stringWithFormat:@"can not find the 'type' keywords in definition file:%@ for value:%@",[rules description],text] error:error];
         return @"XMLPARSER:ERROR";
     }
 
     //validate the value
-    if (![self validateConstraint:values rules:rules error:error]) return @"XMLPARSER:ERROR";
+    if (![self validateConstraint:text rules:rules error:error]) return @"XMLPARSER:ERROR";
 
     if ([rulesType isEqualToString:@"string"] || [rulesType isEqualToString:@"character"]) {
-        if ([values isKindOfClass:[NSString class]]) {
-            return values;
-        } else if ([values isKindOfClass:[NSDictionary class]] && [values count] == 0) {
-            return @"";
-        } else {
-            return [values description];
-        }
-    } else if ([rulesType isEqualToString:@"structure"]) {
-        return [self parseStructure:values rules:rules[@"members"]?rules[@"members"]:@{} error:error];
-    } else if ([rulesType isEqualToString:@"list"]) {
-        return [self parseList:values rules:rules error:error];
-    } else if ([rulesType isEqualToString:@"map"]) {
-        return [self parseMap:values rules:rules error:error];
+        return text;
     } else if ([rulesType isEqualToString:@"integer"] || [rulesType isEqualToString:@"long"]) {
-        if ([values isKindOfClass:[NSNumber class]]) {
-            return values;
-        } else if ([values isKindOfClass:[NSString class]]) {
-            return [NSNumber numberWithInteger:[values integerValue]];
-        }
-
+        return [NSNumber numberWithInteger:[text integerValue]];
     } else if ([rulesType isEqualToString:@"float"] || [rulesType isEqualToString:@"double"]) {
-        if ([values isKindOfClass:[NSNumber class]]) {
-            return values;
-        } else if ([values isKindOfClass:[NSString class]]) {
-            return [NSNumber numberWithDouble:[values doubleValue]];
-        }
+        return [NSNumber numberWithDouble:[text doubleValue]];
     } else if ([rulesType isEqualToString:@"boolean"]) {
-        if ([values isKindOfClass:[NSNumber class]]) {
-            return values;
-        } else if ([values isKindOfClass:[NSString class]]) {
-            return [NSNumber numberWithBool:[values boolValue]];
-        }
+        return [NSNumber numberWithBool:[text boolValue]];
     } else if ([rulesType isEqualToString:@"timestamp"]) {
-        //a value with NSNumber type should be a good timestamp.
-        NSDate *timeStampDate;
-        //maybe a NSDate type or NSNumber type or NSString type
-        if ([values isKindOfClass:[NSString class]]) {
-            //try parse the string to NSDate first
-            timeStampDate = [NSDate aws_dateFromString:values];
-
-            //if failed, then parse it as double value
-            if (!timeStampDate) {
-                timeStampDate = [NSDate dateWithTimeIntervalSince1970:[values doubleValue]];
-            }
-        } else if ([values isKindOfClass:[NSNumber class]]) {
-            //need to convert to NSDate type
-            timeStampDate = [NSDate dateWithTimeIntervalSince1970:[values doubleValue]];
+        //try parse the string to NSDate first
+        NSDate *timeStampDate = [NSDate aws_dateFromString:text];
 
-        } else if ([values isKindOfClass:[NSDate class]]) {
-            timeStampDate = values;
+        //if failed, then parse it as double value
+        if (!timeStampDate) {
+            timeStampDate = [NSDate dateWithTimeIntervalSince1970:[text doubleValue]];
         }
 
         //generate string presentation of timestamp
@@ -820,25 +1221,18 @@ NSString *const AWSJSONParserErrorDomain = @"com.amazonaws.AWSJSONParserErrorDom
         return timestampStr;
 
     } else if ([rulesType isEqualToString:@"blob"]) {
-
         //decode Base64Str to NSData
-        if ([values isKindOfClass:[NSString class]]) {
-            NSData *decodedData = [[NSData alloc] initWithBase64EncodedString:values options:0];
-            //return origin string value if can not be encoded.
-            return decodedData?decodedData:values;
-        } else {
-            [self failWithCode:AWSXMLParserInvalidXMLValue description:@"blob value should be NSString type" error:error];
-            return [NSData new];
-        }
+        NSData *decodedData = [[NSData alloc] initWithBase64EncodedString:text options:0];
+        //return origin string value if can not be encoded.
+        return decodedData?decodedData:text;
     }
 
-    [self failWithCode:AWSXMLParserUnHandledType description:[NSString stringWithFormat:@"unhandled type for value:%@",[values description]] error:error];
+    [self failWithCode:AWSXMLParserUnHandledType description:[NSString stringWithFormat:@"unhandled type for value:%@",text] error:error];
     return @"XMLPARSER:ERROR";
 }
 
 @end
 
-
 @implementation AWSQueryParamBuilder
 
 + (BOOL)failWithCode:(NSInteger)code description:(NSString *)description error:(NSError *__autoreleasing *)error {
@@ -902,7 +1296,7 @@ NSString *const AWSJSONParserErrorDomain = @"com.amazonaws.AWSJSONParserErrorDom
         return nil;
     }
 
-    AWSJSONDictionary *rules = [[AWSJSONDictionary alloc] initWithDictionary:actionRule JSONDefinitionRule:definitionRules];
+    AWSJSONDictionary *rules = [[AWSJSONShapeIndex shapeIndexForDefinitionRule:definitionRules] rulesForDictionary:actionRule];
 
 
     [AWSQueryParamBuilder serializeStructure:params rules:rules prefix:@"" formattedParams:formattedParams  error:error];
@@ -1126,7 +1520,7 @@ NSString *const AWSJSONParserErrorDomain = @"com.amazonaws.AWSJSONParserErrorDom
         return nil;
     }
 
-    AWSJSONDictionary *rules = [[AWSJSONDictionary alloc] initWithDictionary:actionRule JSONDefinitionRule:definitionRules];
+    AWSJSONDictionary *rules = [[AWSJSONShapeIndex shapeIndexForDefinitionRule:definitionRules] rulesForDictionary:actionRule];
 
 
     [AWSEC2ParamBuilder serializeStructure:params rules:rules prefix:@"" formattedParams:formattedParams  error:error];
@@ -1277,38 +1671,8 @@ NSString *const AWSJSONParserErrorDomain = @"com.amazonaws.AWSJSONParserErrorDom
                        actionName:(NSString *)actionName
             serviceDefinitionRule:(NSDictionary *)serviceDefinitionRule
                             error:(NSError *__autoreleasing *)error {
-
-    id serializedJsonObject = [self buildJSONDictionary:params actionName:actionName serviceDefinitionRule:serviceDefinitionRule error:error];
-
-    if (!serializedJsonObject) {
-        serializedJsonObject = @{};
-    }
-
-    if ([NSJSONSerialization isValidJSONObject:serializedJsonObject] == NO) {
-        if ([serializedJsonObject isKindOfClass:[NSData class]]) {
-            return serializedJsonObject;
-        } else {
-            [self failWithCode:AWSJSONBuilderInvalidParameter description:[NSString stringWithFormat:@"serialized object is neither a valid json Object nor NSData object: %@",serializedJsonObject] error:error];
-            return nil;
-        }
-
-    } else {
-        NSData *bodyData = [NSJSONSerialization dataWithJSONObject:serializedJsonObject
-                                                           options:0
-                                                             error:error];
-        return bodyData;
-    }
-
-
-}
-
-+ (NSDictionary *)buildJSONDictionary:(NSDictionary *)params
-                           actionName:(NSString *)actionName
-                serviceDefinitionRule:(NSDictionary *)serviceDefinitionRule
-                                error:(NSError *__autoreleasing *)error {
-
     if ([params count] == 0) {
-        return nil;
+        return [NSData dataWithBytes:"{}" length:2];
     }
 
     NSDictionary *actionRule = [[[serviceDefinitionRule objectForKey:@"operations"] objectForKey:actionName] objectForKey:@"input"];
@@ -1316,82 +1680,145 @@ NSString *const AWSJSONParserErrorDomain = @"com.amazonaws.AWSJSONParserErrorDom
 
     if (definitionRules == (id)[NSNull null] ||  [definitionRules count] == 0) {
         AWSDDLogError(@"JSON definition File is empty or can not be found, will return un-serialized dictionary");
-        return params;
+        if (![NSJSONSerialization isValidJSONObject:params]) {
+            [self failWithCode:AWSJSONBuilderInvalidParameter description:[NSString stringWithFormat:@"serialized object is neither a valid json Object nor NSData object: %@",params] error:error];
+            return nil;
+        }
+        return [NSJSONSerialization dataWithJSONObject:params
+                                               options:0
+                                                 error:error];
     }
 
-
-
     if ([actionRule count] == 0) {
         [self failWithCode:AWSJSONBuilderUndefinedActionRule description:@"Invalid argument: actionRule is Empty" error:error];
         return nil;
     }
 
-    AWSJSONDictionary *rules = [[AWSJSONDictionary alloc] initWithDictionary:actionRule JSONDefinitionRule:definitionRules];
-
-    id resultParams = [self serializeMember:rules value:params isPayloadType:NO error:error];
+    AWSJSONDictionary *rules = [[AWSJSONShapeIndex shapeIndexForDefinitionRule:definitionRules] rulesForDictionary:actionRule];
 
-    return resultParams;
+    //a blob payload is sent as the body itself
+    NSString *payloadMemberName = rules[@"payload"];
+    id payload = payloadMemberName ? params[payloadMemberName] : nil;
+    if (payload && payload != [NSNull null]) {
+        AWSJSONDictionary *payloadMemberRules = rules[@"members"][payloadMemberName];
+        if ([payloadMemberRules[@"type"] isEqualToString:@"blob"]) {
+            if ([payload isKindOfClass:[NSString class]]) {
+                return [payload dataUsingEncoding:NSUTF8StringEncoding];
+            }
+            if ([payload isKindOfClass:[NSData class]]) {
+                return payload;
+            }
+            [self failWithCode:AWSJSONBuilderInvalidParameter description:@"'blob' value should be a NSData type." error:error];
+            return nil;
+        }
+    }
 
+    NSMutableData *data = [NSMutableData dataWithCapacity:AWSJSONBuilderInitialCapacity];
+    if (![self writeMember:rules value:params isPayloadType:NO data:data error:error]) {
+        return nil;
+    }
 
+    return data;
 }
 
-+ (NSDictionary *)serializeStructure:(NSDictionary *)structureRules values:(NSDictionary *)values error:(NSError *__autoreleasing *)error {
+#pragma mark - Writing
+
+// The members are written straight into the body as the shapes are walked, without building the JSON object first.
+// NSNull members of structures and maps are left out, as aws_removeNullValues would have left them out.
 
-    NSMutableDictionary *data = [NSMutableDictionary new];
++ (BOOL)writeStructure:(NSDictionary *)structureRules values:(NSDictionary *)values data:(NSMutableData *)data error:(NSError *__autoreleasing *)error {
+    AWSJSONDictionary *structureMembersRule = structureRules[@"members"];
+    BOOL isFirstMember = YES;
 
+    [data appendBytes:"{" length:1];
     for (NSString *key in values) {
         id value = values[key];
+        if (value == [NSNull null]) {
+            continue;
+        }
 
-        AWSJSONDictionary *memberShape = structureRules[@"members"][key];
-
-        if (memberShape[@"location"]) {
+        AWSJSONDictionary *memberShape = structureMembersRule[key];
+        if (!memberShape || memberShape[@"location"]) {
             //It should be another location rather than body, will be process at different place
             continue;
         }
 
-        if (memberShape && value) {
-            NSString *name = memberShape[@"locationName"]?memberShape[@"locationName"]:key;
-            data[name] = [self serializeMember:memberShape value:value isPayloadType:NO error:error];
+        if (!isFirstMember) {
+            [data appendBytes:"," length:1];
         }
+        isFirstMember = NO;
 
+        NSString *name = memberShape[@"locationName"]?memberShape[@"locationName"]:key;
+        [self writeString:name data:data];
+        [data appendBytes:":" length:1];
+        if (![self writeMember:memberShape value:value isPayloadType:NO data:data error:error]) {
+            return NO;
+        }
     }
+    [data appendBytes:"}" length:1];
 
-    return data;
+    return YES;
 }
 
-+ (NSArray *)serializeList:(NSDictionary *)listRules values:(NSArray *)values error:(NSError *__autoreleasing *)error {
-    NSMutableArray *dataArray = [NSMutableArray new];
++ (BOOL)writeList:(NSDictionary *)listRules values:(NSArray *)values data:(NSMutableData *)data error:(NSError *__autoreleasing *)error {
+    AWSJSONDictionary *memberRules = listRules[@"member"];
+    BOOL isFirstMember = YES;
 
+    [data appendBytes:"[" length:1];
     for (id value in values) {
+        if (!isFirstMember) {
+            [data appendBytes:"," length:1];
+        }
+        isFirstMember = NO;
 
-        [dataArray addObject:[self serializeMember:listRules[@"member"] value:value isPayloadType:NO error:error]];
-
+        if (![self writeMember:memberRules value:value isPayloadType:NO data:data error:error]) {
+            return NO;
+        }
     }
+    [data appendBytes:"]" length:1];
 
-    return dataArray;
+    return YES;
 }
 
-+ (NSDictionary *)serializeMap:(NSDictionary *)mapRules values:(NSDictionary *)values error:(NSError *__autoreleasing *)error {
++ (BOOL)writeMap:(NSDictionary *)mapRules values:(NSDictionary *)values data:(NSMutableData *)data error:(NSError *__autoreleasing *)error {
+    AWSJSONDictionary *valueRules = mapRules[@"value"];
+    BOOL isFirstMember = YES;
 
-    NSMutableDictionary *data = [NSMutableDictionary new];
-
-    for (NSString *key in values) {
+    [data appendBytes:"{" length:1];
+    for (id key in values) {
         id value = values[key];
-        data[key] = [self serializeMember:mapRules[@"value"] value:value isPayloadType:NO error:error];
+        if (value == [NSNull null]) {
+            continue;
+        }
+        if (![key isKindOfClass:[NSString class]]) {
+            return [self failWithCode:AWSJSONBuilderInvalidParameter description:[NSString stringWithFormat:@"a map key should be a string but got:%@",key] error:error];
+        }
+
+        if (!isFirstMember) {
+            [data appendBytes:"," length:1];
+        }
+        isFirstMember = NO;
+
+        [self writeString:key data:data];
+        [data appendBytes:":" length:1];
+        if (![self writeMember:valueRules value:value isPayloadType:NO data:data error:error]) {
+            return NO;
+        }
     }
+    [data appendBytes:"}" length:1];
 
-    return data;
+    return YES;
 }
 
-+ (id)serializeMember:(NSDictionary *)shape value:(id)value isPayloadType:(BOOL)isPayloadType error:(NSError *__autoreleasing *)error {
++ (BOOL)writeMember:(NSDictionary *)shape value:(id)value isPayloadType:(BOOL)isPayloadType data:(NSMutableData *)data error:(NSError *__autoreleasing *)error {
     NSString *payloadMemberName = shape[@"payload"];
-    if (payloadMemberName) {
+    if (payloadMemberName && [value isKindOfClass:[NSDictionary class]]) {
         id payload = value[payloadMemberName];
-        if (payload) {
+        if (payload && payload != [NSNull null]) {
             AWSJSONDictionary *structureMembersRule = shape[@"members"]?shape[@"members"]:@{};
             AWSJSONDictionary *payloadMemberRules = structureMembersRule[payloadMemberName];
 
-            return [self serializeMember:payloadMemberRules value:payload isPayloadType:YES error:error];
+            return [self writeMember:payloadMemberRules value:payload isPayloadType:YES data:data error:error];
         }
     }
 
@@ -1400,36 +1827,34 @@ NSString *const AWSJSONParserErrorDomain = @"com.amazonaws.AWSJSONParserErrorDom
 
         if (![value isKindOfClass:[NSDictionary class]]) {
             if (![value isKindOfClass:[NSNull class]]) {
-                [self failWithCode:AWSJSONBuilderInvalidParameter description:[NSString stringWithFormat:@"a structure input should be a dictionary but got:%@",value] error:error];
+                return [self failWithCode:AWSJSONBuilderInvalidParameter description:[NSString stringWithFormat:@"a structure input should be a dictionary but got:%@",value] error:error];
             }
-            return @{};
-        } else {
-
-            return [self serializeStructure:shape values:value error:error];
+            [data appendBytes:"{}" length:2];
+            return YES;
         }
+        return [self writeStructure:shape values:value data:data error:error];
 
     } else if ([rulesType isEqualToString:@"list"]) {
 
         if (![value isKindOfClass:[NSArray class]]) {
             if (![value isKindOfClass:[NSNull class]]) {
-                [self failWithCode:AWSJSONBuilderInvalidParameter description:[NSString stringWithFormat:@"a list input should be an array but got:%@",value] error:error];
+                return [self failWithCode:AWSJSONBuilderInvalidParameter description:[NSString stringWithFormat:@"a list input should be an array but got:%@",value] error:error];
             }
-            return @[];
-        } else {
-            return [self serializeList:shape values:value error:error];
+            [data appendBytes:"[]" length:2];
+            return YES;
         }
-
+        return [self writeList:shape values:value data:data error:error];
 
     } else if ([rulesType isEqualToString:@"map"]) {
 
         if (![value isKindOfClass:[NSDictionary class]]) {
             if (![value isKindOfClass:[NSNull class]]) {
-                [self failWithCode:AWSJSONBuilderInvalidParameter description:[NSString stringWithFormat:@"a map input should be a dictionary but got:%@",value] error:error];
+                return [self failWithCode:AWSJSONBuilderInvalidParameter description:[NSString stringWithFormat:@"a map input should be a dictionary but got:%@",value] error:error];
             }
-            return @{};
-        } else {
-            return [self serializeMap:shape values:value error:error];
+            [data appendBytes:"{}" length:2];
+            return YES;
         }
+        return [self writeMap:shape values:value data:data error:error];
 
     } else if ([rulesType isEqualToString:@"timestamp"]) {
 
@@ -1451,8 +1876,7 @@ NSString *const AWSJSONParserErrorDomain = @"com.amazonaws.AWSJSONParserErrorDom
             timeStampDate = value;
         }
 
-        return [NSNumber numberWithDouble:[timeStampDate timeIntervalSince1970]];
-
+        return [self writeDouble:[timeStampDate timeIntervalSince1970] data:data error:error];
 
     } else if ([rulesType isEqualToString:@"blob"]) {
 
@@ -1460,26 +1884,198 @@ NSString *const AWSJSONParserErrorDomain = @"com.amazonaws.AWSJSONParserErrorDom
         if ([value isKindOfClass:[NSString class]]) {
             value = [value dataUsingEncoding:NSUTF8StringEncoding];
         }
-        if ([value isKindOfClass:[NSData class]]) {
-            if (isPayloadType) {
-                //Do not base64 encoding if it is payload type
-                return value;
-            } else {
-                NSString *base64encodedStr = [value base64EncodedStringWithOptions:0];
-                return base64encodedStr?base64encodedStr:@"";
-            }
-        } else {
-            [self failWithCode:AWSJSONBuilderInvalidParameter description:@"'blob' value should be a NSData type." error:error];
-            return @"";
+        if (![value isKindOfClass:[NSData class]]) {
+            return [self failWithCode:AWSJSONBuilderInvalidParameter description:@"'blob' value should be a NSData type." error:error];
         }
+        if (isPayloadType) {
+            //only a payload of the whole body can be sent without base64 encoding
+            return [self failWithCode:AWSJSONBuilderInvalidParameter description:[NSString stringWithFormat:@"serialized object is neither a valid json Object nor NSData object: %@",value] error:error];
+        }
+        NSString *base64encodedStr = [value base64EncodedStringWithOptions:0];
+        [self writeString:base64encodedStr?base64encodedStr:@"" data:data];
+        return YES;
 
     } else {
 
-        return value;
+        return [self writeJSONObject:value data:data error:error];
 
     }
 }
 
++ (BOOL)writeJSONObject:(id)value data:(NSMutableData *)data error:(NSError *__autoreleasing *)error {
+    if ([value isKindOfClass:[NSString class]]) {
+        [self writeString:value data:data];
+        return YES;
+    }
+
+    if ([value isKindOfClass:[NSNumber class]]) {
+        if (value == (id)kCFBooleanTrue) {
+            [data appendBytes:"true" length:4];
+            return YES;
+        }
+        if (value == (id)kCFBooleanFalse) {
+            [data appendBytes:"false" length:5];
+            return YES;
+        }
+
+        const char *objCType = [value objCType];
+        if (strcmp(objCType, @encode(float)) == 0) {
+            return [self writeFloat:[value floatValue] data:data error:error];
+        }
+        if (strcmp(objCType, @encode(double)) == 0) {
+            return [self writeDouble:[value doubleValue] data:data error:error];
+        }
+
+        char buffer[24];
+        int length = 0;
+        if (strcmp(objCType, @encode(unsigned long long)) == 0) {
+            length = snprintf(buffer, sizeof(buffer), "%llu", [value unsignedLongLongValue]);
+        } else {
+            length = snprintf(buffer, sizeof(buffer), "%lld", [value longLongValue]);
+        }
+        [data appendBytes:buffer length:length];
+        return YES;
+    }
+
+    if (value == [NSNull null]) {
+        [data appendBytes:"null" length:4];
+        return YES;
+    }
+
+    if ([value isKindOfClass:[NSArray class]]) {
+        BOOL isFirstMember = YES;
+        [data appendBytes:"[" length:1];
+        for (id member in value) {
+            if (!isFirstMember) {
+                [data appendBytes:"," length:1];
+            }
+            isFirstMember = NO;
+            if (![self writeJSONObject:member data:data error:error]) {
+                return NO;
+            }
+        }
+        [data appendBytes:"]" length:1];
+        return YES;
+    }
+
+    if ([value isKindOfClass:[NSDictionary class]]) {
+        BOOL isFirstMember = YES;
+        [data appendBytes:"{" length:1];
+        for (id key in value) {
+            if (![key isKindOfClass:[NSString class]]) {
+                return [self failWithCode:AWSJSONBuilderInvalidParameter description:[NSString stringWithFormat:@"serialized object is neither a valid json Object nor NSData object: %@",value] error:error];
+            }
+            if (!isFirstMember) {
+                [data appendBytes:"," length:1];
+            }
+            isFirstMember = NO;
+            [self writeString:key data:data];
+            [data appendBytes:":" length:1];
+            if (![self writeJSONObject:value[key] data:data error:error]) {
+                return NO;
+            }
+        }
+        [data appendBytes:"}" length:1];
+        return YES;
+    }
+
+    return [self failWithCode:AWSJSONBuilderInvalidParameter description:[NSString stringWithFormat:@"serialized object is neither a valid json Object nor NSData object: %@",value] error:error];
+}
+
++ (BOOL)writeDouble:(double)value data:(NSMutableData *)data error:(NSError *__autoreleasing *)error {
+    if (isnan(value) || isinf(value)) {
+        return [self failWithCode:AWSJSONBuilderInvalidParameter description:[NSString stringWithFormat:@"%f is not a valid json number",value] error:error];
+    }
+
+    //the shortest of the two precisions that reads back as the same double
+    char buffer[32];
+    int length = snprintf(buffer, sizeof(buffer), "%.15g", value);
+    if (strtod(buffer, NULL) != value) {
+        length = snprintf(buffer, sizeof(buffer), "%.17g", value);
+    }
+    [data appendBytes:buffer length:length];
+
+    return YES;
+}
+
++ (BOOL)writeFloat:(float)value data:(NSMutableData *)data error:(NSError *__autoreleasing *)error {
+    if (isnan(value) || isinf(value)) {
+        return [self failWithCode:AWSJSONBuilderInvalidParameter description:[NSString stringWithFormat:@"%f is not a valid json number",value] error:error];
+    }
+
+    //as for doubles, at the precisions of a float, so 0.1f is written as 0.1 rather than as the double it widens to
+    char buffer[24];
+    int length = snprintf(buffer, sizeof(buffer), "%.6g", value);
+    if (strtof(buffer, NULL) != value) {
+        length = snprintf(buffer, sizeof(buffer), "%.9g", value);
+    }
+    [data appendBytes:buffer length:length];
+
+    return YES;
+}
+
++ (void)writeString:(NSString *)string data:(NSMutableData *)data {
+    static const char AWSJSONBuilderHexDigits[] = "0123456789abcdef";
+
+    [data appendBytes:"\"" length:1];
+
+    //the UTF-8 bytes are converted a chunk at a time into a buffer on the stack
+    uint8_t buffer[256];
+    NSRange remainingRange = NSMakeRange(0, [string length]);
+    while (remainingRange.length > 0) {
+        NSRange range = remainingRange;
+        NSUInteger usedLength = 0;
+        if (![string getBytes:buffer
+                    maxLength:sizeof(buffer)
+                   usedLength:&usedLength
+                     encoding:NSUTF8StringEncoding
+                      options:NSStringEncodingConversionAllowLossy
+                        range:range
+               remainingRange:&remainingRange] || usedLength == 0) {
+            //a unit with no UTF-8 form, such as a lone surrogate, is replaced by U+FFFD and the rest of the string is still written
+            [data appendBytes:"\xEF\xBF\xBD" length:3];
+            remainingRange = NSMakeRange(range.location + 1, range.length - 1);
+            continue;
+        }
+
+        NSUInteger runStart = 0;
+        for (NSUInteger i = 0; i < usedLength; i++) {
+            uint8_t c = buffer[i];
+            if (c >= 0x20 && c != '"' && c != '\\') {
+                continue;
+            }
+
+            [data appendBytes:buffer + runStart length:i - runStart];
+            runStart = i + 1;
+            switch (c) {
+                case '"':
+                    [data appendBytes:"\\\"" length:2];
+                    break;
+                case '\\':
+                    [data appendBytes:"\\\\" length:2];
+                    break;
+                case '\n':
+                    [data appendBytes:"\\n" length:2];
+                    break;
+                case '\r':
+                    [data appendBytes:"\\r" length:2];
+                    break;
+                case '\t':
+                    [data appendBytes:"\\t" length:2];
+                    break;
+                default: {
+                    char escape[6] = {'\\', 'u', '0', '0', AWSJSONBuilderHexDigits[c >> 4], AWSJSONBuilderHexDigits[c & 0xF]};
+                    [data appendBytes:escape length:sizeof(escape)];
+                    break;
+                }
+            }
+        }
+        [data appendBytes:buffer + runStart length:usedLength - runStart];
+    }
+
+    [data appendBytes:"\"" length:1];
+}
+
 @end
 
 @implementation AWSJSONParser
@@ -1529,7 +2125,7 @@ NSString *const AWSJSONParserErrorDomain = @"com.amazonaws.AWSJSONParserErrorDom
         return result;
     }
 
-    AWSJSONDictionary *rules = [[AWSJSONDictionary alloc] initWithDictionary:actionRule JSONDefinitionRule:definitionRules];
+    AWSJSONDictionary *rules = [[AWSJSONShapeIndex shapeIndexForDefinitionRule:definitionRules] rulesForDictionary:actionRule];
 
     //check if has payload tag.
     NSString *isPayloadData = rules[@"payload"];
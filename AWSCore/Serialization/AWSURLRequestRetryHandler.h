@@ -20,7 +20,17 @@
 @interface AWSURLRequestRetryHandler : NSObject <AWSURLRequestRetryHandler>
 
 @property (nonatomic, assign) uint32_t maxRetryCount;
+@property (nonatomic, assign) AWSNetworkingRetryMode retryMode;
 
 - (instancetype)initWithMaximumRetryCount:(uint32_t)maxRetryCount;
 
+- (instancetype)initWithMaximumRetryCount:(uint32_t)maxRetryCount
+                                retryMode:(AWSNetworkingRetryMode)retryMode;
+
+/**
+ Returns `YES` if the response indicates that the service is throttling the client. Subclasses should override this method to add service specific throttling errors.
+ */
+- (BOOL)isThrottlingError:(NSError *)error
+                 response:(NSHTTPURLResponse *)response;
+
 @end
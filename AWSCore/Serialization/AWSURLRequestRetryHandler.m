@@ -16,6 +16,261 @@
 #import "AWSURLRequestRetryHandler.h"
 #import "AWSURLResponseSerialization.h"
 #import "AWSService.h"
+#import "AWSSynchronizedMutableDictionary.h"
+
+static const NSInteger AWSRetryQuotaMaxCapacity = 500;
+static const NSInteger AWSRetryQuotaRetryCost = 5;
+static const NSInteger AWSRetryQuotaTimeoutRetryCost = 10;
+static const NSInteger AWSRetryQuotaNoRetryIncrement = 1;
+
+static const NSTimeInterval AWSRetryBaseDelay = 0.1;
+static const NSTimeInterval AWSRetryThrottlingBaseDelay = 0.5;
+static const NSTimeInterval AWSRetryMaxBackoff = 20.0;
+
+static const double AWSRateLimiterMinFillRate = 0.5;
+static const double AWSRateLimiterMinCapacity = 1.0;
+static const double AWSRateLimiterSmooth = 0.8;
+static const double AWSRateLimiterBeta = 0.7;
+static const double AWSRateLimiterScaleConstant = 0.4;
+
+static NSSet<NSString *> *AWSRetryThrottlingErrorCodes(void) {
+    static NSSet<NSString *> *_throttlingErrorCodes = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        _throttlingErrorCodes = [NSSet setWithObjects:
+                                 @"Throttling",
+                                 @"ThrottlingException",
+                                 @"ThrottledException",
+                                 @"RequestThrottledException",
+                                 @"TooManyRequestsException",
+                                 @"ProvisionedThroughputExceededException",
+                                 @"TransactionInProgressException",
+                                 @"RequestLimitExceeded",
+                                 @"BandwidthLimitExceeded",
+                                 @"LimitExceededException",
+                                 @"RequestThrottled",
+                                 @"SlowDown",
+                                 @"PriorRequestNotComplete",
+                                 @"EC2ThrottledException",
+                                 nil];
+    });
+
+    return _throttlingErrorCodes;
+}
+
+/**
+ The error code the service returned: `Code` of XML errors, `__type` of JSON errors or the `x-amzn-ErrorType`
+ header of REST JSON errors, without its namespace and details.
+ */
+static NSString *AWSRetryErrorCode(NSError *error) {
+    id errorCode = error.userInfo[@"Code"] ?: error.userInfo[@"__type"] ?: error.userInfo[NSLocalizedFailureReasonErrorKey];
+    if (![errorCode isKindOfClass:[NSString class]]) {
+        return nil;
+    }
+
+    errorCode = [[errorCode componentsSeparatedByString:@"#"] lastObject];
+    return [[errorCode componentsSeparatedByString:@":"] firstObject];
+}
+
+#pragma mark - AWSRetryQuota
+
+/**
+ A token bucket that bounds how many retries are in flight against one endpoint. Retries consume
+ capacity; successful responses put it back.
+ */
+@interface AWSRetryQuota : NSObject
+
+@property (nonatomic, assign) NSInteger availableCapacity;
+
+- (BOOL)acquireCapacity:(NSInteger)amount;
+- (void)releaseCapacity:(NSInteger)amount;
+
+@end
+
+@implementation AWSRetryQuota
+
+- (instancetype)init {
+    if (self = [super init]) {
+        _availableCapacity = AWSRetryQuotaMaxCapacity;
+    }
+
+    return self;
+}
+
+- (BOOL)acquireCapacity:(NSInteger)amount {
+    @synchronized(self) {
+        if (amount > _availableCapacity) {
+            return NO;
+        }
+        _availableCapacity -= amount;
+        return YES;
+    }
+}
+
+- (void)releaseCapacity:(NSInteger)amount {
+    @synchronized(self) {
+        _availableCapacity = MIN(_availableCapacity + amount, AWSRetryQuotaMaxCapacity);
+    }
+}
+
+@end
+
+#pragma mark - AWSClientSideRateLimiter
+
+/**
+ A CUBIC-style sending rate limiter. It is disabled until the first throttling response, then
+ drops the fill rate multiplicatively on every throttle and grows it back on successes.
+ */
+@interface AWSClientSideRateLimiter : NSObject
+
+- (NSTimeInterval)acquireToken;
+- (void)updateClientSendingRateWithThrottling:(BOOL)isThrottlingResponse;
+
+@end
+
+@implementation AWSClientSideRateLimiter {
+    BOOL _enabled;
+    double _fillRate;
+    double _maxCapacity;
+    double _currentCapacity;
+    NSTimeInterval _lastTimestamp;
+    double _measuredTxRate;
+    NSTimeInterval _lastTxRateBucket;
+    NSInteger _requestCount;
+    double _lastMaxRate;
+    NSTimeInterval _lastThrottleTime;
+    double _timeWindow;
+}
+
+- (instancetype)init {
+    if (self = [super init]) {
+        _fillRate = AWSRateLimiterMinFillRate;
+        _maxCapacity = AWSRateLimiterMinCapacity;
+        _lastTimestamp = [self now];
+        _lastTxRateBucket = floor([self now]);
+        _lastThrottleTime = [self now];
+    }
+
+    return self;
+}
+
+- (NSTimeInterval)now {
+    return [NSProcessInfo processInfo].systemUptime;
+}
+
+- (NSTimeInterval)acquireToken {
+    @synchronized(self) {
+        if (!_enabled) {
+            return 0;
+        }
+
+        [self refill];
+        NSTimeInterval delay = 0;
+        if (_currentCapacity < 1) {
+            delay = (1 - _currentCapacity) / _fillRate;
+        }
+        _currentCapacity -= 1;
+
+        return delay;
+    }
+}
+
+- (void)updateClientSendingRateWithThrottling:(BOOL)isThrottlingResponse {
+    @synchronized(self) {
+        [self updateMeasuredRate];
+
+        double calculatedRate = 0;
+        if (isThrottlingResponse) {
+            double rateToUse = _enabled ? MIN(_measuredTxRate, _fillRate) : _measuredTxRate;
+            _lastMaxRate = rateToUse;
+            [self calculateTimeWindow];
+            _lastThrottleTime = [self now];
+            calculatedRate = rateToUse * AWSRateLimiterBeta;
+            _enabled = YES;
+        } else {
+            [self calculateTimeWindow];
+            calculatedRate = AWSRateLimiterScaleConstant * pow([self now] - _lastThrottleTime - _timeWindow, 3) + _lastMaxRate;
+        }
+
+        [self updateTokenBucketRate:MIN(calculatedRate, 2 * _measuredTxRate)];
+    }
+}
+
+- (void)refill {
+    NSTimeInterval timestamp = [self now];
+    _currentCapacity = MIN(_maxCapacity, _currentCapacity + (timestamp - _lastTimestamp) * _fillRate);
+    _lastTimestamp = timestamp;
+}
+
+- (void)calculateTimeWindow {
+    _timeWindow = cbrt(_lastMaxRate * (1 - AWSRateLimiterBeta) / AWSRateLimiterScaleConstant);
+}
+
+- (void)updateMeasuredRate {
+    NSTimeInterval timeBucket = floor([self now] * 2) / 2;
+    _requestCount++;
+    if (timeBucket > _lastTxRateBucket) {
+        double currentRate = _requestCount / (timeBucket - _lastTxRateBucket);
+        _measuredTxRate = currentRate * AWSRateLimiterSmooth + _measuredTxRate * (1 - AWSRateLimiterSmooth);
+        _requestCount = 0;
+        _lastTxRateBucket = timeBucket;
+    }
+}
+
+- (void)updateTokenBucketRate:(double)newRate {
+    [self refill];
+    _fillRate = MAX(newRate, AWSRateLimiterMinFillRate);
+    _maxCapacity = MAX(newRate, AWSRateLimiterMinCapacity);
+    _currentCapacity = MIN(_currentCapacity, _maxCapacity);
+}
+
+@end
+
+#pragma mark - AWSRetryEndpointState
+
+@interface AWSRetryEndpointState : NSObject
+
+@property (nonatomic, strong) AWSRetryQuota *retryQuota;
+@property (nonatomic, strong) AWSClientSideRateLimiter *rateLimiter;
+@property (nonatomic, strong) NSMapTable<AWSNetworkingRequest *, NSNumber *> *acquiredRetryCosts;
+
++ (instancetype)stateForRequest:(AWSNetworkingRequest *)request;
+
+@end
+
+@implementation AWSRetryEndpointState
+
++ (instancetype)stateForRequest:(AWSNetworkingRequest *)request {
+    static AWSSynchronizedMutableDictionary *_endpointStates = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        _endpointStates = [AWSSynchronizedMutableDictionary new];
+    });
+
+    NSString *host = request.baseURL.host ?: request.URL.host ?: @"";
+    @synchronized(_endpointStates) {
+        AWSRetryEndpointState *state = [_endpointStates objectForKey:host];
+        if (!state) {
+            state = [AWSRetryEndpointState new];
+            [_endpointStates setObject:state forKey:host];
+        }
+        return state;
+    }
+}
+
+- (instancetype)init {
+    if (self = [super init]) {
+        _retryQuota = [AWSRetryQuota new];
+        _rateLimiter = [AWSClientSideRateLimiter new];
+        _acquiredRetryCosts = [NSMapTable weakToStrongObjectsMapTable];
+    }
+
+    return self;
+}
+
+@end
+
+#pragma mark - AWSURLRequestRetryHandler
 
 @interface AWSURLRequestRetryHandler ()
 
@@ -26,13 +281,41 @@
 @implementation AWSURLRequestRetryHandler
 
 - (instancetype)initWithMaximumRetryCount:(uint32_t)maxRetryCount {
+    return [self initWithMaximumRetryCount:maxRetryCount
+                                 retryMode:AWSNetworkingRetryModeLegacy];
+}
+
+- (instancetype)initWithMaximumRetryCount:(uint32_t)maxRetryCount
+                                retryMode:(AWSNetworkingRetryMode)retryMode {
     if (self = [super init]) {
         _maxRetryCount = maxRetryCount;
+        _retryMode = retryMode;
     }
 
     return self;
 }
 
+- (BOOL)isThrottlingError:(NSError *)error
+                 response:(NSHTTPURLResponse *)response {
+    if ([error.domain isEqualToString:AWSServiceErrorDomain]) {
+        switch (error.code) {
+            case AWSServiceErrorThrottling:
+            case AWSServiceErrorThrottlingException:
+                return YES;
+            default:
+                break;
+        }
+    }
+
+    if (response.statusCode == 429) {
+        return YES;
+    }
+
+    // A 503 is only throttling when the service says so, such as S3's `SlowDown`; other 503s are transient errors.
+    NSString *errorCode = AWSRetryErrorCode(error);
+    return errorCode != nil && [AWSRetryThrottlingErrorCodes() containsObject:errorCode];
+}
+
 - (BOOL)isClockSkewError:(NSError *)error {
     if ([error.domain isEqualToString:AWSServiceErrorDomain]) {
         switch (error.code) {
@@ -138,7 +421,66 @@
                               response:(NSHTTPURLResponse *)response
                                   data:(NSData *)data
                                  error:(NSError *)error {
-    return pow(2, currentRetryCount) * 100 / 1000;
+    if (self.retryMode == AWSNetworkingRetryModeLegacy) {
+        return pow(2, currentRetryCount) * 100 / 1000;
+    }
+
+    // Full jitter: a uniformly random delay between zero and the exponential back-off ceiling.
+    NSTimeInterval baseDelay = [self isThrottlingError:error response:response] ? AWSRetryThrottlingBaseDelay : AWSRetryBaseDelay;
+    NSTimeInterval ceiling = MIN(AWSRetryMaxBackoff, baseDelay * pow(2, currentRetryCount));
+    return ceiling * ((double)arc4random() / UINT32_MAX);
+}
+
+- (NSTimeInterval)timeIntervalBeforeSendingRequest:(AWSNetworkingRequest *)request {
+    if (self.retryMode != AWSNetworkingRetryModeAdaptive) {
+        return 0;
+    }
+
+    return [[AWSRetryEndpointState stateForRequest:request].rateLimiter acquireToken];
+}
+
+- (BOOL)acquireRetryQuotaForRequest:(AWSNetworkingRequest *)request
+                           response:(NSHTTPURLResponse *)response
+                              error:(NSError *)error {
+    if (self.retryMode == AWSNetworkingRetryModeLegacy) {
+        return YES;
+    }
+
+    BOOL isTimeout = [error.domain isEqualToString:NSURLErrorDomain] && error.code == NSURLErrorTimedOut;
+    NSInteger cost = isTimeout ? AWSRetryQuotaTimeoutRetryCost : AWSRetryQuotaRetryCost;
+
+    AWSRetryEndpointState *state = [AWSRetryEndpointState stateForRequest:request];
+    if (![state.retryQuota acquireCapacity:cost]) {
+        return NO;
+    }
+    @synchronized(state) {
+        [state.acquiredRetryCosts setObject:@(cost) forKey:request];
+    }
+
+    return YES;
+}
+
+- (void)didCompleteRequest:(AWSNetworkingRequest *)request
+                  response:(NSHTTPURLResponse *)response
+                     error:(NSError *)error {
+    if (self.retryMode == AWSNetworkingRetryModeLegacy) {
+        return;
+    }
+
+    AWSRetryEndpointState *state = [AWSRetryEndpointState stateForRequest:request];
+    if (self.retryMode == AWSNetworkingRetryModeAdaptive) {
+        [state.rateLimiter updateClientSendingRateWithThrottling:[self isThrottlingError:error response:response]];
+    }
+
+    if (!error) {
+        // A successful first attempt adds a little capacity; a successful retry returns what it took.
+        NSNumber *acquiredCost = nil;
+        @synchronized(state) {
+            acquiredCost = [state.acquiredRetryCosts objectForKey:request];
+            [state.acquiredRetryCosts removeObjectForKey:request];
+        }
+        [state.retryQuota releaseCapacity:acquiredCost ? [acquiredCost integerValue] : AWSRetryQuotaNoRetryIncrement];
+    }
 }
 
 @end
@@ -42,6 +42,14 @@
 - (instancetype)initWithJSONDefinition:(NSDictionary *)JSONDefinition
                             actionName:(NSString *)actionName;
 
-@property (nonatomic, strong) NSDictionary *additionalParameters;
+/**
+ Adds `additionalParameters` to the parameters of every request. Service clients share a serializer between the calls
+ of an operation, so the parameters are fixed when it is created.
+ */
+- (instancetype)initWithJSONDefinition:(NSDictionary *)JSONDefinition
+                            actionName:(NSString *)actionName
+                  additionalParameters:(NSDictionary *)additionalParameters;
+
+@property (nonatomic, copy, readonly) NSDictionary *additionalParameters;
 
 @end
@@ -88,7 +88,7 @@
 
     NSDictionary *actionRules = [[self.serviceDefinitionJSON objectForKey:@"operations"] objectForKey:self.actionName];
     NSDictionary *shapeRules = [self.serviceDefinitionJSON objectForKey:@"shapes"];
-    AWSJSONDictionary *inputRules = [[AWSJSONDictionary alloc] initWithDictionary:[actionRules objectForKey:@"input"] JSONDefinitionRule:shapeRules];
+    AWSJSONDictionary *inputRules = [[AWSJSONShapeIndex shapeIndexForDefinitionRule:shapeRules] rulesForDictionary:[actionRules objectForKey:@"input"]];
 
     NSDictionary *actionHTTPRule = [actionRules objectForKey:@"http"];
     NSString *ruleURIStr = [actionHTTPRule objectForKey:@"requestUri"];
@@ -184,7 +184,7 @@
     //Construct URI and Headers and HTTPBodyStream
     NSString *ruleURIStr = [actionHTTPRule objectForKey:@"requestUri"];
     NSDictionary *shapeRules = [self.serviceDefinitionJSON objectForKey:@"shapes"];
-    AWSJSONDictionary *inputRules = [[AWSJSONDictionary alloc] initWithDictionary:[anActionRules objectForKey:@"input"] JSONDefinitionRule:shapeRules];
+    AWSJSONDictionary *inputRules = [[AWSJSONShapeIndex shapeIndexForDefinitionRule:shapeRules] rulesForDictionary:[anActionRules objectForKey:@"input"]];
 
     NSError *error = nil;
     [AWSXMLRequestSerializer constructURIandHeadersAndBody:request
@@ -443,6 +443,14 @@
 
 - (instancetype)initWithJSONDefinition:(NSDictionary *)JSONDefinition
                             actionName:(NSString *)actionName {
+    return [self initWithJSONDefinition:JSONDefinition
+                             actionName:actionName
+                   additionalParameters:nil];
+}
+
+- (instancetype)initWithJSONDefinition:(NSDictionary *)JSONDefinition
+                            actionName:(NSString *)actionName
+                  additionalParameters:(NSDictionary *)additionalParameters {
     if (self = [super init]) {
         _serviceDefinitionJSON = JSONDefinition;
         if (_serviceDefinitionJSON == nil) {
@@ -450,6 +458,7 @@
             return nil;
         }
         _actionName = actionName;
+        _additionalParameters = [additionalParameters copy];
     }
 
     return self;
@@ -469,19 +478,18 @@
             }
 
             if ([obj isKindOfClass:[NSString class]]) {
-                [queryString appendString:[key aws_stringWithURLEncoding]];
+                [queryString aws_appendStringWithURLEncoding:key];
                 [queryString appendString:@"="];
-                NSString *urlEncodedString = [obj aws_stringWithURLEncoding];
-                [queryString appendString:urlEncodedString];
+                [queryString aws_appendStringWithURLEncoding:obj];
             } else if ([obj isKindOfClass:[NSNumber class]]) {
-                [queryString appendString:[key aws_stringWithURLEncoding]];
+                [queryString aws_appendStringWithURLEncoding:key];
                 [queryString appendString:@"="];
-                [queryString appendString:[[obj stringValue] aws_stringWithURLEncoding]];
+                [queryString aws_appendStringWithURLEncoding:[obj stringValue]];
             } else {
                 AWSDDLogError(@"key[%@] is invalid.", key);
-                [queryString appendString:[key aws_stringWithURLEncoding]];
+                [queryString aws_appendStringWithURLEncoding:key];
                 [queryString appendString:@"="];
-                [queryString appendString:[[obj description]aws_stringWithURLEncoding]];
+                [queryString aws_appendStringWithURLEncoding:[obj description]];
             }
         }
     }
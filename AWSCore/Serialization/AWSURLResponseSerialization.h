@@ -32,7 +32,7 @@
 
 @interface AWSXMLResponseSerializer : NSObject <AWSHTTPURLResponseSerializer>
 
-@property (nonatomic, assign) Class outputClass;
+@property (nonatomic, assign, readonly) Class outputClass;
 
 - (instancetype)initWithJSONDefinition:(NSDictionary *)JSONDefinition
                             actionName:(NSString *)actionName
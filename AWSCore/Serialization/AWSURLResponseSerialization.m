@@ -100,7 +100,7 @@
     if ([result isKindOfClass:[NSDictionary class]]) {
         NSDictionary *anActionRules = [[self.serviceDefinitionJSON objectForKey:@"operations"] objectForKey:_actionName];
         NSDictionary *shapeRules = [self.serviceDefinitionJSON objectForKey:@"shapes"];
-        AWSJSONDictionary *outputRules = [[AWSJSONDictionary alloc] initWithDictionary:[anActionRules objectForKey:@"output"] JSONDefinitionRule:shapeRules];
+        AWSJSONDictionary *outputRules = [[AWSJSONShapeIndex shapeIndexForDefinitionRule:shapeRules] rulesForDictionary:[anActionRules objectForKey:@"output"]];
         result = [AWSXMLResponseSerializer parseResponse:response rules:outputRules bodyDictionary:[result mutableCopy] error:error];
 
         NSNumber *errorCode = [[AWSService errorCodeDictionary] objectForKey:[[[result objectForKey:@"__type"] componentsSeparatedByString:@"#"] lastObject]];
@@ -252,7 +252,7 @@
 
     NSDictionary *anActionRules = [[self.serviceDefinitionJSON objectForKey:@"operations"] objectForKey:self.actionName];
     NSDictionary *shapeRules = [self.serviceDefinitionJSON objectForKey:@"shapes"];
-    AWSJSONDictionary *outputRules = [[AWSJSONDictionary alloc] initWithDictionary:[anActionRules objectForKey:@"output"] JSONDefinitionRule:shapeRules];
+    AWSJSONDictionary *outputRules = [[AWSJSONShapeIndex shapeIndexForDefinitionRule:shapeRules] rulesForDictionary:[anActionRules objectForKey:@"output"]];
 
     NSMutableDictionary *resultDic = [NSMutableDictionary new];
 
@@ -57,6 +57,20 @@ typedef NS_ENUM(NSInteger, AWSServiceErrorType) {
 
 + (NSDictionary<NSString *, NSNumber *> *)errorCodeDictionary;
 
+/**
+ Returns the request serializer of an operation, created with `block` the first time the operation is called on this
+ client. Serializers keep no per-request state, so the requests of an operation share one instance.
+ */
+- (id<AWSURLRequestSerializer>)requestSerializerForOperationName:(NSString *)operationName
+                                                      usingBlock:(id<AWSURLRequestSerializer> (^)(void))block;
+
+/**
+ Returns the response serializer of an operation, created with `block` the first time the operation is called on this
+ client.
+ */
+- (id<AWSHTTPURLResponseSerializer>)responseSerializerForOperationName:(NSString *)operationName
+                                                            usingBlock:(id<AWSHTTPURLResponseSerializer> (^)(void))block;
+
 @end
 
 #pragma mark - AWSServiceManager
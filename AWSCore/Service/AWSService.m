@@ -32,8 +32,24 @@ static NSString *const AWSServiceConfigurationUnknown = @"Unknown";
 
 #pragma mark - AWSService
 
+@interface AWSService()
+
+@property (nonatomic, strong) AWSSynchronizedMutableDictionary *requestSerializers;
+@property (nonatomic, strong) AWSSynchronizedMutableDictionary *responseSerializers;
+
+@end
+
 @implementation AWSService
 
+- (instancetype)init {
+    if (self = [super init]) {
+        _requestSerializers = [AWSSynchronizedMutableDictionary new];
+        _responseSerializers = [AWSSynchronizedMutableDictionary new];
+    }
+
+    return self;
+}
+
 + (NSDictionary<NSString *, NSNumber *> *)errorCodeDictionary {
     static NSDictionary *_errorCodeDictionary = nil;
     static dispatch_once_t onceToken;
@@ -64,6 +80,31 @@ static NSString *const AWSServiceConfigurationUnknown = @"Unknown";
     return _errorCodeDictionary;
 }
 
+- (id<AWSURLRequestSerializer>)requestSerializerForOperationName:(NSString *)operationName
+                                                      usingBlock:(id<AWSURLRequestSerializer> (^)(void))block {
+    id<AWSURLRequestSerializer> requestSerializer = [self.requestSerializers objectForKey:operationName];
+    if (!requestSerializer) {
+        // Two first calls racing may both create one; either is fine to keep.
+        requestSerializer = block();
+        [self.requestSerializers setObject:requestSerializer
+                                    forKey:operationName];
+    }
+
+    return requestSerializer;
+}
+
+- (id<AWSHTTPURLResponseSerializer>)responseSerializerForOperationName:(NSString *)operationName
+                                                            usingBlock:(id<AWSHTTPURLResponseSerializer> (^)(void))block {
+    id<AWSHTTPURLResponseSerializer> responseSerializer = [self.responseSerializers objectForKey:operationName];
+    if (!responseSerializer) {
+        responseSerializer = block();
+        [self.responseSerializers setObject:responseSerializer
+                                     forKey:operationName];
+    }
+
+    return responseSerializer;
+}
+
 @end
 
 #pragma mark - AWSServiceManager
@@ -83,6 +83,7 @@ FOUNDATION_EXPORT NSString *const AWSDateShortDateFormat2;
 - (NSString *)aws_stringWithURLEncoding;
 - (NSString *)aws_stringWithURLEncodingPath;
 - (NSString *)aws_stringWithURLEncodingPathWithoutPriorDecoding;
+- (NSString *)aws_decodeURLEncoding;
 - (NSString *)aws_md5String;
 - (NSString *)aws_md5StringLittleEndian;
 - (BOOL)aws_isVirtualHostedStyleCompliant;
@@ -92,6 +93,15 @@ FOUNDATION_EXPORT NSString *const AWSDateShortDateFormat2;
 
 @end
 
+@interface NSMutableString (AWS)
+
+/**
+ Appends `[string aws_stringWithURLEncoding]` without creating the encoded string.
+ */
+- (void)aws_appendStringWithURLEncoding:(NSString *)string;
+
+@end
+
 @interface NSFileManager (AWS)
 
 - (BOOL)aws_atomicallyCopyItemAtURL:(NSURL *)sourceURL
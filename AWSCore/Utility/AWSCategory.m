@@ -14,11 +14,13 @@
 //
 #import "AWSCategory.h"
 #import <objc/runtime.h>
+#import <os/lock.h>
 #import <CommonCrypto/CommonCryptor.h>
 #import <CommonCrypto/CommonDigest.h>
 #import "AWSCocoaLumberjack.h"
 #import "AWSGZIP.h"
 #import "AWSMantle.h"
+#import "AWSEncoding.h"
 
 NSString *const AWSDateRFC822DateFormat1 = @"EEE, dd MMM yyyy HH:mm:ss z";
 NSString *const AWSDateISO8601DateFormat1 = @"yyyy-MM-dd'T'HH:mm:ss'Z'";
@@ -27,6 +29,377 @@ NSString *const AWSDateISO8601DateFormat3 = @"yyyy-MM-dd'T'HH:mm:ss.SSS'Z'";
 NSString *const AWSDateShortDateFormat1 = @"yyyyMMdd";
 NSString *const AWSDateShortDateFormat2 = @"yyyy-MM-dd";
 
+// The formats above are read and written by hand, without a date formatter. Strings they do not match exactly, such as
+// other time zones, are left to `NSDateFormatter`.
+typedef NS_ENUM(NSInteger, AWSDateFixedFormat) {
+    AWSDateFixedFormatUnknown = -1,
+    AWSDateFixedFormatRFC822Date1 = 0,
+    AWSDateFixedFormatISO8601Date1,
+    AWSDateFixedFormatISO8601Date2,
+    AWSDateFixedFormatISO8601Date3,
+    AWSDateFixedFormatShortDate1,
+    AWSDateFixedFormatShortDate2,
+    AWSDateFixedFormatCount,
+};
+
+// Longer strings match none of the formats.
+static const NSUInteger AWSDateMaximumStringLength = 32;
+
+// Years of the Julian calendar and years of more than four digits are left to `NSDateFormatter`.
+static const NSInteger AWSDateMinimumYear = 1583;
+static const NSInteger AWSDateMaximumYear = 9999;
+
+static const char AWSDateWeekdayNames[7][4] = {"Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat"};
+static const char AWSDateMonthNames[12][4] = {"Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"};
+
+typedef struct {
+    NSInteger year;
+    NSInteger month;
+    NSInteger day;
+    NSInteger hour;
+    NSInteger minute;
+    NSInteger second;
+    NSInteger millisecond;
+} AWSDateComponents;
+
+static AWSDateFixedFormat AWSDateFixedFormatForString(NSString *dateFormat) {
+    if (dateFormat == AWSDateRFC822DateFormat1 || [dateFormat isEqualToString:AWSDateRFC822DateFormat1]) {
+        return AWSDateFixedFormatRFC822Date1;
+    }
+    if (dateFormat == AWSDateISO8601DateFormat1 || [dateFormat isEqualToString:AWSDateISO8601DateFormat1]) {
+        return AWSDateFixedFormatISO8601Date1;
+    }
+    if (dateFormat == AWSDateISO8601DateFormat2 || [dateFormat isEqualToString:AWSDateISO8601DateFormat2]) {
+        return AWSDateFixedFormatISO8601Date2;
+    }
+    if (dateFormat == AWSDateISO8601DateFormat3 || [dateFormat isEqualToString:AWSDateISO8601DateFormat3]) {
+        return AWSDateFixedFormatISO8601Date3;
+    }
+    if (dateFormat == AWSDateShortDateFormat1 || [dateFormat isEqualToString:AWSDateShortDateFormat1]) {
+        return AWSDateFixedFormatShortDate1;
+    }
+    if (dateFormat == AWSDateShortDateFormat2 || [dateFormat isEqualToString:AWSDateShortDateFormat2]) {
+        return AWSDateFixedFormatShortDate2;
+    }
+    return AWSDateFixedFormatUnknown;
+}
+
+// Days since 1970-01-01 in the proleptic Gregorian calendar, and back.
+static int64_t AWSDateDaysFromCivil(NSInteger year, NSInteger month, NSInteger day) {
+    year -= month <= 2;
+    int64_t era = (year >= 0 ? year : year - 399) / 400;
+    int64_t yearOfEra = year - era * 400;
+    int64_t dayOfYear = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+    int64_t dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+    return era * 146097 + dayOfEra - 719468;
+}
+
+static void AWSDateCivilFromDays(int64_t days, NSInteger *year, NSInteger *month, NSInteger *day) {
+    days += 719468;
+    int64_t era = (days >= 0 ? days : days - 146096) / 146097;
+    int64_t dayOfEra = days - era * 146097;
+    int64_t yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+    int64_t dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+    int64_t monthIndex = (5 * dayOfYear + 2) / 153;
+    *day = (NSInteger)(dayOfYear - (153 * monthIndex + 2) / 5 + 1);
+    *month = (NSInteger)(monthIndex < 10 ? monthIndex + 3 : monthIndex - 9);
+    *year = (NSInteger)(yearOfEra + era * 400 + (*month <= 2));
+}
+
+static BOOL AWSDateReadDigits(const char *bytes, NSUInteger count, NSInteger *value) {
+    NSInteger result = 0;
+    for (NSUInteger index = 0; index < count; index++) {
+        if (bytes[index] < '0' || bytes[index] > '9') {
+            return NO;
+        }
+        result = result * 10 + (bytes[index] - '0');
+    }
+    *value = result;
+    return YES;
+}
+
+static NSInteger AWSDateReadName(const char *bytes, const char (*names)[4], NSInteger count) {
+    for (NSInteger index = 0; index < count; index++) {
+        if (strncasecmp(bytes, names[index], 3) == 0) {
+            return index;
+        }
+    }
+    return NSNotFound;
+}
+
+static BOOL AWSDateReadDate(const char *bytes, BOOL separated, AWSDateComponents *components) {
+    NSUInteger monthOffset = separated ? 5 : 4;
+    NSUInteger dayOffset = separated ? 8 : 6;
+    return AWSDateReadDigits(bytes, 4, &components->year)
+    && AWSDateReadDigits(bytes + monthOffset, 2, &components->month)
+    && AWSDateReadDigits(bytes + dayOffset, 2, &components->day)
+    && (!separated || (bytes[4] == '-' && bytes[7] == '-'));
+}
+
+static BOOL AWSDateReadTime(const char *bytes, BOOL separated, AWSDateComponents *components) {
+    NSUInteger minuteOffset = separated ? 3 : 2;
+    NSUInteger secondOffset = separated ? 6 : 4;
+    return AWSDateReadDigits(bytes, 2, &components->hour)
+    && AWSDateReadDigits(bytes + minuteOffset, 2, &components->minute)
+    && AWSDateReadDigits(bytes + secondOffset, 2, &components->second)
+    && (!separated || (bytes[2] == ':' && bytes[5] == ':'));
+}
+
+static BOOL AWSDateReadRFC822Date1(const char *bytes, NSUInteger length, AWSDateComponents *components) {
+    // "Wed, 21 Oct 2015 07:28:00 GMT", the day may have one digit
+    NSUInteger dayLength = length == 29 ? 2 : 1;
+    if ((length != 29 && length != 28)
+        || AWSDateReadName(bytes, AWSDateWeekdayNames, 7) == NSNotFound
+        || bytes[3] != ',' || bytes[4] != ' ') {
+        return NO;
+    }
+    bytes += 5;
+    NSInteger month = AWSDateReadName(bytes + dayLength + 1, AWSDateMonthNames, 12);
+    if (!AWSDateReadDigits(bytes, dayLength, &components->day)
+        || bytes[dayLength] != ' '
+        || month == NSNotFound) {
+        return NO;
+    }
+    components->month = month + 1;
+    bytes += dayLength + 4;
+    return bytes[0] == ' '
+    && AWSDateReadDigits(bytes + 1, 4, &components->year)
+    && bytes[5] == ' '
+    && AWSDateReadTime(bytes + 6, YES, components)
+    && bytes[14] == ' '
+    && (strncmp(bytes + 15, "GMT", 3) == 0 || strncmp(bytes + 15, "UTC", 3) == 0);
+}
+
+static BOOL AWSDateReadFixedFormat(AWSDateFixedFormat format, const char *bytes, NSUInteger length, AWSDateComponents *components) {
+    switch (format) {
+        case AWSDateFixedFormatRFC822Date1:
+            return AWSDateReadRFC822Date1(bytes, length, components);
+        case AWSDateFixedFormatISO8601Date1:
+            // "2015-10-21T07:28:00Z"
+            return length == 20 && AWSDateReadDate(bytes, YES, components) && bytes[10] == 'T'
+            && AWSDateReadTime(bytes + 11, YES, components) && bytes[19] == 'Z';
+        case AWSDateFixedFormatISO8601Date2:
+            // "20151021T072800Z"
+            return length == 16 && AWSDateReadDate(bytes, NO, components) && bytes[8] == 'T'
+            && AWSDateReadTime(bytes + 9, NO, components) && bytes[15] == 'Z';
+        case AWSDateFixedFormatISO8601Date3:
+            // "2015-10-21T07:28:00.123Z"
+            return length == 24 && AWSDateReadDate(bytes, YES, components) && bytes[10] == 'T'
+            && AWSDateReadTime(bytes + 11, YES, components) && bytes[19] == '.'
+            && AWSDateReadDigits(bytes + 20, 3, &components->millisecond) && bytes[23] == 'Z';
+        case AWSDateFixedFormatShortDate1:
+            // "20151021"
+            return length == 8 && AWSDateReadDate(bytes, NO, components);
+        case AWSDateFixedFormatShortDate2:
+            // "2015-10-21"
+            return length == 10 && AWSDateReadDate(bytes, YES, components);
+        default:
+            return NO;
+    }
+}
+
+static BOOL AWSDateComponentsAreValid(const AWSDateComponents *components) {
+    static const NSInteger daysInMonth[12] = {31, 29, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    if (components->year < AWSDateMinimumYear || components->year > AWSDateMaximumYear
+        || components->month < 1 || components->month > 12
+        || components->day < 1 || components->day > daysInMonth[components->month - 1]
+        || components->hour > 23 || components->minute > 59 || components->second > 59) {
+        return NO;
+    }
+    if (components->month == 2 && components->day == 29) {
+        NSInteger year = components->year;
+        return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+    }
+    return YES;
+}
+
+// Returns `nil` if the string does not match the format exactly.
+static NSDate *AWSDateFromFixedFormatString(NSString *string, AWSDateFixedFormat format) {
+    if (!string) {
+        return nil;
+    }
+    CFStringRef cfString = (__bridge CFStringRef)string;
+    CFIndex length = CFStringGetLength(cfString);
+    if (length == 0 || length > AWSDateMaximumStringLength) {
+        return nil;
+    }
+
+    char buffer[AWSDateMaximumStringLength];
+    const char *bytes = CFStringGetCStringPtr(cfString, kCFStringEncodingASCII);
+    if (!bytes) {
+        CFIndex byteLength = 0;
+        if (CFStringGetBytes(cfString, CFRangeMake(0, length), kCFStringEncodingASCII, 0, false, (UInt8 *)buffer, sizeof(buffer), &byteLength) != length) {
+            return nil;
+        }
+        bytes = buffer;
+    }
+
+    AWSDateComponents components = {0};
+    if (!AWSDateReadFixedFormat(format, bytes, length, &components)
+        || !AWSDateComponentsAreValid(&components)) {
+        return nil;
+    }
+
+    int64_t seconds = AWSDateDaysFromCivil(components.year, components.month, components.day) * 86400
+    + components.hour * 3600 + components.minute * 60 + components.second;
+    // In milliseconds first, as the date formatter computes it.
+    return [NSDate dateWithTimeIntervalSince1970:(seconds * 1000 + components.millisecond) / 1000.0];
+}
+
+static void AWSDateWriteDigits(char *bytes, NSInteger value, NSUInteger count) {
+    for (NSUInteger index = count; index > 0; index--) {
+        bytes[index - 1] = '0' + value % 10;
+        value /= 10;
+    }
+}
+
+// The date formatter rounds down to the millisecond. Returns `NO` for dates too far from 1970 to count in milliseconds.
+static BOOL AWSDateMillisecondsSince1970(NSDate *date, int64_t *milliseconds) {
+    double value = floor([date timeIntervalSince1970] * 1000.0);
+    if (!(fabs(value) < 1e15)) {
+        return NO;
+    }
+    *milliseconds = (int64_t)value;
+    return YES;
+}
+
+static int64_t AWSDateFloorDivide(int64_t value, int64_t divisor) {
+    return value >= 0 ? value / divisor : -((-value + divisor - 1) / divisor);
+}
+
+// Returns `nil` if the date is outside the years the formats are written by hand for.
+static NSString *AWSDateFixedFormatString(int64_t milliseconds, AWSDateFixedFormat format) {
+    int64_t seconds = AWSDateFloorDivide(milliseconds, 1000);
+    int64_t days = AWSDateFloorDivide(seconds, 86400);
+    int64_t secondOfDay = seconds - days * 86400;
+
+    AWSDateComponents components = {0};
+    AWSDateCivilFromDays(days, &components.year, &components.month, &components.day);
+    if (components.year < AWSDateMinimumYear || components.year > AWSDateMaximumYear) {
+        return nil;
+    }
+    components.hour = (NSInteger)(secondOfDay / 3600);
+    components.minute = (NSInteger)(secondOfDay / 60 % 60);
+    components.second = (NSInteger)(secondOfDay % 60);
+    components.millisecond = (NSInteger)(milliseconds - seconds * 1000);
+
+    char bytes[AWSDateMaximumStringLength];
+    NSUInteger length = 0;
+    switch (format) {
+        case AWSDateFixedFormatRFC822Date1: {
+            // 1970-01-01 was a Thursday.
+            NSInteger weekday = (NSInteger)(((days % 7) + 11) % 7);
+            memcpy(bytes, AWSDateWeekdayNames[weekday], 3);
+            memcpy(bytes + 3, ", ", 2);
+            AWSDateWriteDigits(bytes + 5, components.day, 2);
+            bytes[7] = ' ';
+            memcpy(bytes + 8, AWSDateMonthNames[components.month - 1], 3);
+            bytes[11] = ' ';
+            AWSDateWriteDigits(bytes + 12, components.year, 4);
+            bytes[16] = ' ';
+            AWSDateWriteDigits(bytes + 17, components.hour, 2);
+            bytes[19] = ':';
+            AWSDateWriteDigits(bytes + 20, components.minute, 2);
+            bytes[22] = ':';
+            AWSDateWriteDigits(bytes + 23, components.second, 2);
+            memcpy(bytes + 25, " GMT", 4);
+            length = 29;
+            break;
+        }
+        case AWSDateFixedFormatISO8601Date1:
+        case AWSDateFixedFormatISO8601Date3:
+            AWSDateWriteDigits(bytes, components.year, 4);
+            bytes[4] = '-';
+            AWSDateWriteDigits(bytes + 5, components.month, 2);
+            bytes[7] = '-';
+            AWSDateWriteDigits(bytes + 8, components.day, 2);
+            bytes[10] = 'T';
+            AWSDateWriteDigits(bytes + 11, components.hour, 2);
+            bytes[13] = ':';
+            AWSDateWriteDigits(bytes + 14, components.minute, 2);
+            bytes[16] = ':';
+            AWSDateWriteDigits(bytes + 17, components.second, 2);
+            if (format == AWSDateFixedFormatISO8601Date3) {
+                bytes[19] = '.';
+                AWSDateWriteDigits(bytes + 20, components.millisecond, 3);
+                bytes[23] = 'Z';
+                length = 24;
+            } else {
+                bytes[19] = 'Z';
+                length = 20;
+            }
+            break;
+        case AWSDateFixedFormatISO8601Date2:
+            AWSDateWriteDigits(bytes, components.year, 4);
+            AWSDateWriteDigits(bytes + 4, components.month, 2);
+            AWSDateWriteDigits(bytes + 6, components.day, 2);
+            bytes[8] = 'T';
+            AWSDateWriteDigits(bytes + 9, components.hour, 2);
+            AWSDateWriteDigits(bytes + 11, components.minute, 2);
+            AWSDateWriteDigits(bytes + 13, components.second, 2);
+            bytes[15] = 'Z';
+            length = 16;
+            break;
+        case AWSDateFixedFormatShortDate1:
+            AWSDateWriteDigits(bytes, components.year, 4);
+            AWSDateWriteDigits(bytes + 4, components.month, 2);
+            AWSDateWriteDigits(bytes + 6, components.day, 2);
+            length = 8;
+            break;
+        case AWSDateFixedFormatShortDate2:
+            AWSDateWriteDigits(bytes, components.year, 4);
+            bytes[4] = '-';
+            AWSDateWriteDigits(bytes + 5, components.month, 2);
+            bytes[7] = '-';
+            AWSDateWriteDigits(bytes + 8, components.day, 2);
+            length = 10;
+            break;
+        default:
+            return nil;
+    }
+
+    return [[NSString alloc] initWithBytes:bytes
+                                    length:length
+                                  encoding:NSASCIIStringEncoding];
+}
+
+// The last string each format was written as, and its second. The signer writes the date of a request in two formats,
+// and requests sent within the same second share it.
+static NSString *_fixedFormatStrings[AWSDateFixedFormatCount];
+static int64_t _fixedFormatSeconds[AWSDateFixedFormatCount];
+// Held for a load or a store only, so it is never contended for long.
+static os_unfair_lock _fixedFormatLock = OS_UNFAIR_LOCK_INIT;
+
+static NSString *AWSDateCachedFixedFormatString(NSDate *date, AWSDateFixedFormat format) {
+    int64_t milliseconds = 0;
+    if (!AWSDateMillisecondsSince1970(date, &milliseconds)) {
+        return nil;
+    }
+    if (format == AWSDateFixedFormatISO8601Date3) {
+        return AWSDateFixedFormatString(milliseconds, format);
+    }
+
+    int64_t seconds = AWSDateFloorDivide(milliseconds, 1000);
+    NSString *string = nil;
+    os_unfair_lock_lock(&_fixedFormatLock);
+    if (_fixedFormatSeconds[format] == seconds) {
+        string = _fixedFormatStrings[format];
+    }
+    os_unfair_lock_unlock(&_fixedFormatLock);
+    if (string) {
+        return string;
+    }
+
+    string = AWSDateFixedFormatString(milliseconds, format);
+    if (string) {
+        os_unfair_lock_lock(&_fixedFormatLock);
+        _fixedFormatStrings[format] = string;
+        _fixedFormatSeconds[format] = seconds;
+        os_unfair_lock_unlock(&_fixedFormatLock);
+    }
+    return string;
+}
+
 @interface AWSCategory : NSObject
 
 + (void)loadCategories;
@@ -55,6 +428,18 @@ static NSTimeInterval _clockskew = 0.0;
 }
 
 + (NSDate *)aws_dateFromString:(NSString *)string {
+    // Only one of the formats can match a string exactly.
+    AWSDateFixedFormat formats[] = {AWSDateFixedFormatRFC822Date1,
+                                    AWSDateFixedFormatISO8601Date1,
+                                    AWSDateFixedFormatISO8601Date2,
+                                    AWSDateFixedFormatISO8601Date3};
+    for (NSUInteger index = 0; index < sizeof(formats) / sizeof(formats[0]); index++) {
+        NSDate *date = AWSDateFromFixedFormatString(string, formats[index]);
+        if (date) {
+            return date;
+        }
+    }
+
     NSDate *parsedDate = nil;
     NSArray *arrayOfDateFormat = @[AWSDateRFC822DateFormat1,
                                    AWSDateISO8601DateFormat1,
@@ -73,6 +458,14 @@ static NSTimeInterval _clockskew = 0.0;
 }
 
 + (NSDate *)aws_dateFromString:(NSString *)string format:(NSString *)dateFormat {
+    AWSDateFixedFormat format = AWSDateFixedFormatForString(dateFormat);
+    if (format != AWSDateFixedFormatUnknown) {
+        NSDate *date = AWSDateFromFixedFormatString(string, format);
+        if (date) {
+            return date;
+        }
+    }
+
     if ([dateFormat isEqualToString:AWSDateRFC822DateFormat1]) {
         return [[NSDate aws_RFC822Date1Formatter] dateFromString:string];
     }
@@ -101,6 +494,14 @@ static NSTimeInterval _clockskew = 0.0;
 }
 
 - (NSString *)aws_stringValue:(NSString *)dateFormat {
+    AWSDateFixedFormat format = AWSDateFixedFormatForString(dateFormat);
+    if (format != AWSDateFixedFormatUnknown) {
+        NSString *string = AWSDateCachedFixedFormatString(self, format);
+        if (string) {
+            return string;
+        }
+    }
+
     if ([dateFormat isEqualToString:AWSDateRFC822DateFormat1]) {
         return [[NSDate aws_RFC822Date1Formatter] stringFromDate:self];
     }
@@ -233,21 +634,31 @@ static NSTimeInterval _clockskew = 0.0;
 }
 
 - (NSDictionary *)aws_recursivelyRemoveNullEntries:(NSDictionary *)inputDictionary {
-    
-    NSMutableDictionary *resultMutableDictionary = [NSMutableDictionary new];
-    
+    // Nothing is copied until a null is found, so a dictionary without nulls is returned as it is.
+    NSMutableDictionary *resultMutableDictionary = nil;
+
     for (NSString *key in inputDictionary) {
         id value = inputDictionary[key];
+        id resultValue = value;
         if ([value isEqual:[NSNull null]]) {
+            resultValue = nil;
+        } else if ([value isKindOfClass:[NSDictionary class]]) {
+            resultValue = [self aws_recursivelyRemoveNullEntries:value];
+        }
+        if (resultValue == value) {
             continue;
         }
-        if([value isKindOfClass:[NSDictionary class]]) {
-            [resultMutableDictionary setObject:[self aws_recursivelyRemoveNullEntries:value] forKey:key];
+
+        if (!resultMutableDictionary) {
+            resultMutableDictionary = [inputDictionary mutableCopy];
+        }
+        if (resultValue) {
+            [resultMutableDictionary setObject:resultValue forKey:key];
         } else {
-            [resultMutableDictionary setObject:value forKey:key];
+            [resultMutableDictionary removeObjectForKey:key];
         }
     }
-    return resultMutableDictionary;
+    return resultMutableDictionary ?: inputDictionary;
 }
 
 -(id) aws_objectForCaseInsensitiveKey:(id)aKey {
@@ -390,39 +801,21 @@ static NSTimeInterval _clockskew = 0.0;
 }
 
 - (NSString *)aws_stringWithURLEncoding {
-#pragma clang diagnostic push
-#pragma clang diagnostic ignored "-Wdeprecated-declarations"
-    return (NSString *)CFBridgingRelease(CFURLCreateStringByAddingPercentEscapes(kCFAllocatorDefault,
-                                                                                 (__bridge CFStringRef)[self aws_decodeURLEncoding],
-                                                                                 NULL,
-                                                                                 (CFStringRef)@"!*'\();:@&=+$,/?%#[] ",
-                                                                                 kCFStringEncodingUTF8));
-#pragma clang diagnostic pop
+    return AWSPercentEncodedString([self aws_decodeURLEncoding], AWSPercentEncodingSetQuery);
 }
 
 - (NSString *)aws_stringWithURLEncodingPath {
-#pragma clang diagnostic push
-#pragma clang diagnostic ignored "-Wdeprecated-declarations"
-    return (NSString *)CFBridgingRelease(CFURLCreateStringByAddingPercentEscapes(kCFAllocatorDefault,
-                                                                                 (__bridge CFStringRef)[self aws_decodeURLEncoding],
-                                                                                 NULL,
-                                                                                 (CFStringRef)@"!*'\();:@&=+$,?%#[] ",
-                                                                                 kCFStringEncodingUTF8));
-#pragma clang diagnostic pop
+    return AWSPercentEncodedString([self aws_decodeURLEncoding], AWSPercentEncodingSetPath);
 }
 
 - (NSString *)aws_stringWithURLEncodingPathWithoutPriorDecoding {
-#pragma clang diagnostic push
-#pragma clang diagnostic ignored "-Wdeprecated-declarations"
-    return (NSString *)CFBridgingRelease(CFURLCreateStringByAddingPercentEscapes(kCFAllocatorDefault,
-                                                                                 (__bridge CFStringRef)self,
-                                                                                 NULL,
-                                                                                 (CFStringRef)@"!*'\();:@&=+$,?%#[] ",
-                                                                                 kCFStringEncodingUTF8));
-#pragma clang diagnostic pop
+    return AWSPercentEncodedString(self, AWSPercentEncodingSetPath);
 }
 
 - (NSString *)aws_decodeURLEncoding {
+    if ([self rangeOfString:@"%"].location == NSNotFound) {
+        return self;
+    }
     NSString *result = [self stringByRemovingPercentEncoding];
     return result?result:self;
 }
@@ -613,6 +1006,14 @@ static NSTimeInterval _clockskew = 0.0;
 
 @end
 
+@implementation NSMutableString (AWS)
+
+- (void)aws_appendStringWithURLEncoding:(NSString *)string {
+    AWSAppendPercentEncodedString(self, [string aws_decodeURLEncoding], AWSPercentEncodingSetQuery);
+}
+
+@end
+
 @implementation NSFileManager (AWS)
 
 - (BOOL)aws_atomicallyCopyItemAtURL:(NSURL *)sourceURL
@@ -0,0 +1,78 @@
+//
+// Copyright 2010-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ The characters a percent encoding leaves as they are.
+ */
+typedef NS_ENUM(NSUInteger, AWSPercentEncodingSet) {
+    /**
+     The unreserved characters of RFC 3986: `A-Z a-z 0-9 - _ . ~`. For query keys and values.
+     */
+    AWSPercentEncodingSetQuery = 1 << 0,
+    /**
+     The unreserved characters and `/`. For paths.
+     */
+    AWSPercentEncodingSetPath = 1 << 1,
+};
+
+/**
+ The size of the output buffer `AWSPercentEncodeBytes` needs at most for `length` bytes.
+ */
+#define AWSPercentEncodedMaximumLength(length) ((length) * 3)
+
+/**
+ The size of the output buffer `AWSHexEncodeBytes` needs for `length` bytes.
+ */
+#define AWSHexEncodedLength(length) ((length) * 2)
+
+/**
+ Returns the index of the first of the UTF-8 `bytes` that has to be escaped, or `length` if there is none.
+ */
+FOUNDATION_EXPORT NSUInteger AWSPercentEncodingFirstEscapedIndex(const uint8_t *bytes, NSUInteger length, AWSPercentEncodingSet set);
+
+/**
+ Percent-encodes the UTF-8 `bytes` into `output`, with upper case hex digits, and returns the number of bytes written.
+ `output` must hold `AWSPercentEncodedMaximumLength(length)` bytes. It is not NUL-terminated.
+ */
+FOUNDATION_EXPORT NSUInteger AWSPercentEncodeBytes(const uint8_t *bytes, NSUInteger length, AWSPercentEncodingSet set, char *output);
+
+/**
+ Writes `bytes` as lower case hex digits into `output`, which must hold `AWSHexEncodedLength(length)` bytes. It is
+ not NUL-terminated.
+ */
+FOUNDATION_EXPORT void AWSHexEncodeBytes(const uint8_t *bytes, NSUInteger length, char *output);
+
+/**
+ Returns the string percent-encoded as UTF-8, or `nil` if it is not valid Unicode. Returns an immutable copy of the
+ string if nothing has to be escaped.
+ */
+FOUNDATION_EXPORT NSString * _Nullable AWSPercentEncodedString(NSString *string, AWSPercentEncodingSet set);
+
+/**
+ Appends the string percent-encoded as UTF-8 to `mutableString`, without creating the encoded string. Returns `NO`,
+ and appends nothing, if the string is not valid Unicode.
+ */
+FOUNDATION_EXPORT BOOL AWSAppendPercentEncodedString(NSMutableString *mutableString, NSString *string, AWSPercentEncodingSet set);
+
+/**
+ Returns the bytes of the data as lower case hex digits.
+ */
+FOUNDATION_EXPORT NSString *AWSHexEncodedString(NSData * _Nullable data);
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,185 @@
+//
+// Copyright 2010-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import "AWSEncoding.h"
+
+// Strings of up to this many UTF-8 bytes are converted and encoded on the stack.
+static const NSUInteger AWSEncodingStackBufferSize = 256;
+
+// The sets each byte is left as it is by. Bytes from 0x80 on are parts of multi-byte UTF-8 sequences and always escaped.
+static const uint8_t AWSPercentEncodingUnescapedSets[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // 0x00
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // 0x10
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 2, // 0x20
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, // 0x30
+    0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, // 0x40
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 3, // 0x50
+    0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, // 0x60
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 3, 0, // 0x70
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // 0x80
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // 0x90
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // 0xA0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // 0xB0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // 0xC0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // 0xD0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // 0xE0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // 0xF0
+};
+
+static const char AWSEncodingUpperCaseHexDigits[16] = {'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F'};
+static const char AWSEncodingLowerCaseHexDigits[16] = {'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f'};
+
+NSUInteger AWSPercentEncodingFirstEscapedIndex(const uint8_t *bytes, NSUInteger length, AWSPercentEncodingSet set) {
+    NSUInteger index = 0;
+    while (index < length && (AWSPercentEncodingUnescapedSets[bytes[index]] & set)) {
+        index++;
+    }
+    return index;
+}
+
+NSUInteger AWSPercentEncodeBytes(const uint8_t *bytes, NSUInteger length, AWSPercentEncodingSet set, char *output) {
+    char *start = output;
+    NSUInteger index = 0;
+    while (index < length) {
+        // Copies each run of bytes that are left as they are at once.
+        NSUInteger runLength = AWSPercentEncodingFirstEscapedIndex(bytes + index, length - index, set);
+        memcpy(output, bytes + index, runLength);
+        output += runLength;
+        index += runLength;
+
+        if (index < length) {
+            uint8_t byte = bytes[index++];
+            *output++ = '%';
+            *output++ = AWSEncodingUpperCaseHexDigits[byte >> 4];
+            *output++ = AWSEncodingUpperCaseHexDigits[byte & 0x0F];
+        }
+    }
+
+    return output - start;
+}
+
+void AWSHexEncodeBytes(const uint8_t *bytes, NSUInteger length, char *output) {
+    for (NSUInteger index = 0; index < length; index++) {
+        output[index * 2] = AWSEncodingLowerCaseHexDigits[bytes[index] >> 4];
+        output[index * 2 + 1] = AWSEncodingLowerCaseHexDigits[bytes[index] & 0x0F];
+    }
+}
+
+// Returns the UTF-8 bytes of the string, in place if it is stored as ASCII, converted into `buffer` if they fit and into
+// `*data` otherwise. Returns `NULL` if the string is not valid Unicode.
+static const uint8_t *AWSEncodingUTF8Bytes(NSString *string, uint8_t *buffer, NSUInteger bufferSize, NSData *__autoreleasing *data, NSUInteger *length) {
+    CFStringRef cfString = (__bridge CFStringRef)string;
+    CFIndex stringLength = CFStringGetLength(cfString);
+
+    const char *characters = CFStringGetCStringPtr(cfString, kCFStringEncodingASCII);
+    if (characters) {
+        *length = stringLength;
+        return (const uint8_t *)characters;
+    }
+
+    CFIndex byteLength = 0;
+    CFIndex convertedLength = CFStringGetBytes(cfString, CFRangeMake(0, stringLength), kCFStringEncodingUTF8, 0, false, buffer, bufferSize, &byteLength);
+    if (convertedLength == stringLength) {
+        *length = byteLength;
+        return buffer;
+    }
+
+    // Too long for the buffer, or an unpaired surrogate that cannot be converted.
+    *data = [string dataUsingEncoding:NSUTF8StringEncoding];
+    *length = [*data length];
+    return [*data bytes];
+}
+
+// Passes the encoded bytes, NUL-terminated, to `block`, or the bytes of the string if nothing has to be escaped.
+// Returns `NO` if the string is not valid Unicode.
+static BOOL AWSEncodingPercentEncode(NSString *string, AWSPercentEncodingSet set, void (^block)(const char *bytes, NSUInteger length, BOOL escaped)) {
+    uint8_t buffer[AWSEncodingStackBufferSize];
+    NSData *data = nil;
+    NSUInteger length = 0;
+    const uint8_t *bytes = AWSEncodingUTF8Bytes(string, buffer, sizeof(buffer), &data, &length);
+    if (!bytes) {
+        return NO;
+    }
+
+    if (AWSPercentEncodingFirstEscapedIndex(bytes, length, set) == length) {
+        block((const char *)bytes, length, NO);
+        return YES;
+    }
+
+    char outputBuffer[AWSPercentEncodedMaximumLength(AWSEncodingStackBufferSize) + 1];
+    char *output = outputBuffer;
+    if (AWSPercentEncodedMaximumLength(length) + 1 > sizeof(outputBuffer)) {
+        output = malloc(AWSPercentEncodedMaximumLength(length) + 1);
+        if (output == NULL) {
+            // this situation is irrecoverable and we don't want to return something corrupted, so we raise an exception
+            [NSException raise:@"NSInternalInconsistencyException" format:@"failed malloc" arguments:nil];
+        }
+    }
+
+    NSUInteger outputLength = AWSPercentEncodeBytes(bytes, length, set, output);
+    output[outputLength] = '\0';
+    block(output, outputLength, YES);
+
+    if (output != outputBuffer) {
+        free(output);
+    }
+    return YES;
+}
+
+NSString *AWSPercentEncodedString(NSString *string, AWSPercentEncodingSet set) {
+    __block NSString *encodedString = nil;
+    AWSEncodingPercentEncode(string, set, ^(const char *bytes, NSUInteger length, BOOL escaped) {
+        encodedString = escaped ? [[NSString alloc] initWithBytes:bytes length:length encoding:NSASCIIStringEncoding] : [string copy];
+    });
+
+    return encodedString;
+}
+
+BOOL AWSAppendPercentEncodedString(NSMutableString *mutableString, NSString *string, AWSPercentEncodingSet set) {
+    return AWSEncodingPercentEncode(string, set, ^(const char *bytes, NSUInteger length, BOOL escaped) {
+        if (escaped) {
+            CFStringAppendCString((__bridge CFMutableStringRef)mutableString, bytes, kCFStringEncodingASCII);
+        } else {
+            [mutableString appendString:string];
+        }
+    });
+}
+
+NSString *AWSHexEncodedString(NSData *data) {
+    NSUInteger length = [data length];
+    if (length == 0) {
+        return @"";
+    }
+
+    char outputBuffer[AWSHexEncodedLength(AWSEncodingStackBufferSize)];
+    char *output = outputBuffer;
+    if (AWSHexEncodedLength(length) > sizeof(outputBuffer)) {
+        output = malloc(AWSHexEncodedLength(length));
+        if (output == NULL) {
+            // this situation is irrecoverable and we don't want to return something corrupted, so we raise an exception
+            [NSException raise:@"NSInternalInconsistencyException" format:@"failed malloc" arguments:nil];
+        }
+    }
+
+    AWSHexEncodeBytes([data bytes], length, output);
+    NSString *hexString = [[NSString alloc] initWithBytes:output
+                                                   length:AWSHexEncodedLength(length)
+                                                 encoding:NSASCIIStringEncoding];
+
+    if (output != outputBuffer) {
+        free(output);
+    }
+    return hexString;
+}
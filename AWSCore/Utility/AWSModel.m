@@ -22,16 +22,17 @@
 }
 
 - (NSDictionary *)dictionaryValue {
-    NSDictionary *dictionaryValue = [super dictionaryValue];
-    NSMutableDictionary *mutableDictionaryValue = [dictionaryValue mutableCopy];
-
-    [dictionaryValue enumerateKeysAndObjectsUsingBlock:^(id key, id obj, BOOL *stop) {
-        if ([self valueForKey:key] == nil) {
-            [mutableDictionaryValue removeObjectForKey:key];
+    // Built in one pass, leaving out the nil properties, instead of copying the NSNull-filled dictionary of the superclass.
+    NSSet *propertyKeys = [[self class] propertyKeys];
+    NSMutableDictionary *dictionaryValue = [NSMutableDictionary dictionaryWithCapacity:[propertyKeys count]];
+    for (NSString *key in propertyKeys) {
+        id value = [self valueForKey:key];
+        if (value) {
+            dictionaryValue[key] = value;
         }
-    }];
+    }
 
-    return mutableDictionaryValue;
+    return dictionaryValue;
 }
 
 @end
@@ -18,6 +18,8 @@
 @interface AWSSynchronizedMutableDictionary()
 
 @property (nonatomic, strong) NSMutableDictionary *dictionary;
+// Maps each stored object (by identity) to the keys it is stored under, so `removeObject:` does not scan.
+@property (nonatomic, strong) NSMapTable<id, NSMutableSet *> *keysForObjects;
 @property (nonatomic, strong) dispatch_queue_t dispatchQueue;
 
 @end
@@ -27,7 +29,11 @@
 - (instancetype)init {
     if (self = [super init]) {
         _dictionary = [NSMutableDictionary new];
-        _dispatchQueue = dispatch_queue_create("com.amazonaws.AWSSynchronizedMutableDictionary", DISPATCH_QUEUE_SERIAL);
+        _keysForObjects = [[NSMapTable alloc] initWithKeyOptions:NSPointerFunctionsStrongMemory | NSPointerFunctionsObjectPointerPersonality
+                                                    valueOptions:NSPointerFunctionsStrongMemory
+                                                        capacity:0];
+        // Reads run concurrently; mutations are submitted as barriers so they run exclusively.
+        _dispatchQueue = dispatch_queue_create("com.amazonaws.AWSSynchronizedMutableDictionary", DISPATCH_QUEUE_CONCURRENT);
     }
 
     return self;
@@ -44,14 +50,23 @@
 }
 
 - (void)removeObjectForKey:(id)aKey {
-    dispatch_sync(self.dispatchQueue, ^{
-        [self.dictionary removeObjectForKey:aKey];
+    dispatch_barrier_sync(self.dispatchQueue, ^{
+        [self unsafeRemoveObjectForKey:aKey];
     });
 }
 
 - (void)setObject:(id)anObject forKey:(id <NSCopying>)aKey {
-    dispatch_sync(self.dispatchQueue, ^{
+    dispatch_barrier_sync(self.dispatchQueue, ^{
+        [self unsafeRemoveObjectForKey:aKey];
         [self.dictionary setObject:anObject forKey:aKey];
+
+        NSMutableSet *keys = [self.keysForObjects objectForKey:anObject];
+        if (!keys) {
+            keys = [NSMutableSet new];
+            [self.keysForObjects setObject:keys forKey:anObject];
+        }
+        // Store the key as copied by the dictionary so both collections agree on it.
+        [keys addObject:[aKey copyWithZone:nil]];
     });
 }
 
@@ -64,14 +79,29 @@
 }
 
 - (void)removeObject:(id)object {
-    dispatch_sync(self.dispatchQueue, ^{
-        for (NSString *key in self.dictionary) {
-            if (object == self.dictionary[key]) {
-                [self.dictionary removeObjectForKey:key];
-                break;
-            }
+    dispatch_barrier_sync(self.dispatchQueue, ^{
+        id key = [[self.keysForObjects objectForKey:object] anyObject];
+        if (key) {
+            [self unsafeRemoveObjectForKey:key];
         }
     });
 }
 
+#pragma mark - Helpers
+
+// Must be called on `dispatchQueue` inside a barrier.
+- (void)unsafeRemoveObjectForKey:(id)aKey {
+    id object = [self.dictionary objectForKey:aKey];
+    if (!object) {
+        return;
+    }
+
+    NSMutableSet *keys = [self.keysForObjects objectForKey:object];
+    [keys removeObject:aKey];
+    if ([keys count] == 0) {
+        [self.keysForObjects removeObjectForKey:object];
+    }
+    [self.dictionary removeObjectForKey:aKey];
+}
+
 @end
@@ -49,9 +49,10 @@
 - (void) writeProcessingInstruction:(NSString*)target data:(NSString*)data;
 - (void) writeCData:(NSString*)cdata;
 
-// return the written xml string buffer
+// return the written xml as a string
 - (NSMutableString*) toString;
 // return the written xml as data, set to the encoding used in the writeStartDocumentWithEncodingAndVersion method (UTF-8 per default)
+// the UTF-8 output buffer is returned as it is, without a copy
 - (NSData*) toData;
 
 // flush the buffers, if any
@@ -87,8 +88,10 @@
 
 @interface AWSXMLWriter : NSObject <AWSNSXMLStreamWriter> {
 		
-	// the current output buffer
-	NSMutableString* writer;
+	// the current output buffer, UTF-8 encoded
+	NSMutableData* buffer;
+	// has the buffer been returned by toData, i.e. must it be copied before it is written to again
+	BOOL bufferShared;
 	
 	// the target encoding
 	NSString* encoding;
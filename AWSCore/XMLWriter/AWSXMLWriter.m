@@ -46,10 +46,17 @@
 - (void) writeCloseElement:(BOOL)empty;
 // write namespace attribute to stream
 - (void) writeNamespaceToStream:(NSString*)prefix namespaceURI:(NSString*)namespaceURI;
-// write a length of text to the stream with escaping
-- (void) writeEscapeCharacters:(const UniChar*)characters length:(NSUInteger)length;
+// write the UTF-8 bytes of a string to the stream, optionally with escaping
+- (void) writeString:(NSString*)value escape:(BOOL)escape;
+// write a length of UTF-8 bytes to the stream with escaping
+- (void) writeEscapeBytes:(const UInt8*)bytes length:(NSUInteger)length;
+// append a length of UTF-8 bytes to the output buffer
+- (void) appendBytes:(const void*)bytes length:(NSUInteger)length;
 @end
 
+// the number of bytes converted at a time from strings which are not stored as ASCII
+static const CFIndex AWSXMLWriterConversionBufferSize = 256;
+
 
 static NSString *const EMPTY_STRING = @"";
 static NSString *const XML_NAMESPACE_URI = @"http://www.w3.org/XML/1998/namespace";
@@ -67,7 +74,7 @@ static NSString *const XSI_NAMESPACE_URI_PREFIX = @"xsi";
 	self = [super init];
 	if (self != nil) {
 		// intialize variables
-		writer = [[NSMutableString alloc] init];
+		buffer = [[NSMutableData alloc] init];
 		level = 0;
 		openElement = NO;
 		emptyElement = NO;
@@ -223,7 +230,7 @@ static NSString *const XSI_NAMESPACE_URI_PREFIX = @"xsi";
 }
 
 - (void) writeStartDocumentWithEncodingAndVersion:(NSString*)aEncoding version:(NSString*)version {
-	if([writer length] != 0) {
+	if([buffer length] != 0) {
 		// raise exception - Starting document which is not empty
 		@throw([NSException exceptionWithName:@"XMLWriterException" reason:@"Document has already been started" userInfo:NULL]);
 	} else {
@@ -559,153 +566,120 @@ static NSString *const XSI_NAMESPACE_URI_PREFIX = @"xsi";
 }
 
 - (void) write:(NSString*)value {
-	[writer appendString:value];
+	[self writeString:value escape:NO];
 }
 
 - (void) writeEscape:(NSString*)value {
+	[self writeString:value escape:YES];
+}
 
-	const UniChar *characters = CFStringGetCharactersPtr((CFStringRef)value);
+- (void) writeString:(NSString*)value escape:(BOOL)escape {
+	CFStringRef string = (__bridge CFStringRef)value;
+	CFIndex length = CFStringGetLength(string);
 
+	const char *characters = CFStringGetCStringPtr(string, kCFStringEncodingASCII);
 	if (characters) {
-		// main flow
-		[self writeEscapeCharacters:characters length:[value length]];
-	} else {
-		// we need to read/copy the characters for some reason, from the docs of CFStringGetCharactersPtr:
-		// A pointer to a buffer of Unicode character or NULL if the internal storage of the CFString does not allow this to be returned efficiently.
-		// Whether or not this function returns a valid pointer or NULL depends on many factors, all of which depend on how the string was created and its properties. In addition, the function result might change between different releases and on different platforms. So do not count on receiving a non- NULL result from this function under any circumstances (except when the object is created with CFStringCreateMutableWithExternalCharactersNoCopy).
-
-		// we dont need the whole data length at once
-		NSMutableData *data = [NSMutableData dataWithLength:256 * sizeof(UniChar)];
-
-		if(!data) {
-			// raise exception - no more memory
-			@throw([NSException exceptionWithName:@"XMLWriterException" reason:[NSString stringWithFormat:@"Could not allocate data buffer of %i unicode characters", 256] userInfo:NULL]);
+		// main flow: element names, numbers and most values are stored as ASCII, which is valid UTF-8
+		if (escape) {
+			[self writeEscapeBytes:(const UInt8*)characters length:length];
+		} else {
+			[self appendBytes:characters length:length];
+		}
+		return;
+	}
+
+	// convert to UTF-8 a part at a time, we dont need the whole data length at once
+	UInt8 bytes[AWSXMLWriterConversionBufferSize];
+	CFIndex location = 0;
+	while (location < length) {
+		CFIndex byteLength = 0;
+		CFIndex convertedLength = CFStringGetBytes(string, CFRangeMake(location, length - location), kCFStringEncodingUTF8, 0, false, bytes, sizeof(bytes), &byteLength);
+		if (convertedLength == 0) {
+			// invalid, such as an unpaired surrogate, skip
+			location++;
+			continue;
 		}
 
-		NSUInteger count = 0;
-		do {
-			NSUInteger length;
-			if(count + 256 < [value length]) {
-				length = 256;
-			} else {
-				length = [value length] - count;
-			}
-
-			[value getCharacters:[data mutableBytes] range:NSMakeRange(count, length)];
-
-			[self writeEscapeCharacters:[data bytes] length:length];
-
-			count += length;
-		} while(count < [value length]);
-
-		// buffers autorelease
-	}
-}
-
-- (void)writeEscapeCharacters:(const UniChar*)characters length:(NSUInteger)length {
-	int rangeStart = 0;
-	int rangeLength = 0;
-
-	for(int i = 0; i < length; i++) {
-
-		UniChar c = characters[i];
-		if (c <= 0xd7ff)  {
-			if (c >= 0x20) {
-				switch (c) {
-					case 34: {
-						// write range if any
-						if(rangeLength) {
-							CFStringAppendCharacters((CFMutableStringRef)writer, characters + rangeStart, rangeLength);
-						}
-						[self write:@"&quot;"];
-
-						break;
-					}
-						// quot
-					case 38: {
-						// write range if any
-						if(rangeLength) {
-							CFStringAppendCharacters((CFMutableStringRef)writer, characters + rangeStart, rangeLength);
-						}
-						[self write:@"&amp;"];
-
-						break;
-					}
-						// amp;
-					case 60: {
-						// write range if any
-						if(rangeLength) {
-							CFStringAppendCharacters((CFMutableStringRef)writer, characters + rangeStart, rangeLength);
-						}
-
-						[self write:@"&lt;"];
-
-						break;
-					}
-						// lt;
-					case 62: {
-						// write range if any
-						if(rangeLength) {
-							CFStringAppendCharacters((CFMutableStringRef)writer, characters + rangeStart, rangeLength);
-						}
-
-						[self write:@"&gt;"];
-
-						break;
-					}
-						// gt;
-					default: {
-						// valid
-						rangeLength++;
-
-						// note: we dont need to escape char 39 for &apos; because we use double quotes exclusively
-
-						continue;
-					}
+		if (escape) {
+			[self writeEscapeBytes:bytes length:byteLength];
+		} else {
+			[self appendBytes:bytes length:byteLength];
+		}
+		location += convertedLength;
+	}
+}
+
+- (void)writeEscapeBytes:(const UInt8*)bytes length:(NSUInteger)length {
+	NSUInteger rangeStart = 0;
+
+	for(NSUInteger i = 0; i < length; i++) {
+		UInt8 c = bytes[i];
+		const char *entity = NULL;
+		NSUInteger skippedLength = 0;
+
+		switch (c) {
+			case '"':
+				entity = "&quot;";
+				break;
+			case '&':
+				entity = "&amp;";
+				break;
+			case '<':
+				entity = "&lt;";
+				break;
+			case '>':
+				entity = "&gt;";
+				break;
+			case 0xEF:
+				// U+FFFE and U+FFFF are not xml characters, skip
+				if (i + 2 < length && bytes[i + 1] == 0xBF && (bytes[i + 2] == 0xBE || bytes[i + 2] == 0xBF)) {
+					skippedLength = 3;
 				}
-
-				// set range start to next
-				rangeLength = 0;
-				rangeStart = i + 1;
-
-			} else {
-				if (c == '\n' || c == '\r' || c == '\t') {
-					// valid;
-					rangeLength++;
-
-					continue;
-				} else {
-					// invalid, skip
+				break;
+			default:
+				// control characters other than tab and line breaks are not xml characters, skip
+				if (c < 0x20 && c != '\n' && c != '\r' && c != '\t') {
+					skippedLength = 1;
 				}
-			}
-		} else if (c < 0xE000) {
-			// invalid, skip
-		} else if (c <= 0xFFFD) {
-			// valid
-			rangeLength++;
+				break;
+		}
 
+		// note: we dont need to escape char 39 for &apos; because we use double quotes exclusively
+		if (!entity && !skippedLength) {
+			// valid
 			continue;
-		} else {
-			// invalid, skip
 		}
 
 		// write range if any
-		if(rangeLength) {
-			CFStringAppendCharacters((CFMutableStringRef)writer, characters + rangeStart, rangeLength);
+		if (i > rangeStart) {
+			[self appendBytes:bytes + rangeStart length:i - rangeStart];
 		}
 
-		// set range start to next
-		rangeLength = 0;
-		rangeStart = i + 1;
+		if (entity) {
+			[self appendBytes:entity length:strlen(entity)];
+			rangeStart = i + 1;
+		} else {
+			rangeStart = i + skippedLength;
+			i += skippedLength - 1;
+		}
 	}
 
 	// write range if any
-	if(rangeLength) {
-		// main flow will probably write all characters here
-		CFStringAppendCharacters((CFMutableStringRef)writer, characters + rangeStart, rangeLength);
+	if (length > rangeStart) {
+		// main flow will probably write all bytes here
+		[self appendBytes:bytes + rangeStart length:length - rangeStart];
 	}
 }
 
+- (void) appendBytes:(const void*)bytes length:(NSUInteger)length {
+	if(bufferShared) {
+		// the data returned by toData shares the buffer, so write on to a copy
+		buffer = [buffer mutableCopy];
+		bufferShared = NO;
+	}
+	[buffer appendBytes:bytes length:length];
+}
+
 - (void)writeLinebreak {
 	if(lineBreak) {
 		[self write:lineBreak];
@@ -729,15 +703,26 @@ static NSString *const XSI_NAMESPACE_URI_PREFIX = @"xsi";
 }
 
 - (NSMutableString*) toString {
-	return writer;
+	return [[NSMutableString alloc] initWithBytes:[buffer bytes] length:[buffer length] encoding:NSUTF8StringEncoding];
 }
 
 - (NSData*) toData {
 	if(encoding) {
-		return [writer dataUsingEncoding: CFStringConvertEncodingToNSStringEncoding(CFStringConvertIANACharSetNameToEncoding((CFStringRef)encoding)) allowLossyConversion:NO];
-	} else {
-		return [writer dataUsingEncoding:NSUTF8StringEncoding allowLossyConversion:NO];
+		NSStringEncoding stringEncoding = CFStringConvertEncodingToNSStringEncoding(CFStringConvertIANACharSetNameToEncoding((CFStringRef)encoding));
+		if (stringEncoding != NSUTF8StringEncoding) {
+			return [[self toString] dataUsingEncoding:stringEncoding allowLossyConversion:NO];
+		}
+	}
+	if([buffer length] == 0) {
+		return [NSData data];
 	}
+
+	// hand the buffer over without a copy, the data keeps it alive
+	NSMutableData *sharedBuffer = buffer;
+	bufferShared = YES;
+	return [[NSData alloc] initWithBytesNoCopy:[sharedBuffer mutableBytes] length:[sharedBuffer length] deallocator:^(void *bytes, NSUInteger length) {
+		(void)sharedBuffer;
+	}];
 }
 
 
@@ -44,4 +44,20 @@
     return retryType;
 }
 
+- (BOOL)isThrottlingError:(NSError *)error
+                 response:(NSHTTPURLResponse *)response {
+    if ([error.domain isEqualToString:AWSDynamoDBErrorDomain]) {
+        switch (error.code) {
+            case AWSDynamoDBErrorProvisionedThroughputExceeded:
+            case AWSDynamoDBErrorRequestLimitExceeded:
+                return YES;
+
+            default:
+                break;
+        }
+    }
+
+    return [super isThrottlingError:error response:response];
+}
+
 @end
@@ -16,6 +16,7 @@
 #import "AWSDynamoDBService.h"
 #import "AWSCategory.h"
 #import "AWSNetworking.h"
+#import "AWSNetworkingMetrics.h"
 #import "AWSCocoaLumberjack.h"
 #import "AWSService.h"
 #import "AWSURLRequestSerialization.h"
@@ -108,9 +109,12 @@ static NSDictionary *errorCodeDictionary = nil;
 
     if (!*error && [responseObject isKindOfClass:[NSDictionary class]]) {
         if (self.outputClass) {
+            AWSNetworkingRequestMetrics *metrics = [AWSNetworkingRequestMetrics currentMetrics];
+            [metrics beginPhase:AWSNetworkingRequestPhaseModelMapping];
             responseObject = [AWSMTLJSONAdapter modelOfClass:self.outputClass
                                           fromJSONDictionary:responseObject
                                                        error:error];
+            [metrics endPhase:AWSNetworkingRequestPhaseModelMapping];
         }
     }
 	
@@ -248,7 +252,8 @@ static AWSSynchronizedMutableDictionary *_serviceClients = nil;
         _configuration.requestInterceptors = @[baseInterceptor, signer];
 
         _configuration.baseURL = _configuration.endpoint.URL;
-        _configuration.retryHandler = [[AWSDynamoDBRequestRetryHandler alloc] initWithMaximumRetryCount:_configuration.maxRetryCount];
+        _configuration.retryHandler = [[AWSDynamoDBRequestRetryHandler alloc] initWithMaximumRetryCount:_configuration.maxRetryCount
+                                                                                              retryMode:_configuration.retryMode];
         _configuration.headers = @{@"Content-Type" : @"application/x-amz-json-1.0"}; 
 		
         _networking = [[AWSNetworking alloc] initWithConfiguration:_configuration];
@@ -270,8 +275,12 @@ static AWSSynchronizedMutableDictionary *_serviceClients = nil;
         }
 
         AWSNetworkingRequest *networkingRequest = request.internalRequest;
+        networkingRequest.metrics = [[AWSNetworkingRequestMetrics alloc] initWithServiceName:self.configuration.endpoint.serviceName
+                                                                               operationName:operationName];
         if (request) {
+            [networkingRequest.metrics beginPhase:AWSNetworkingRequestPhaseModelSerialization];
             networkingRequest.parameters = [[AWSMTLJSONAdapter JSONDictionaryFromModel:request] aws_removeNullValues];
+            [networkingRequest.metrics endPhase:AWSNetworkingRequestPhaseModelSerialization];
         } else {
             networkingRequest.parameters = @{};
         }
@@ -280,11 +289,17 @@ static AWSSynchronizedMutableDictionary *_serviceClients = nil;
         headers[@"X-Amz-Target"] = [NSString stringWithFormat:@"%@.%@", targetPrefix, operationName];
         networkingRequest.headers = headers;
         networkingRequest.HTTPMethod = HTTPMethod;
-        networkingRequest.requestSerializer = [[AWSJSONRequestSerializer alloc] initWithJSONDefinition:[[AWSDynamoDBResources sharedInstance] JSONObject]
-                                                                                                   actionName:operationName];
-        networkingRequest.responseSerializer = [[AWSDynamoDBResponseSerializer alloc] initWithJSONDefinition:[[AWSDynamoDBResources sharedInstance] JSONObject]
-                                                                                             actionName:operationName
-                                                                                            outputClass:outputClass];
+        networkingRequest.requestSerializer = [self requestSerializerForOperationName:operationName
+                                                                           usingBlock:^id<AWSURLRequestSerializer> {
+            return [[AWSJSONRequestSerializer alloc] initWithJSONDefinition:[[AWSDynamoDBResources sharedInstance] JSONObject]
+                                                                 actionName:operationName];
+        }];
+        networkingRequest.responseSerializer = [self responseSerializerForOperationName:operationName
+                                                                             usingBlock:^id<AWSHTTPURLResponseSerializer> {
+            return [[AWSDynamoDBResponseSerializer alloc] initWithJSONDefinition:[[AWSDynamoDBResources sharedInstance] JSONObject]
+                                                                      actionName:operationName
+                                                                     outputClass:outputClass];
+        }];
         
         return [self.networking sendRequest:networkingRequest];
     }
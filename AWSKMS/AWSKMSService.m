@@ -16,6 +16,7 @@
 #import "AWSKMSService.h"
 #import "AWSCategory.h"
 #import "AWSNetworking.h"
+#import "AWSNetworkingMetrics.h"
 #import "AWSCocoaLumberjack.h"
 #import "AWSService.h"
 #import "AWSURLRequestSerialization.h"
@@ -115,9 +116,12 @@ static NSDictionary *errorCodeDictionary = nil;
 
     if (!*error && [responseObject isKindOfClass:[NSDictionary class]]) {
         if (self.outputClass) {
+            AWSNetworkingRequestMetrics *metrics = [AWSNetworkingRequestMetrics currentMetrics];
+            [metrics beginPhase:AWSNetworkingRequestPhaseModelMapping];
             responseObject = [AWSMTLJSONAdapter modelOfClass:self.outputClass
                                           fromJSONDictionary:responseObject
                                                        error:error];
+            [metrics endPhase:AWSNetworkingRequestPhaseModelMapping];
         }
     }
 	
@@ -262,7 +266,8 @@ static AWSSynchronizedMutableDictionary *_serviceClients = nil;
         _configuration.requestInterceptors = @[baseInterceptor, signer];
 
         _configuration.baseURL = _configuration.endpoint.URL;
-        _configuration.retryHandler = [[AWSKMSRequestRetryHandler alloc] initWithMaximumRetryCount:_configuration.maxRetryCount];
+        _configuration.retryHandler = [[AWSKMSRequestRetryHandler alloc] initWithMaximumRetryCount:_configuration.maxRetryCount
+                                                                                         retryMode:_configuration.retryMode];
         _configuration.headers = @{@"Content-Type" : @"application/x-amz-json-1.1"}; 
 		
         _networking = [[AWSNetworking alloc] initWithConfiguration:_configuration];
@@ -284,8 +289,12 @@ static AWSSynchronizedMutableDictionary *_serviceClients = nil;
         }
 
         AWSNetworkingRequest *networkingRequest = request.internalRequest;
+        networkingRequest.metrics = [[AWSNetworkingRequestMetrics alloc] initWithServiceName:self.configuration.endpoint.serviceName
+                                                                               operationName:operationName];
         if (request) {
+            [networkingRequest.metrics beginPhase:AWSNetworkingRequestPhaseModelSerialization];
             networkingRequest.parameters = [[AWSMTLJSONAdapter JSONDictionaryFromModel:request] aws_removeNullValues];
+            [networkingRequest.metrics endPhase:AWSNetworkingRequestPhaseModelSerialization];
         } else {
             networkingRequest.parameters = @{};
         }
@@ -294,11 +303,17 @@ static AWSSynchronizedMutableDictionary *_serviceClients = nil;
         headers[@"X-Amz-Target"] = [NSString stringWithFormat:@"%@.%@", targetPrefix, operationName];
         networkingRequest.headers = headers;
         networkingRequest.HTTPMethod = HTTPMethod;
-        networkingRequest.requestSerializer = [[AWSJSONRequestSerializer alloc] initWithJSONDefinition:[[AWSKMSResources sharedInstance] JSONObject]
-                                                                                                   actionName:operationName];
-        networkingRequest.responseSerializer = [[AWSKMSResponseSerializer alloc] initWithJSONDefinition:[[AWSKMSResources sharedInstance] JSONObject]
-                                                                                             actionName:operationName
-                                                                                            outputClass:outputClass];
+        networkingRequest.requestSerializer = [self requestSerializerForOperationName:operationName
+                                                                           usingBlock:^id<AWSURLRequestSerializer> {
+            return [[AWSJSONRequestSerializer alloc] initWithJSONDefinition:[[AWSKMSResources sharedInstance] JSONObject]
+                                                                 actionName:operationName];
+        }];
+        networkingRequest.responseSerializer = [self responseSerializerForOperationName:operationName
+                                                                             usingBlock:^id<AWSHTTPURLResponseSerializer> {
+            return [[AWSKMSResponseSerializer alloc] initWithJSONDefinition:[[AWSKMSResources sharedInstance] JSONObject]
+                                                                 actionName:operationName
+                                                                outputClass:outputClass];
+        }];
         
         return [self.networking sendRequest:networkingRequest];
     }
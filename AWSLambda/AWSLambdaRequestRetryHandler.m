@@ -40,4 +40,20 @@
     return retryType;
 }
 
+- (BOOL)isThrottlingError:(NSError *)error
+                 response:(NSHTTPURLResponse *)response {
+    if ([error.domain isEqualToString:AWSLambdaErrorDomain]) {
+        switch (error.code) {
+            case AWSLambdaErrorTooManyRequests:
+            case AWSLambdaErrorEC2Throttled:
+                return YES;
+
+            default:
+                break;
+        }
+    }
+
+    return [super isThrottlingError:error response:response];
+}
+
 @end
@@ -25,7 +25,7 @@
 
 @interface AWSS3ResponseSerializer : NSObject <AWSHTTPURLResponseSerializer>
 
-@property (nonatomic, assign) Class outputClass;
+@property (nonatomic, assign, readonly) Class outputClass;
 
 - (instancetype)initWithJSONDefinition:(NSDictionary *)JSONDefinition
                             actionName:(NSString *)actionName
@@ -39,8 +39,8 @@
         _actionName = actionName;
         
         //get and put bucket policy use json, while rest use xml
-        if([[_actionName lowercaseString] isEqualToString:@"putbucketpolicy"]
-           || [[_actionName lowercaseString] isEqualToString:@"getbucketpolicy"]){
+        if([_actionName caseInsensitiveCompare:@"putbucketpolicy"] == NSOrderedSame
+           || [_actionName caseInsensitiveCompare:@"getbucketpolicy"] == NSOrderedSame){
             _requestSerializer = [[AWSJSONRequestSerializer alloc]initWithJSONDefinition:JSONDefinition actionName:actionName];
         }else{
             _requestSerializer = [[AWSXMLRequestSerializer alloc]initWithJSONDefinition:JSONDefinition actionName:actionName];
@@ -86,8 +86,8 @@
         _outputClass = outputClass;
         
         //get and put bucket policy use json, while rest use xml
-        if([[_actionName lowercaseString] isEqualToString:@"putbucketpolicy"]
-           || [[_actionName lowercaseString] isEqualToString:@"getbucketpolicy"]){
+        if([_actionName caseInsensitiveCompare:@"putbucketpolicy"] == NSOrderedSame
+           || [_actionName caseInsensitiveCompare:@"getbucketpolicy"] == NSOrderedSame){
             _responseSerializer = [[AWSJSONResponseSerializer alloc]initWithJSONDefinition:JSONDefinition actionName:actionName outputClass:outputClass];
         }else{
             _responseSerializer = [[AWSXMLResponseSerializer alloc]initWithJSONDefinition:JSONDefinition actionName:actionName outputClass:outputClass];
@@ -152,9 +152,12 @@ static NSDictionary *errorCodeDictionary = nil;
     
     if (!*error && [responseObject isKindOfClass:[NSDictionary class]]) {
         if (self.outputClass) {
+            AWSNetworkingRequestMetrics *metrics = [AWSNetworkingRequestMetrics currentMetrics];
+            [metrics beginPhase:AWSNetworkingRequestPhaseModelMapping];
             responseObject = [AWSMTLJSONAdapter modelOfClass:self.outputClass
                                           fromJSONDictionary:responseObject
                                                        error:error];
+            [metrics endPhase:AWSNetworkingRequestPhaseModelMapping];
         }
     }
     
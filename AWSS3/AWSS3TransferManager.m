@@ -360,6 +360,7 @@ static AWSSynchronizedMutableDictionary *_serviceClients = nil;
                 uploadPartRequest.partNumber = @(i);
                 uploadPartRequest.body = tempURL;
                 uploadPartRequest.contentLength = @(dataLength);
+                uploadPartRequest.priority = uploadRequest.priority;
                 uploadPartRequest.uploadId = output.uploadId?output.uploadId:uploadRequest.uploadId;
                 
                 //pass SSE Value
@@ -791,6 +792,7 @@ static AWSSynchronizedMutableDictionary *_serviceClients = nil;
 - (instancetype)init {
     if (self = [super init]) {
         _state = AWSS3TransferManagerRequestStateNotStarted;
+        self.priority = AWSNetworkingRequestPriorityBulk;
     }
 
     return self;
@@ -859,6 +861,7 @@ static AWSSynchronizedMutableDictionary *_serviceClients = nil;
 - (instancetype)init {
     if (self = [super init]) {
         _state = AWSS3TransferManagerRequestStateNotStarted;
+        self.priority = AWSNetworkingRequestPriorityBulk;
     }
 
     return self;
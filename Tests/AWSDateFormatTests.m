@@ -0,0 +1,165 @@
+//
+// Copyright 2010-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <XCTest/XCTest.h>
+#import <awsosx/awsosx.h>
+#import "AWSTestLoadGenerator.h"
+
+// 1583-01-01T00:00:00Z and 9999-12-31T23:59:59Z, the years the fixed formats are read and written by hand.
+static const int64_t AWSDateFuzzMinimumSeconds = -12212553600;
+static const int64_t AWSDateFuzzMaximumSeconds = 253402300799;
+static const NSUInteger AWSDateFuzzDateCount = 20000;
+static const NSUInteger AWSDateBenchmarkIterationCount = 20000;
+
+/**
+ Checks `aws_stringValue:` and `aws_dateFromString:format:` against an `NSDateFormatter` configured as in
+ `AWSCategory.m`, over random dates from 1583 to 9999.
+ */
+@interface AWSDateFormatTests : XCTestCase
+
+@end
+
+@implementation AWSDateFormatTests
+
+- (NSArray<NSString *> *)dateFormats {
+    return @[AWSDateRFC822DateFormat1,
+             AWSDateISO8601DateFormat1,
+             AWSDateISO8601DateFormat2,
+             AWSDateISO8601DateFormat3,
+             AWSDateShortDateFormat1,
+             AWSDateShortDateFormat2];
+}
+
+- (NSDateFormatter *)dateFormatterWithFormat:(NSString *)dateFormat {
+    NSDateFormatter *dateFormatter = [NSDateFormatter new];
+    dateFormatter.timeZone = [NSTimeZone timeZoneWithName:@"GMT"];
+    dateFormatter.locale = [NSLocale localeWithLocaleIdentifier:@"en_US_POSIX"];
+    dateFormatter.dateFormat = dateFormat;
+    return dateFormatter;
+}
+
+/**
+ Whole milliseconds for the format with milliseconds and whole seconds for the others, which the formatter would
+ otherwise round differently before 1970.
+ */
+- (NSArray<NSDate *> *)randomDatesWithMilliseconds:(BOOL)withMilliseconds {
+    srandom(1);
+    NSMutableArray<NSDate *> *dates = [NSMutableArray new];
+    for (NSUInteger i = 0; i < AWSDateFuzzDateCount; i++) {
+        uint64_t random64 = ((uint64_t)random() << 31) ^ (uint64_t)random();
+        int64_t seconds = AWSDateFuzzMinimumSeconds + (int64_t)(random64 % (uint64_t)(AWSDateFuzzMaximumSeconds - AWSDateFuzzMinimumSeconds + 1));
+        NSTimeInterval milliseconds = withMilliseconds ? random() % 1000 : 0;
+        [dates addObject:[NSDate dateWithTimeIntervalSince1970:seconds + milliseconds / 1000]];
+    }
+    return dates;
+}
+
+- (void)testFixedFormatsMatchNSDateFormatter {
+    for (NSString *dateFormat in [self dateFormats]) {
+        NSDateFormatter *dateFormatter = [self dateFormatterWithFormat:dateFormat];
+        BOOL withMilliseconds = [dateFormat isEqualToString:AWSDateISO8601DateFormat3];
+        NSUInteger mismatchCount = 0;
+        for (NSDate *date in [self randomDatesWithMilliseconds:withMilliseconds]) {
+            NSString *expectedString = [dateFormatter stringFromDate:date];
+            NSString *string = [date aws_stringValue:dateFormat];
+            if (![string isEqualToString:expectedString]) {
+                XCTFail(@"%@ wrote %@ as %@ instead of %@", dateFormat, date, string, expectedString);
+                mismatchCount++;
+            }
+
+            NSDate *expectedDate = [dateFormatter dateFromString:expectedString];
+            NSDate *parsedDate = [NSDate aws_dateFromString:expectedString format:dateFormat];
+            if (fabs([parsedDate timeIntervalSince1970] - [expectedDate timeIntervalSince1970]) > 0.0005) {
+                XCTFail(@"%@ read %@ as %@ instead of %@", dateFormat, expectedString, parsedDate, expectedDate);
+                mismatchCount++;
+            }
+            if (mismatchCount > 10) {
+                return;
+            }
+        }
+    }
+}
+
+- (void)testStringsWithinTheSameSecondAreCached {
+    NSDate *date = [NSDate dateWithTimeIntervalSince1970:1577836800.25];
+    NSString *string = [date aws_stringValue:AWSDateISO8601DateFormat2];
+    XCTAssertEqualObjects(string, @"20200101T000000Z");
+    XCTAssertEqual([[NSDate dateWithTimeIntervalSince1970:1577836800.75] aws_stringValue:AWSDateISO8601DateFormat2], string);
+    XCTAssertEqualObjects([[NSDate dateWithTimeIntervalSince1970:1577836801] aws_stringValue:AWSDateISO8601DateFormat2], @"20200101T000001Z");
+}
+
+#pragma mark - Benchmarks
+
+- (void)testThroughputBenchmark {
+    NSArray<NSDate *> *dates = [self randomDatesWithMilliseconds:NO];
+    for (NSString *dateFormat in [self dateFormats]) {
+        NSDateFormatter *dateFormatter = [self dateFormatterWithFormat:dateFormat];
+        NSMutableArray<NSString *> *strings = [NSMutableArray new];
+        for (NSDate *date in dates) {
+            [strings addObject:[dateFormatter stringFromDate:date]];
+        }
+
+        double formatterWrites = [AWSTestLoadGenerator callsPerSecondWithThreadCount:1
+                                                                      iterationCount:AWSDateBenchmarkIterationCount
+                                                                               block:^(NSUInteger thread, NSUInteger iteration) {
+            @autoreleasepool {
+                [dateFormatter stringFromDate:dates[iteration % [dates count]]];
+            }
+        }];
+        double writes = [AWSTestLoadGenerator callsPerSecondWithThreadCount:1
+                                                             iterationCount:AWSDateBenchmarkIterationCount
+                                                                      block:^(NSUInteger thread, NSUInteger iteration) {
+            @autoreleasepool {
+                [dates[iteration % [dates count]] aws_stringValue:dateFormat];
+            }
+        }];
+        double formatterReads = [AWSTestLoadGenerator callsPerSecondWithThreadCount:1
+                                                                     iterationCount:AWSDateBenchmarkIterationCount
+                                                                              block:^(NSUInteger thread, NSUInteger iteration) {
+            @autoreleasepool {
+                [dateFormatter dateFromString:strings[iteration % [strings count]]];
+            }
+        }];
+        double reads = [AWSTestLoadGenerator callsPerSecondWithThreadCount:1
+                                                            iterationCount:AWSDateBenchmarkIterationCount
+                                                                     block:^(NSUInteger thread, NSUInteger iteration) {
+            @autoreleasepool {
+                [NSDate aws_dateFromString:strings[iteration % [strings count]] format:dateFormat];
+            }
+        }];
+
+        NSLog(@"[benchmark] %@ %@: writes %.0f/s (NSDateFormatter %.0f/s), reads %.0f/s (NSDateFormatter %.0f/s)",
+              self.name, dateFormat, writes, formatterWrites, reads, formatterReads);
+    }
+}
+
+- (void)testCachedSecondBenchmark {
+    // As the signer does for every request: the current second, in two formats, from every thread that signs.
+    NSUInteger processorCount = [[NSProcessInfo processInfo] activeProcessorCount];
+    for (NSUInteger threadCount = 1; threadCount <= processorCount; threadCount *= 2) {
+        double callsPerSecond = [AWSTestLoadGenerator callsPerSecondWithThreadCount:threadCount
+                                                                     iterationCount:AWSDateBenchmarkIterationCount
+                                                                              block:^(NSUInteger thread, NSUInteger iteration) {
+            @autoreleasepool {
+                NSDate *date = [NSDate date];
+                [date aws_stringValue:AWSDateISO8601DateFormat2];
+                [date aws_stringValue:AWSDateShortDateFormat1];
+            }
+        }];
+        NSLog(@"[benchmark] %@ %2lu threads: %.0f calls/s", self.name, (unsigned long)threadCount, callsPerSecond);
+    }
+}
+
+@end
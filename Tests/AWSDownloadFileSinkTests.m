@@ -0,0 +1,135 @@
+//
+// Copyright 2010-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import "AWSStandInTestCase.h"
+
+static const unsigned long long AWSDownloadBenchmarkLength = 256 * 1024 * 1024;
+static const NSUInteger AWSDownloadBenchmarkRequestCount = 4;
+
+@interface AWSDownloadFileSinkTests : AWSStandInTestCase
+
+@property (nonatomic, strong) NSURL *directoryURL;
+
+@end
+
+@implementation AWSDownloadFileSinkTests
+
+- (void)setUp {
+    [super setUp];
+    self.directoryURL = [[NSURL fileURLWithPath:NSTemporaryDirectory()] URLByAppendingPathComponent:[[NSUUID UUID] UUIDString]];
+    [[NSFileManager defaultManager] createDirectoryAtURL:self.directoryURL withIntermediateDirectories:YES attributes:nil error:nil];
+}
+
+- (void)tearDown {
+    [[NSFileManager defaultManager] setAttributes:@{NSFilePosixPermissions : @0755} ofItemAtPath:self.directoryURL.path error:nil];
+    [[NSFileManager defaultManager] removeItemAtURL:self.directoryURL error:nil];
+    [super tearDown];
+}
+
+- (AWSS3 *)S3WithPayloadLength:(unsigned long long)payloadLength {
+    AWSTestStandInServer *server = [self startServerWithServiceDefinition:[[AWSS3Resources sharedInstance] JSONObject]];
+    ((AWSTestShapeResponder *)server.responder).payloadLength = payloadLength;
+    return [self S3WithConfiguration:[server serviceConfiguration]];
+}
+
+- (AWSS3GetObjectRequest *)getObjectRequestWithIndex:(NSUInteger)index {
+    AWSS3GetObjectRequest *request = [AWSS3GetObjectRequest new];
+    request.bucket = @"bucket";
+    request.key = [NSString stringWithFormat:@"object-%lu", (unsigned long)index];
+    return request;
+}
+
+- (void)testDirectWriteToAnUnwritableFileFails {
+    AWSS3 *S3 = [self S3WithPayloadLength:1024 * 1024];
+    [[NSFileManager defaultManager] setAttributes:@{NSFilePosixPermissions : @0555} ofItemAtPath:self.directoryURL.path error:nil];
+
+    AWSS3GetObjectRequest *request = [self getObjectRequestWithIndex:0];
+    request.downloadingFileURL = [self.directoryURL URLByAppendingPathComponent:@"object"];
+    // As AWSS3TransferManager does, so the body is written straight into the target file.
+    [request setValue:@YES forKey:@"shouldWriteDirectly"];
+    AWSTask *task = [S3 getObject:request];
+    [task waitUntilFinished];
+
+    XCTAssertEqualObjects(task.error.domain, NSPOSIXErrorDomain);
+    XCTAssertEqual(task.error.code, EACCES);
+    XCTAssertFalse([[NSFileManager defaultManager] fileExistsAtPath:request.downloadingFileURL.path]);
+}
+
+- (void)testDownloadToFile {
+    AWSS3 *S3 = [self S3WithPayloadLength:3 * 1024 * 1024 + 17];
+
+    AWSS3GetObjectRequest *request = [self getObjectRequestWithIndex:0];
+    request.downloadingFileURL = [self.directoryURL URLByAppendingPathComponent:@"object"];
+    [self resultOfTask:[S3 getObject:request]];
+
+    NSDictionary *attributes = [[NSFileManager defaultManager] attributesOfItemAtPath:request.downloadingFileURL.path error:nil];
+    XCTAssertEqual([attributes fileSize], 3 * 1024 * 1024 + 17);
+}
+
+#pragma mark - Benchmarks
+
+- (void)logThroughputOfReport:(AWSTestLoadReport *)report {
+    double megabytesPerSecond = report.requestsPerSecond * AWSDownloadBenchmarkLength / (1024 * 1024);
+    [self logBenchmark:@"%@, %.0f MB/s", report, megabytesPerSecond];
+    XCTAssertEqual(report.errorCount, 0);
+}
+
+- (void)testDownloadThroughputBenchmark {
+    AWSS3 *S3 = [self S3WithPayloadLength:AWSDownloadBenchmarkLength];
+
+    // The link itself: the body is only counted.
+    [self logThroughputOfReport:[AWSTestLoadGenerator runWithName:@"S3 GetObject 256 MB, discarded"
+                                                     requestCount:AWSDownloadBenchmarkRequestCount
+                                                      concurrency:1
+                                                        operation:^AWSTask *(NSUInteger index) {
+        AWSS3GetObjectRequest *request = [self getObjectRequestWithIndex:index];
+        request.responseDataHandler = ^(NSData *data) {
+        };
+        return [S3 getObject:request];
+    }]];
+
+    // As before the sink: every network chunk is written synchronously as it arrives.
+    [self logThroughputOfReport:[AWSTestLoadGenerator runWithName:@"S3 GetObject 256 MB, NSFileHandle per chunk"
+                                                     requestCount:AWSDownloadBenchmarkRequestCount
+                                                      concurrency:1
+                                                        operation:^AWSTask *(NSUInteger index) {
+        NSURL *fileURL = [self.directoryURL URLByAppendingPathComponent:[NSString stringWithFormat:@"handle-%lu", (unsigned long)index]];
+        [[NSFileManager defaultManager] createFileAtPath:fileURL.path contents:nil attributes:nil];
+        NSFileHandle *fileHandle = [NSFileHandle fileHandleForWritingToURL:fileURL error:nil];
+        AWSS3GetObjectRequest *request = [self getObjectRequestWithIndex:index];
+        request.responseDataHandler = ^(NSData *data) {
+            [fileHandle writeData:data];
+        };
+        return [[S3 getObject:request] continueWithBlock:^id(AWSTask *task) {
+            [fileHandle closeFile];
+            [[NSFileManager defaultManager] removeItemAtURL:fileURL error:nil];
+            return task;
+        }];
+    }]];
+
+    [self logThroughputOfReport:[AWSTestLoadGenerator runWithName:@"S3 GetObject 256 MB, file sink"
+                                                     requestCount:AWSDownloadBenchmarkRequestCount
+                                                      concurrency:1
+                                                        operation:^AWSTask *(NSUInteger index) {
+        AWSS3GetObjectRequest *request = [self getObjectRequestWithIndex:index];
+        request.downloadingFileURL = [self.directoryURL URLByAppendingPathComponent:[NSString stringWithFormat:@"sink-%lu", (unsigned long)index]];
+        return [[S3 getObject:request] continueWithBlock:^id(AWSTask *task) {
+            [[NSFileManager defaultManager] removeItemAtURL:request.downloadingFileURL error:nil];
+            return task;
+        }];
+    }]];
+}
+
+@end
@@ -0,0 +1,287 @@
+//
+// Copyright 2010-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <XCTest/XCTest.h>
+#import <awsosx/awsosx.h>
+#import "AWSTestLoadGenerator.h"
+
+static const NSUInteger AWSJSONBuilderBenchmarkIterationCount = 2000;
+
+@interface AWSJSONBuilderTests : XCTestCase
+
+@property (nonatomic, strong) NSDictionary *definition;
+
+@end
+
+@implementation AWSJSONBuilderTests
+
+- (void)setUp {
+    [super setUp];
+    NSString *JSONString = @"{\"operations\":{\"PutValue\":{\"input\":{\"shape\":\"PutValueInput\"}}},"
+    "\"shapes\":{\"PutValueInput\":{\"type\":\"structure\",\"members\":{\"Value\":{\"shape\":\"Value\"}}},"
+    "\"Value\":{\"type\":\"double\"}}}";
+    self.definition = [NSJSONSerialization JSONObjectWithData:[JSONString dataUsingEncoding:NSUTF8StringEncoding]
+                                                      options:0
+                                                        error:nil];
+}
+
+- (NSString *)JSONStringForValue:(NSNumber *)value {
+    NSError *error = nil;
+    NSData *data = [AWSJSONBuilder jsonDataForDictionary:@{@"Value" : value}
+                                              actionName:@"PutValue"
+                                   serviceDefinitionRule:self.definition
+                                                   error:&error];
+    XCTAssertNil(error);
+    return [[NSString alloc] initWithData:data encoding:NSUTF8StringEncoding];
+}
+
+- (void)testFloatsAreWrittenAtTheirOwnPrecision {
+    XCTAssertEqualObjects([self JSONStringForValue:@(0.1f)], @"{\"Value\":0.1}");
+    XCTAssertEqualObjects([self JSONStringForValue:@(1.5f)], @"{\"Value\":1.5}");
+    XCTAssertEqualObjects([self JSONStringForValue:@(1.0f / 3.0f)], @"{\"Value\":0.333333343}");
+    XCTAssertEqualObjects([self JSONStringForValue:@(16777216.0f)], @"{\"Value\":16777216}");
+}
+
+- (void)testDoublesAreWrittenAtTheirOwnPrecision {
+    XCTAssertEqualObjects([self JSONStringForValue:@(0.1)], @"{\"Value\":0.1}");
+    XCTAssertEqualObjects([self JSONStringForValue:@(1.0 / 3.0)], @"{\"Value\":0.33333333333333331}");
+}
+
+- (void)testFloatsReadBackAsTheSameFloat {
+    uint32_t seed = 1;
+    for (NSUInteger i = 0; i < 10000; i++) {
+        seed = seed * 1664525 + 1013904223;
+        float value;
+        memcpy(&value, &seed, sizeof(value));
+        if (isnan(value) || isinf(value)) {
+            continue;
+        }
+
+        NSString *JSONString = [self JSONStringForValue:@(value)];
+        NSString *number = [JSONString substringWithRange:NSMakeRange(9, [JSONString length] - 10)];
+        XCTAssertEqual(strtof([number UTF8String], NULL), value, @"%@", JSONString);
+    }
+}
+
+#pragma mark - Equivalence with NSJSONSerialization
+
+- (NSData *)DynamoDBBodyForRequest:(AWSRequest *)request
+                        actionName:(NSString *)actionName {
+    NSDictionary *parameters = [[AWSMTLJSONAdapter JSONDictionaryFromModel:request] aws_removeNullValues];
+    NSError *error = nil;
+    NSData *data = [AWSJSONBuilder jsonDataForDictionary:parameters
+                                              actionName:actionName
+                                   serviceDefinitionRule:[[AWSDynamoDBResources sharedInstance] JSONObject]
+                                                   error:&error];
+    XCTAssertNil(error);
+    return data;
+}
+
+- (NSArray<NSString *> *)strings {
+    NSMutableString *longString = [NSMutableString new];
+    for (NSUInteger i = 0; i < 200; i++) {
+        // Multi-byte characters and surrogate pairs straddle the boundaries of the writer's 256-byte chunks.
+        [longString appendString:@"ab\u00e9\U0001F600"];
+    }
+    return @[@"plain",
+             @"quote \" and backslash \\",
+             @"slash / path",
+             @"line\nbreak\ttab\rreturn",
+             @"\u0001 control \u001f",
+             @"caf\u00e9 \u4e2d\u6587",
+             @"emoji \U0001F600",
+             @"\u2028 separator",
+             longString];
+}
+
+- (AWSDynamoDBPutItemInput *)putItemInputWithStrings:(NSArray<NSString *> *)strings {
+    NSMutableDictionary<NSString *, AWSDynamoDBAttributeValue *> *item = [NSMutableDictionary new];
+    NSMutableArray<AWSDynamoDBAttributeValue *> *list = [NSMutableArray new];
+    [strings enumerateObjectsUsingBlock:^(NSString *string, NSUInteger index, BOOL *stop) {
+        AWSDynamoDBAttributeValue *value = [AWSDynamoDBAttributeValue new];
+        value.S = string;
+        item[[NSString stringWithFormat:@"s%lu", (unsigned long)index]] = value;
+        [list addObject:value];
+    }];
+    AWSDynamoDBAttributeValue *number = [AWSDynamoDBAttributeValue new];
+    number.N = @"-12.5e3";
+    AWSDynamoDBAttributeValue *boolean = [AWSDynamoDBAttributeValue new];
+    boolean.BOOLEAN = @YES;
+    AWSDynamoDBAttributeValue *nested = [AWSDynamoDBAttributeValue new];
+    nested.M = @{@"number" : number, @"boolean" : boolean};
+    AWSDynamoDBAttributeValue *listValue = [AWSDynamoDBAttributeValue new];
+    listValue.L = list;
+    item[@"nested"] = nested;
+    item[@"list"] = listValue;
+
+    AWSDynamoDBPutItemInput *request = [AWSDynamoDBPutItemInput new];
+    request.tableName = @"table";
+    request.item = item;
+    return request;
+}
+
+/**
+ The body written for a structure whose members need no renaming or formatting is what NSJSONSerialization produced
+ for the same dictionary before, apart from the `\/` NSJSONSerialization writes for a slash.
+ */
+- (void)testDynamoDBBodiesMatchNSJSONSerialization {
+    for (NSString *string in [self strings]) {
+        AWSDynamoDBPutItemInput *request = [self putItemInputWithStrings:@[string]];
+        request.item = @{@"id" : request.item[@"s0"]};
+        NSData *data = [self DynamoDBBodyForRequest:request
+                                         actionName:@"PutItem"];
+
+        NSDictionary *parameters = [[AWSMTLJSONAdapter JSONDictionaryFromModel:request] aws_removeNullValues];
+        NSData *previousData = [NSJSONSerialization dataWithJSONObject:parameters
+                                                               options:0
+                                                                 error:nil];
+        NSString *previousString = [[[NSString alloc] initWithData:previousData encoding:NSUTF8StringEncoding] stringByReplacingOccurrencesOfString:@"\\/"
+                                                                                                                                          withString:@"/"];
+        NSString *JSONString = [[NSString alloc] initWithData:data encoding:NSUTF8StringEncoding];
+        if ([JSONString isEqualToString:previousString]) {
+            continue;
+        }
+
+        // Both writers may escape control characters differently and order the two top-level keys differently.
+        XCTAssertEqualObjects([NSJSONSerialization JSONObjectWithData:data options:0 error:nil], parameters, @"%@", JSONString);
+    }
+
+    AWSDynamoDBPutItemInput *request = [self putItemInputWithStrings:[self strings]];
+    NSData *data = [self DynamoDBBodyForRequest:request
+                                     actionName:@"PutItem"];
+    NSDictionary *parameters = [[AWSMTLJSONAdapter JSONDictionaryFromModel:request] aws_removeNullValues];
+    XCTAssertEqualObjects([NSJSONSerialization JSONObjectWithData:data options:0 error:nil], parameters);
+}
+
+/**
+ Numbers are compared by value: floats are now written at float precision and doubles with the shortest of 15 or 17
+ digits that reads back, where NSJSONSerialization may have used other digits for the same number.
+ */
+- (void)testNumbersReadBackAsNSJSONSerializationWroteThem {
+    NSArray<NSNumber *> *numbers = @[@0, @(-1), @(INT32_MAX), @(INT64_MAX), @(UINT64_MAX),
+                                     @(0.1), @(1.0 / 3.0), @(1e300), @(-2.5e-8), @(5e-324),
+                                     @(0.1f), @(1.0f / 3.0f), @(3.4e38f), @(1e-45f)];
+    for (NSNumber *number in numbers) {
+        NSString *JSONString = [self JSONStringForValue:number];
+        NSData *previousData = [NSJSONSerialization dataWithJSONObject:@{@"Value" : number}
+                                                               options:0
+                                                                 error:nil];
+        if ([JSONString isEqualToString:[[NSString alloc] initWithData:previousData encoding:NSUTF8StringEncoding]]) {
+            continue;
+        }
+
+        NSNumber *value = [NSJSONSerialization JSONObjectWithData:[JSONString dataUsingEncoding:NSUTF8StringEncoding] options:0 error:nil][@"Value"];
+        NSNumber *previousValue = [NSJSONSerialization JSONObjectWithData:previousData options:0 error:nil][@"Value"];
+        if (strcmp([number objCType], @encode(float)) == 0) {
+            XCTAssertEqual([value floatValue], [previousValue floatValue], @"%@", JSONString);
+            XCTAssertEqual([value floatValue], [number floatValue], @"%@", JSONString);
+        } else {
+            XCTAssertEqualObjects(value, previousValue, @"%@", JSONString);
+        }
+    }
+}
+
+- (void)testLoneSurrogateDoesNotTruncateTheString {
+    unichar characters[] = {'a', 0xD800, 'b', 'c'};
+    AWSDynamoDBPutItemInput *request = [self putItemInputWithStrings:@[[NSString stringWithCharacters:characters length:4]]];
+    request.item = @{@"id" : request.item[@"s0"]};
+
+    NSData *data = [self DynamoDBBodyForRequest:request
+                                     actionName:@"PutItem"];
+    NSDictionary *JSONObject = [NSJSONSerialization JSONObjectWithData:data options:0 error:nil];
+    NSString *string = JSONObject[@"Item"][@"id"][@"S"];
+    XCTAssertEqual([string length], 4, @"%@", data);
+    XCTAssertTrue([string hasPrefix:@"a"]);
+    XCTAssertTrue([string hasSuffix:@"bc"]);
+    XCTAssertEqualObjects(JSONObject[@"TableName"], @"table");
+}
+
+#pragma mark - Benchmarks
+
+- (void)logAllocationsWithName:(NSString *)name
+                         block:(void (^)(void))block {
+    AWSTestAllocationCounter *allocations = [AWSTestAllocationCounter measure:^{
+        for (NSUInteger i = 0; i < AWSJSONBuilderBenchmarkIterationCount; i++) {
+            @autoreleasepool {
+                block();
+            }
+        }
+    }];
+    NSLog(@"[benchmark] %@ %@: %.1f allocations and %.0f bytes per call",
+          self.name,
+          name,
+          (double)allocations.allocationCount / AWSJSONBuilderBenchmarkIterationCount,
+          (double)allocations.allocatedBytes / AWSJSONBuilderBenchmarkIterationCount);
+}
+
+/**
+ Counts the allocations of serializing a 25-item BatchWriteItem body with the writer, and with the NSJSONSerialization
+ pass it replaced. SendMessageBatch goes through AWSQueryParamBuilder, which still builds dictionaries; it is measured
+ for reference.
+ */
+- (void)testBatchBodyAllocationBenchmark {
+    NSMutableArray<AWSDynamoDBWriteRequest *> *writeRequests = [NSMutableArray new];
+    for (NSUInteger i = 0; i < 25; i++) {
+        AWSDynamoDBPutItemInput *putItemInput = [self putItemInputWithStrings:@[[NSString stringWithFormat:@"item-%lu", (unsigned long)i], @"value"]];
+        AWSDynamoDBPutRequest *putRequest = [AWSDynamoDBPutRequest new];
+        putRequest.item = putItemInput.item;
+        AWSDynamoDBWriteRequest *writeRequest = [AWSDynamoDBWriteRequest new];
+        writeRequest.putRequest = putRequest;
+        [writeRequests addObject:writeRequest];
+    }
+    AWSDynamoDBBatchWriteItemInput *batchWriteItemInput = [AWSDynamoDBBatchWriteItemInput new];
+    batchWriteItemInput.requestItems = @{@"table" : writeRequests};
+    NSDictionary *batchWriteItemParameters = [[AWSMTLJSONAdapter JSONDictionaryFromModel:batchWriteItemInput] aws_removeNullValues];
+    NSDictionary *DynamoDBDefinition = [[AWSDynamoDBResources sharedInstance] JSONObject];
+
+    [self logAllocationsWithName:@"BatchWriteItem, 25 items, written"
+                           block:^{
+        [AWSJSONBuilder jsonDataForDictionary:batchWriteItemParameters
+                                   actionName:@"BatchWriteItem"
+                        serviceDefinitionRule:DynamoDBDefinition
+                                        error:nil];
+    }];
+    [self logAllocationsWithName:@"BatchWriteItem, 25 items, NSJSONSerialization"
+                           block:^{
+        [NSJSONSerialization dataWithJSONObject:batchWriteItemParameters
+                                        options:0
+                                          error:nil];
+    }];
+
+    NSMutableArray<AWSSQSSendMessageBatchRequestEntry *> *entries = [NSMutableArray new];
+    for (NSUInteger i = 0; i < 10; i++) {
+        AWSSQSSendMessageBatchRequestEntry *entry = [AWSSQSSendMessageBatchRequestEntry new];
+        entry.identifier = [NSString stringWithFormat:@"%lu", (unsigned long)i];
+        entry.messageBody = [NSString stringWithFormat:@"message %lu", (unsigned long)i];
+        [entries addObject:entry];
+    }
+    AWSSQSSendMessageBatchRequest *sendMessageBatchRequest = [AWSSQSSendMessageBatchRequest new];
+    sendMessageBatchRequest.queueUrl = @"https://sqs.us-east-1.amazonaws.com/123456789012/queue";
+    sendMessageBatchRequest.entries = entries;
+    NSDictionary *sendMessageBatchParameters = [[AWSMTLJSONAdapter JSONDictionaryFromModel:sendMessageBatchRequest] aws_removeNullValues];
+    AWSQueryStringRequestSerializer *serializer = [[AWSQueryStringRequestSerializer alloc] initWithJSONDefinition:[[AWSSQSResources sharedInstance] JSONObject]
+                                                                                                       actionName:@"SendMessageBatch"];
+    NSURL *URL = [NSURL URLWithString:@"https://sqs.us-east-1.amazonaws.com/"];
+
+    [self logAllocationsWithName:@"SendMessageBatch, 10 entries, query string"
+                           block:^{
+        NSMutableURLRequest *request = [NSMutableURLRequest requestWithURL:URL];
+        [serializer serializeRequest:request
+                             headers:nil
+                          parameters:sendMessageBatchParameters];
+    }];
+}
+
+@end
@@ -0,0 +1,60 @@
+//
+// Copyright 2010-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <XCTest/XCTest.h>
+#import <awsosx/awsosx.h>
+
+@interface AWSJSONShapeIndexTests : XCTestCase
+
+@end
+
+@implementation AWSJSONShapeIndexTests
+
+- (NSDictionary *)definition {
+    NSString *JSONString = @"{\"operations\":{\"PutItem\":{\"input\":{\"shape\":\"PutItemInput\"}}},"
+    "\"shapes\":{\"PutItemInput\":{\"type\":\"structure\",\"members\":{\"TableName\":{\"shape\":\"TableName\"}}},"
+    "\"TableName\":{\"type\":\"string\",\"max\":255}}}";
+    return [NSJSONSerialization JSONObjectWithData:[JSONString dataUsingEncoding:NSUTF8StringEncoding]
+                                           options:0
+                                             error:nil];
+}
+
+- (void)testIndexIsSharedByADefinition {
+    NSDictionary *definition = [self definition];
+    AWSJSONShapeIndex *shapeIndex = [AWSJSONShapeIndex shapeIndexForDefinitionRule:definition[@"shapes"]];
+    XCTAssertEqual(shapeIndex, [AWSJSONShapeIndex shapeIndexForDefinitionRule:definition[@"shapes"]]);
+    XCTAssertNotEqual(shapeIndex, [AWSJSONShapeIndex shapeIndexForDefinitionRule:[self definition][@"shapes"]]);
+
+    AWSJSONDictionary *rules = [shapeIndex rulesForDictionary:definition[@"operations"][@"PutItem"][@"input"]];
+    XCTAssertEqualObjects(rules[@"type"], @"structure");
+    XCTAssertEqualObjects(rules[@"members"][@"TableName"][@"max"], @255);
+}
+
+- (void)testIndexIsReleasedWithItsDefinition {
+    __weak NSDictionary *weakShapes = nil;
+    __weak AWSJSONShapeIndex *weakShapeIndex = nil;
+    @autoreleasepool {
+        NSDictionary *definition = [self definition];
+        AWSJSONShapeIndex *shapeIndex = [AWSJSONShapeIndex shapeIndexForDefinitionRule:definition[@"shapes"]];
+        [shapeIndex rulesForDictionary:definition[@"operations"][@"PutItem"][@"input"]];
+        weakShapes = definition[@"shapes"];
+        weakShapeIndex = shapeIndex;
+    }
+
+    XCTAssertNil(weakShapes);
+    XCTAssertNil(weakShapeIndex);
+}
+
+@end
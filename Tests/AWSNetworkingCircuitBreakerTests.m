@@ -0,0 +1,150 @@
+//
+// Copyright 2010-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import "AWSStandInTestCase.h"
+
+static const NSUInteger AWSCircuitTestMinimumRequestCount = 4;
+static const NSTimeInterval AWSCircuitTestOpenDuration = 0.5;
+
+@interface AWSNetworkingCircuitBreakerTests : AWSStandInTestCase <AWSNetworkingCircuitBreakerObserver>
+
+@property (nonatomic, strong) AWSTestStandInServer *server;
+@property (nonatomic, strong) AWSNetworkingCircuitBreaker *circuitBreaker;
+@property (nonatomic, strong) AWSDynamoDB *DynamoDB;
+@property (nonatomic, strong) NSMutableArray<NSArray<NSNumber *> *> *transitions;
+
+@end
+
+@implementation AWSNetworkingCircuitBreakerTests
+
+- (void)setUp {
+    [super setUp];
+    self.transitions = [NSMutableArray new];
+    self.server = [self startServerWithServiceDefinition:[[AWSDynamoDBResources sharedInstance] JSONObject]];
+
+    self.circuitBreaker = [AWSNetworkingCircuitBreaker new];
+    self.circuitBreaker.minimumRequestCount = AWSCircuitTestMinimumRequestCount;
+    self.circuitBreaker.failureRateThreshold = 0.5;
+    self.circuitBreaker.openDuration = AWSCircuitTestOpenDuration;
+    self.circuitBreaker.halfOpenProbeCount = 1;
+    [self.circuitBreaker addObserver:self];
+
+    AWSServiceConfiguration *configuration = [self.server serviceConfiguration];
+    configuration.maxRetryCount = 0;
+    configuration.circuitBreaker = self.circuitBreaker;
+    self.DynamoDB = [self DynamoDBWithConfiguration:configuration];
+}
+
+- (void)circuitBreaker:(AWSNetworkingCircuitBreaker *)circuitBreaker
+                  host:(NSString *)host
+    didChangeFromState:(AWSNetworkingCircuitBreakerState)fromState
+               toState:(AWSNetworkingCircuitBreakerState)toState {
+    @synchronized(self.transitions) {
+        [self.transitions addObject:@[@(fromState), @(toState)]];
+    }
+}
+
+- (NSArray<NSArray<NSNumber *> *> *)recordedTransitions {
+    @synchronized(self.transitions) {
+        return [self.transitions copy];
+    }
+}
+
+- (AWSNetworkingCircuitBreakerState)state {
+    return [self.circuitBreaker stateForHost:self.server.URL.host];
+}
+
+- (NSError *)listTables {
+    AWSTask *task = [self.DynamoDB listTables:[AWSDynamoDBListTablesInput new]];
+    [task waitUntilFinished];
+    return task.error;
+}
+
+- (void)openCircuit {
+    self.server.errorRate = 1;
+    self.server.errorStatusCode = 503;
+    for (NSUInteger i = 0; i < AWSCircuitTestMinimumRequestCount; i++) {
+        XCTAssertEqual([self state], AWSNetworkingCircuitBreakerStateClosed);
+        XCTAssertNotNil([self listTables]);
+    }
+    XCTAssertEqual([self state], AWSNetworkingCircuitBreakerStateOpen);
+}
+
+- (void)testOpenCircuitFailsFast {
+    [self openCircuit];
+    NSUInteger requestCount = self.server.requestCount;
+
+    NSError *error = [self listTables];
+    XCTAssertEqualObjects(error.domain, AWSNetworkingErrorDomain);
+    XCTAssertEqual(error.code, AWSNetworkingErrorCircuitOpen);
+    XCTAssertEqual(self.server.requestCount, requestCount);
+}
+
+- (void)testSuccessfulProbeClosesTheCircuit {
+    [self openCircuit];
+    [NSThread sleepForTimeInterval:AWSCircuitTestOpenDuration + 0.1];
+
+    self.server.errorRate = 0;
+    XCTAssertNil([self listTables]);
+    XCTAssertEqual([self state], AWSNetworkingCircuitBreakerStateClosed);
+
+    NSArray *expectedTransitions = @[@[@(AWSNetworkingCircuitBreakerStateClosed), @(AWSNetworkingCircuitBreakerStateOpen)],
+                                     @[@(AWSNetworkingCircuitBreakerStateOpen), @(AWSNetworkingCircuitBreakerStateHalfOpen)],
+                                     @[@(AWSNetworkingCircuitBreakerStateHalfOpen), @(AWSNetworkingCircuitBreakerStateClosed)]];
+    XCTAssertEqualObjects([self recordedTransitions], expectedTransitions);
+
+    // A closed circuit counts from scratch: one failure does not reopen it.
+    self.server.errorRate = 1;
+    XCTAssertNotNil([self listTables]);
+    XCTAssertEqual([self state], AWSNetworkingCircuitBreakerStateClosed);
+}
+
+- (void)testFailedProbeReopensTheCircuit {
+    [self openCircuit];
+    [NSThread sleepForTimeInterval:AWSCircuitTestOpenDuration + 0.1];
+
+    NSUInteger requestCount = self.server.requestCount;
+    XCTAssertNotNil([self listTables]);
+    XCTAssertEqual(self.server.requestCount, requestCount + 1);
+    XCTAssertEqual([self state], AWSNetworkingCircuitBreakerStateOpen);
+
+    NSArray *expectedTransitions = @[@[@(AWSNetworkingCircuitBreakerStateClosed), @(AWSNetworkingCircuitBreakerStateOpen)],
+                                     @[@(AWSNetworkingCircuitBreakerStateOpen), @(AWSNetworkingCircuitBreakerStateHalfOpen)],
+                                     @[@(AWSNetworkingCircuitBreakerStateHalfOpen), @(AWSNetworkingCircuitBreakerStateOpen)]];
+    XCTAssertEqualObjects([self recordedTransitions], expectedTransitions);
+
+    NSError *error = [self listTables];
+    XCTAssertEqual(error.code, AWSNetworkingErrorCircuitOpen);
+}
+
+- (void)testHalfOpenCircuitAdmitsOnlyTheProbe {
+    [self openCircuit];
+    [NSThread sleepForTimeInterval:AWSCircuitTestOpenDuration + 0.1];
+
+    self.server.errorRate = 0;
+    self.server.latency = 0.3;
+    AWSTask *firstTask = [self.DynamoDB listTables:[AWSDynamoDBListTablesInput new]];
+    AWSTask *secondTask = [self.DynamoDB listTables:[AWSDynamoDBListTablesInput new]];
+    [firstTask waitUntilFinished];
+    [secondTask waitUntilFinished];
+
+    // One request is the probe; the other is refused while the probe is in flight.
+    XCTAssertTrue((firstTask.error == nil) != (secondTask.error == nil));
+    NSError *error = firstTask.error ?: secondTask.error;
+    XCTAssertEqual(error.code, AWSNetworkingErrorCircuitOpen);
+    XCTAssertEqual([self state], AWSNetworkingCircuitBreakerStateClosed);
+}
+
+@end
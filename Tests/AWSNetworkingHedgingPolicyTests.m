@@ -0,0 +1,254 @@
+//
+// Copyright 2010-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import "AWSStandInTestCase.h"
+
+static const NSUInteger AWSHedgingTestSampleCount = 5;
+static const NSTimeInterval AWSHedgingTestHedgeDelay = 0.05;
+static const NSTimeInterval AWSHedgingTestSlowResponseDelay = 2.0;
+
+@interface AWSNetworkingHedgingPolicy()
+
+- (void)recordLatencyForRequest:(AWSNetworkingRequest *)request;
+
+@end
+
+@interface AWSNetworkingHedgingPolicyTests : AWSStandInTestCase <AWSNetworkingMetricsObserver>
+
+@property (nonatomic, strong) AWSTestStandInServer *server;
+@property (nonatomic, strong) AWSNetworkingHedgingPolicy *hedgingPolicy;
+@property (nonatomic, strong) AWSDynamoDB *DynamoDB;
+@property (nonatomic, strong) NSMutableArray<AWSNetworkingRequestMetrics *> *finishedMetrics;
+
+@end
+
+@implementation AWSNetworkingHedgingPolicyTests
+
+- (void)setUp {
+    [super setUp];
+    self.server = [self startServerWithServiceDefinition:[[AWSDynamoDBResources sharedInstance] JSONObject]];
+
+    self.hedgingPolicy = [AWSNetworkingHedgingPolicy new];
+    self.hedgingPolicy.minimumSampleCount = AWSHedgingTestSampleCount;
+    self.hedgingPolicy.minimumHedgeDelay = AWSHedgingTestHedgeDelay;
+    self.hedgingPolicy.maximumHedgeDelay = AWSHedgingTestHedgeDelay;
+    self.hedgingPolicy.maximumHedgeRatio = 1.0;
+    AWSServiceConfiguration *configuration = [self.server serviceConfiguration];
+    configuration.hedgingPolicy = self.hedgingPolicy;
+    self.DynamoDB = [self DynamoDBWithConfiguration:configuration];
+
+    self.finishedMetrics = [NSMutableArray new];
+    [AWSNetworkingRequestMetrics addObserver:self];
+}
+
+- (void)tearDown {
+    [AWSNetworkingRequestMetrics removeObserver:self];
+    [super tearDown];
+}
+
+- (void)networkingRequestDidFinishWithMetrics:(AWSNetworkingRequestMetrics *)metrics {
+    @synchronized(self.finishedMetrics) {
+        [self.finishedMetrics addObject:metrics];
+    }
+}
+
+- (AWSNetworkingRequestMetrics *)finishedMetricsWithHedgeDecision:(AWSNetworkingHedgeDecision)hedgeDecision {
+    @synchronized(self.finishedMetrics) {
+        for (AWSNetworkingRequestMetrics *metrics in self.finishedMetrics) {
+            if (metrics.hedgeDecision == hedgeDecision) {
+                return metrics;
+            }
+        }
+    }
+
+    return nil;
+}
+
+/**
+ Waits for the metrics of a request that is cancelled, which finish shortly after the call completes, and at most
+ half as long as the server takes to answer it.
+ */
+- (void)waitForFinishedMetricsWithHedgeDecision:(AWSNetworkingHedgeDecision)hedgeDecision {
+    NSPredicate *finished = [NSPredicate predicateWithBlock:^BOOL(id object, NSDictionary *bindings) {
+        return [self finishedMetricsWithHedgeDecision:hedgeDecision] != nil;
+    }];
+    [self waitForExpectations:@[[self expectationForPredicate:finished evaluatedWithObject:self handler:nil]]
+                      timeout:AWSHedgingTestSlowResponseDelay / 2];
+}
+
+- (AWSNetworkingRequest *)requestWithHTTPMethod:(AWSHTTPMethod)HTTPMethod
+                                  operationName:(NSString *)operationName {
+    AWSNetworkingRequest *request = [AWSNetworkingRequest new];
+    request.HTTPMethod = HTTPMethod;
+    request.metrics = [[AWSNetworkingRequestMetrics alloc] initWithServiceName:@"dynamodb"
+                                                                 operationName:operationName];
+    return request;
+}
+
+- (void)recordTimeToFirstByte:(NSTimeInterval)timeToFirstByte
+                        count:(NSUInteger)count {
+    for (NSUInteger i = 0; i < count; i++) {
+        AWSNetworkingRequest *request = [self requestWithHTTPMethod:AWSHTTPMethodPOST
+                                                      operationName:@"GetItem"];
+        [request.metrics addDuration:timeToFirstByte
+                            forPhase:AWSNetworkingRequestPhaseTimeToFirstByte];
+        [request.metrics finishWithStatusCode:200
+                                   retryCount:0
+                                        error:nil];
+        [self.hedgingPolicy recordLatencyForRequest:request];
+    }
+}
+
+- (AWSDynamoDBGetItemInput *)getItemInputWithKey:(NSString *)key {
+    AWSDynamoDBAttributeValue *value = [AWSDynamoDBAttributeValue new];
+    value.S = key;
+    AWSDynamoDBGetItemInput *request = [AWSDynamoDBGetItemInput new];
+    request.tableName = @"table";
+    request.key = @{@"id" : value};
+    return request;
+}
+
+/**
+ Sends enough fast requests for the policy to pick a hedge delay, then delays the responses to the next requests the
+ server receives by the given delays, in the order they arrive.
+ */
+- (void)primeAndDelayNextResponses:(NSArray<NSNumber *> *)delays {
+    for (NSUInteger i = 0; i < AWSHedgingTestSampleCount; i++) {
+        [self resultOfTask:[self.DynamoDB getItem:[self getItemInputWithKey:@"warm-up"]]];
+    }
+    @synchronized(self.finishedMetrics) {
+        [self.finishedMetrics removeAllObjects];
+    }
+
+    __block NSUInteger arrivalCount = 0;
+    self.server.requestHandler = ^AWSTestStandInResponse *(AWSTestStandInRequest *request) {
+        NSTimeInterval delay = 0;
+        @synchronized(delays) {
+            if (arrivalCount < [delays count]) {
+                delay = [delays[arrivalCount] doubleValue];
+            }
+            arrivalCount++;
+        }
+        [NSThread sleepForTimeInterval:delay];
+        return nil;
+    };
+}
+
+#pragma mark - Eligibility
+
+- (void)testOnlyListedOperationsAreHedgeable {
+    XCTAssertTrue([self.hedgingPolicy isRequestHedgeable:[self requestWithHTTPMethod:AWSHTTPMethodPOST operationName:@"GetItem"]]);
+    XCTAssertTrue([self.hedgingPolicy isRequestHedgeable:[self requestWithHTTPMethod:AWSHTTPMethodPOST operationName:@"Query"]]);
+    XCTAssertFalse([self.hedgingPolicy isRequestHedgeable:[self requestWithHTTPMethod:AWSHTTPMethodPOST operationName:@"BatchGetItem"]]);
+    XCTAssertFalse([self.hedgingPolicy isRequestHedgeable:[self requestWithHTTPMethod:AWSHTTPMethodPOST operationName:@"PutItem"]]);
+
+    // Being a GET does not make a download eligible.
+    XCTAssertFalse([self.hedgingPolicy isRequestHedgeable:[self requestWithHTTPMethod:AWSHTTPMethodGET operationName:@"GetObject"]]);
+    XCTAssertFalse([self.hedgingPolicy isRequestHedgeable:[self requestWithHTTPMethod:AWSHTTPMethodGET operationName:nil]]);
+}
+
+- (void)testListedOperationIsNotHedgedWhenItsResponseIsStreamed {
+    self.hedgingPolicy.hedgedOperationNames = [NSSet setWithObject:@"GetObject"];
+    AWSNetworkingRequest *request = [self requestWithHTTPMethod:AWSHTTPMethodGET operationName:@"GetObject"];
+    XCTAssertTrue([self.hedgingPolicy isRequestHedgeable:request]);
+
+    request.downloadingFileURL = [NSURL fileURLWithPath:NSTemporaryDirectory()];
+    XCTAssertFalse([self.hedgingPolicy isRequestHedgeable:request]);
+}
+
+#pragma mark - Hedge delay
+
+- (void)testHedgeDelayFollowsTheLatencyPercentile {
+    self.hedgingPolicy.minimumHedgeDelay = 0.001;
+    self.hedgingPolicy.maximumHedgeDelay = 1.0;
+    AWSNetworkingRequest *request = [self requestWithHTTPMethod:AWSHTTPMethodPOST operationName:@"GetItem"];
+
+    [self recordTimeToFirstByte:0.01 count:AWSHedgingTestSampleCount - 1];
+    XCTAssertEqual([self.hedgingPolicy hedgeDelayForRequest:request], 0);
+
+    // The delay is the upper bound of the histogram bucket holding the percentile, at most 20% above it.
+    [self recordTimeToFirstByte:0.01 count:95];
+    [self recordTimeToFirstByte:0.5 count:5];
+    NSTimeInterval hedgeDelay = [self.hedgingPolicy hedgeDelayForRequest:request];
+    XCTAssertGreaterThanOrEqual(hedgeDelay, 0.01);
+    XCTAssertLessThan(hedgeDelay, 0.012);
+
+    self.hedgingPolicy.latencyPercentile = 0.99;
+    hedgeDelay = [self.hedgingPolicy hedgeDelayForRequest:request];
+    XCTAssertGreaterThanOrEqual(hedgeDelay, 0.5);
+    XCTAssertLessThan(hedgeDelay, 0.6);
+}
+
+- (void)testHedgeDelayIsClamped {
+    AWSNetworkingRequest *request = [self requestWithHTTPMethod:AWSHTTPMethodPOST operationName:@"GetItem"];
+    self.hedgingPolicy.minimumHedgeDelay = 0.1;
+    self.hedgingPolicy.maximumHedgeDelay = 2.0;
+
+    [self recordTimeToFirstByte:0.001 count:AWSHedgingTestSampleCount];
+    XCTAssertEqual([self.hedgingPolicy hedgeDelayForRequest:request], 0.1);
+
+    [self recordTimeToFirstByte:60 count:AWSHedgingTestSampleCount * 10];
+    XCTAssertEqual([self.hedgingPolicy hedgeDelayForRequest:request], 2.0);
+}
+
+#pragma mark - Hedging
+
+- (void)testHedgeWinsAndTheSlowRequestIsCancelled {
+    [self primeAndDelayNextResponses:@[@(AWSHedgingTestSlowResponseDelay)]];
+
+    NSTimeInterval startTime = [AWSNetworkingRequestMetrics currentTime];
+    [self resultOfTask:[self.DynamoDB getItem:[self getItemInputWithKey:@"a"]]];
+    XCTAssertLessThan([AWSNetworkingRequestMetrics currentTime] - startTime, AWSHedgingTestSlowResponseDelay / 2);
+
+    AWSNetworkingHedgingStatistics *statistics = [self.hedgingPolicy statistics];
+    XCTAssertEqual(statistics.hedgedRequestCount, 1);
+    XCTAssertEqual(statistics.hedgeWinCount, 1);
+
+    [self waitForFinishedMetricsWithHedgeDecision:AWSNetworkingHedgeDecisionHedged];
+    AWSNetworkingRequestMetrics *metrics = [self finishedMetricsWithHedgeDecision:AWSNetworkingHedgeDecisionHedged];
+    XCTAssertTrue(metrics.hedgeWon);
+    XCTAssertEqual(metrics.hedgeDelay, AWSHedgingTestHedgeDelay);
+    // The attempt of the slow request finished as cancelled instead of waiting for its response.
+    XCTAssertNotNil(metrics.error);
+    XCTAssertLessThan(metrics.totalDuration, AWSHedgingTestSlowResponseDelay / 2);
+}
+
+- (void)testOriginalWinsAndTheHedgeIsCancelled {
+    [self primeAndDelayNextResponses:@[@(AWSHedgingTestHedgeDelay * 4), @(AWSHedgingTestSlowResponseDelay)]];
+
+    [self resultOfTask:[self.DynamoDB getItem:[self getItemInputWithKey:@"a"]]];
+
+    AWSNetworkingHedgingStatistics *statistics = [self.hedgingPolicy statistics];
+    XCTAssertEqual(statistics.hedgedRequestCount, 1);
+    XCTAssertEqual(statistics.hedgeWinCount, 0);
+
+    // The duplicate is cancelled when the original succeeds, well before the server would have answered it.
+    [self waitForFinishedMetricsWithHedgeDecision:AWSNetworkingHedgeDecisionDuplicate];
+    AWSNetworkingRequestMetrics *hedgeMetrics = [self finishedMetricsWithHedgeDecision:AWSNetworkingHedgeDecisionDuplicate];
+    XCTAssertNotNil(hedgeMetrics.error);
+    XCTAssertFalse([self finishedMetricsWithHedgeDecision:AWSNetworkingHedgeDecisionHedged].hedgeWon);
+}
+
+- (void)testFastResponseIsNotHedged {
+    [self primeAndDelayNextResponses:@[]];
+
+    [self resultOfTask:[self.DynamoDB getItem:[self getItemInputWithKey:@"a"]]];
+
+    XCTAssertEqual([self.hedgingPolicy statistics].hedgedRequestCount, 0);
+    XCTAssertEqual(self.server.requestCount, AWSHedgingTestSampleCount + 1);
+    XCTAssertNotNil([self finishedMetricsWithHedgeDecision:AWSNetworkingHedgeDecisionNotNeeded]);
+}
+
+@end
@@ -0,0 +1,109 @@
+//
+// Copyright 2010-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import "AWSStandInTestCase.h"
+
+static const NSTimeInterval AWSCoalescerTestLatency = 0.5;
+
+@interface AWSNetworkingRequestCoalescerTests : AWSStandInTestCase
+
+@property (nonatomic, strong) AWSTestStandInServer *server;
+@property (nonatomic, strong) AWSNetworkingRequestCoalescer *requestCoalescer;
+@property (nonatomic, strong) AWSDynamoDB *DynamoDB;
+
+@end
+
+@implementation AWSNetworkingRequestCoalescerTests
+
+- (void)setUp {
+    [super setUp];
+    self.server = [self startServerWithServiceDefinition:[[AWSDynamoDBResources sharedInstance] JSONObject]];
+    self.server.latency = AWSCoalescerTestLatency;
+
+    self.requestCoalescer = [AWSNetworkingRequestCoalescer new];
+    AWSServiceConfiguration *configuration = [self.server serviceConfiguration];
+    configuration.requestCoalescer = self.requestCoalescer;
+    self.DynamoDB = [self DynamoDBWithConfiguration:configuration];
+}
+
+- (AWSDynamoDBGetItemInput *)getItemInputWithKey:(NSString *)key {
+    AWSDynamoDBAttributeValue *value = [AWSDynamoDBAttributeValue new];
+    value.S = key;
+    AWSDynamoDBGetItemInput *request = [AWSDynamoDBGetItemInput new];
+    request.tableName = @"table";
+    request.key = @{@"id" : value};
+    return request;
+}
+
+- (void)testIdenticalRequestsShareOneResponse {
+    AWSTask *firstTask = [self.DynamoDB getItem:[self getItemInputWithKey:@"a"]];
+    AWSTask *secondTask = [self.DynamoDB getItem:[self getItemInputWithKey:@"a"]];
+
+    AWSDynamoDBGetItemOutput *firstOutput = [self resultOfTask:firstTask];
+    AWSDynamoDBGetItemOutput *secondOutput = [self resultOfTask:secondTask];
+    XCTAssertEqual(self.server.requestCount, 1);
+    XCTAssertEqual([self.requestCoalescer statistics].coalescedRequestCount, 1);
+
+    // Each caller owns its output, down to the nested values.
+    XCTAssertNotNil(firstOutput.item);
+    XCTAssertEqualObjects(firstOutput, secondOutput);
+    XCTAssertNotEqual(firstOutput, secondOutput);
+    XCTAssertNotEqual(firstOutput.item, secondOutput.item);
+}
+
+- (void)testRequestsWithDifferentBodiesAreSentSeparately {
+    AWSTask *firstTask = [self.DynamoDB getItem:[self getItemInputWithKey:@"a"]];
+    AWSTask *secondTask = [self.DynamoDB getItem:[self getItemInputWithKey:@"b"]];
+
+    [self resultOfTask:firstTask];
+    [self resultOfTask:secondTask];
+    XCTAssertEqual(self.server.requestCount, 2);
+    XCTAssertEqual([self.requestCoalescer statistics].coalescedRequestCount, 0);
+}
+
+- (void)testCancelledFollowerDetachesFromTheSharedRequest {
+    AWSCancellationTokenSource *cancellationTokenSource = [AWSCancellationTokenSource cancellationTokenSource];
+    AWSDynamoDBGetItemInput *followerInput = [self getItemInputWithKey:@"a"];
+    followerInput.cancellationToken = cancellationTokenSource.token;
+
+    AWSTask *leaderTask = [self.DynamoDB getItem:[self getItemInputWithKey:@"a"]];
+    AWSTask *followerTask = [self.DynamoDB getItem:followerInput];
+    [cancellationTokenSource cancel];
+    [followerTask waitUntilFinished];
+
+    XCTAssertFalse(leaderTask.completed);
+    XCTAssertEqualObjects(followerTask.error.domain, AWSNetworkingErrorDomain);
+    XCTAssertEqual(followerTask.error.code, AWSNetworkingErrorCancelled);
+
+    XCTAssertNotNil([self resultOfTask:leaderTask]);
+    XCTAssertEqual(self.server.requestCount, 1);
+    XCTAssertEqual([self.requestCoalescer statistics].cancelledRequestCount, 1);
+}
+
+- (void)testFollowerPastItsDeadlineDetachesFromTheSharedRequest {
+    AWSDynamoDBGetItemInput *followerInput = [self getItemInputWithKey:@"a"];
+    followerInput.deadline = [NSDate dateWithTimeIntervalSinceNow:AWSCoalescerTestLatency / 5];
+
+    AWSTask *leaderTask = [self.DynamoDB getItem:[self getItemInputWithKey:@"a"]];
+    AWSTask *followerTask = [self.DynamoDB getItem:followerInput];
+    [followerTask waitUntilFinished];
+
+    XCTAssertFalse(leaderTask.completed);
+    XCTAssertEqual(followerTask.error.code, AWSNetworkingErrorDeadlineExceeded);
+    XCTAssertNotNil([self resultOfTask:leaderTask]);
+    XCTAssertEqual(self.server.requestCount, 1);
+}
+
+@end
@@ -0,0 +1,136 @@
+//
+// Copyright 2010-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import "AWSStandInTestCase.h"
+
+static const NSUInteger AWSCompressionBenchmarkRequestCount = 500;
+
+@interface AWSNetworkingRequestCompressionInterceptorTests : AWSStandInTestCase
+
+@end
+
+@implementation AWSNetworkingRequestCompressionInterceptorTests
+
+- (NSMutableURLRequest *)requestWithOperationName:(NSString *)operationName {
+    NSMutableURLRequest *request = [NSMutableURLRequest requestWithURL:[NSURL URLWithString:@"https://example.com/"]];
+    request.HTTPMethod = @"POST";
+    request.HTTPBody = [[@"" stringByPaddingToLength:64 * 1024 withString:@"MetricName=Latency&" startingAtIndex:0] dataUsingEncoding:NSUTF8StringEncoding];
+    [NSURLProtocol setProperty:operationName
+                        forKey:AWSNetworkingRequestOperationNameKey
+                     inRequest:request];
+    return request;
+}
+
+- (BOOL)compressesOperationName:(NSString *)operationName
+                 withInterceptor:(AWSNetworkingRequestCompressionInterceptor *)interceptor {
+    NSMutableURLRequest *request = [self requestWithOperationName:operationName];
+    [[interceptor interceptRequest:request] waitUntilFinished];
+    return [[request valueForHTTPHeaderField:@"Content-Encoding"] isEqualToString:@"gzip"];
+}
+
+- (void)testOperationNames {
+    AWSNetworkingRequestCompressionInterceptor *interceptor = [[AWSNetworkingRequestCompressionInterceptor alloc] initWithOperationNames:[NSSet setWithObject:@"PutMetricData"]];
+    XCTAssertTrue([self compressesOperationName:@"PutMetricData" withInterceptor:interceptor]);
+    XCTAssertFalse([self compressesOperationName:@"ListMetrics" withInterceptor:interceptor]);
+}
+
+- (void)testRequestCompressionTrait {
+    NSString *JSONString = @"{\"operations\":{"
+    "\"PutMetricData\":{\"name\":\"PutMetricData\",\"requestcompression\":{\"encodings\":[\"gzip\"]}},"
+    "\"ListMetrics\":{\"name\":\"ListMetrics\"}}}";
+    AWSLazyJSONDictionary *definition = [[AWSLazyJSONDictionary alloc] initWithJSONString:JSONString error:nil];
+    AWSNetworkingRequestCompressionInterceptor *interceptor = [[AWSNetworkingRequestCompressionInterceptor alloc] initWithJSONDefinition:definition];
+    XCTAssertTrue([self compressesOperationName:@"PutMetricData" withInterceptor:interceptor]);
+    XCTAssertTrue([self compressesOperationName:@"PutMetricData" withInterceptor:interceptor]);
+    XCTAssertFalse([self compressesOperationName:@"ListMetrics" withInterceptor:interceptor]);
+    XCTAssertFalse([self compressesOperationName:@"DescribeAlarms" withInterceptor:interceptor]);
+    XCTAssertEqual([interceptor statistics].compressedRequestCount, 2);
+}
+
+#pragma mark - Benchmarks
+
+- (AWSCloudWatchPutMetricDataInput *)putMetricDataInputWithDatumCount:(NSUInteger)datumCount {
+    NSMutableArray *metricData = [NSMutableArray arrayWithCapacity:datumCount];
+    for (NSUInteger i = 0; i < datumCount; i++) {
+        AWSCloudWatchDimension *dimension = [AWSCloudWatchDimension new];
+        dimension.name = @"InstanceId";
+        dimension.value = [NSString stringWithFormat:@"i-%08lu", (unsigned long)(i % 16)];
+        AWSCloudWatchMetricDatum *datum = [AWSCloudWatchMetricDatum new];
+        datum.metricName = @"Latency";
+        datum.dimensions = @[dimension];
+        datum.value = @(i * 0.25);
+        datum.unit = AWSCloudWatchStandardUnitMilliseconds;
+        [metricData addObject:datum];
+    }
+    AWSCloudWatchPutMetricDataInput *request = [AWSCloudWatchPutMetricDataInput new];
+    request.namespace = @"StandIn";
+    request.metricData = metricData;
+    return request;
+}
+
+- (void)testPutMetricDataBytesOnWireAndCPUBenchmark {
+    AWSTestStandInServer *server = [self startServerWithServiceDefinition:[[AWSCloudWatchResources sharedInstance] JSONObject]];
+    NSObject *byteCountLock = [NSObject new];
+    __block unsigned long long bodyByteCount = 0;
+    server.requestHandler = ^AWSTestStandInResponse *(AWSTestStandInRequest *request) {
+        @synchronized(byteCountLock) {
+            bodyByteCount += request.bodyLength;
+        }
+        return nil;
+    };
+
+    // One datum stays under the minimum compression size; the larger batches are compressed.
+    for (NSNumber *datumCount in @[@1, @20, @200, @1000]) {
+        AWSCloudWatchPutMetricDataInput *request = [self putMetricDataInputWithDatumCount:[datumCount unsignedIntegerValue]];
+        for (NSNumber *compressionEnabled in @[@NO, @YES]) {
+            AWSServiceConfiguration *configuration = [server serviceConfiguration];
+            configuration.requestCompressionEnabled = [compressionEnabled boolValue];
+            AWSCloudWatch *CloudWatch = [self CloudWatchWithConfiguration:configuration];
+            AWSNetworkingRequestCompressionInterceptor *interceptor = nil;
+            for (id<AWSNetworkingRequestInterceptor> requestInterceptor in CloudWatch.configuration.requestInterceptors) {
+                if ([requestInterceptor isKindOfClass:[AWSNetworkingRequestCompressionInterceptor class]]) {
+                    interceptor = requestInterceptor;
+                }
+            }
+            XCTAssertEqual(interceptor != nil, [compressionEnabled boolValue]);
+            @synchronized(byteCountLock) {
+                bodyByteCount = 0;
+            }
+
+            NSString *name = [NSString stringWithFormat:@"CloudWatch PutMetricData, %@ data, %@", datumCount, [compressionEnabled boolValue] ? @"gzip" : @"uncompressed"];
+            AWSTestLoadReport *report = [AWSTestLoadGenerator runWithName:name
+                                                             requestCount:AWSCompressionBenchmarkRequestCount
+                                                              concurrency:4
+                                                                operation:^AWSTask *(NSUInteger index) {
+                return [CloudWatch putMetricData:request];
+            }];
+            XCTAssertEqual(report.errorCount, 0);
+
+            unsigned long long bytesPerRequest = 0;
+            @synchronized(byteCountLock) {
+                bytesPerRequest = bodyByteCount / AWSCompressionBenchmarkRequestCount;
+            }
+            AWSNetworkingRequestCompressionStatistics *statistics = [interceptor statistics];
+            [self logBenchmark:@"%@: %llu body bytes on the wire per request, %.1f us of CPU per request, %.1f us compressing per request, %.0f requests/s",
+             name,
+             bytesPerRequest,
+             report.CPUTimePerRequest * 1000000,
+             statistics.compressionDuration * 1000000 / AWSCompressionBenchmarkRequestCount,
+             report.requestsPerSecond];
+        }
+    }
+}
+
+@end
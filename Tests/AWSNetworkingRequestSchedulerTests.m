@@ -0,0 +1,232 @@
+//
+// Copyright 2010-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import "AWSStandInTestCase.h"
+
+static NSString *const AWSSchedulerTestHost = @"a.example.com";
+static NSString *const AWSSchedulerTestOtherHost = @"b.example.com";
+
+@interface AWSNetworkingRequestScheduler()
+
+- (AWSTask *)admitRequest:(AWSNetworkingRequest *)request
+                     host:(NSString *)host
+                byteCount:(int64_t)byteCount;
+- (void)releaseTicket:(id)ticket;
+
+@end
+
+@interface AWSNetworkingRequestSchedulerTests : AWSStandInTestCase
+
+@property (nonatomic, strong) AWSNetworkingRequestScheduler *scheduler;
+// Tickets only hold their requests weakly.
+@property (nonatomic, strong) NSMutableArray<AWSNetworkingRequest *> *requests;
+
+@end
+
+@implementation AWSNetworkingRequestSchedulerTests
+
+- (void)setUp {
+    [super setUp];
+    self.scheduler = [AWSNetworkingRequestScheduler new];
+    self.requests = [NSMutableArray new];
+}
+
+- (AWSTask *)admitWithPriority:(AWSNetworkingRequestPriority)priority
+                          host:(NSString *)host
+                     byteCount:(int64_t)byteCount {
+    AWSNetworkingRequest *request = [AWSNetworkingRequest new];
+    request.priority = priority;
+    [self.requests addObject:request];
+    return [self.scheduler admitRequest:request
+                                   host:host
+                              byteCount:byteCount];
+}
+
+- (AWSTask *)admitWithPriority:(AWSNetworkingRequestPriority)priority {
+    return [self admitWithPriority:priority
+                              host:AWSSchedulerTestHost
+                         byteCount:0];
+}
+
+- (void)testClassRequestLimitQueuesTheExcess {
+    [self.scheduler setMaximumInFlightRequestCount:2
+                                       forPriority:AWSNetworkingRequestPriorityDefault];
+    AWSTask *firstTask = [self admitWithPriority:AWSNetworkingRequestPriorityDefault];
+    AWSTask *secondTask = [self admitWithPriority:AWSNetworkingRequestPriorityDefault];
+    AWSTask *thirdTask = [self admitWithPriority:AWSNetworkingRequestPriorityDefault];
+    AWSTask *interactiveTask = [self admitWithPriority:AWSNetworkingRequestPriorityInteractive];
+
+    XCTAssertTrue(firstTask.completed);
+    XCTAssertTrue(secondTask.completed);
+    XCTAssertFalse(thirdTask.completed);
+    // The limit is per class.
+    XCTAssertTrue(interactiveTask.completed);
+    XCTAssertEqual([[self.scheduler statistics] pendingRequestCountForPriority:AWSNetworkingRequestPriorityDefault], 1);
+
+    [self.scheduler releaseTicket:firstTask.result];
+    XCTAssertNotNil([self resultOfTask:thirdTask]);
+    XCTAssertEqual([[self.scheduler statistics] inFlightRequestCountForPriority:AWSNetworkingRequestPriorityDefault], 2);
+}
+
+- (void)testClassByteLimitQueuesTheExcess {
+    [self.scheduler setMaximumInFlightByteCount:100
+                                    forPriority:AWSNetworkingRequestPriorityBulk];
+    AWSTask *firstTask = [self admitWithPriority:AWSNetworkingRequestPriorityBulk
+                                            host:AWSSchedulerTestHost
+                                       byteCount:60];
+    AWSTask *secondTask = [self admitWithPriority:AWSNetworkingRequestPriorityBulk
+                                             host:AWSSchedulerTestOtherHost
+                                        byteCount:60];
+    XCTAssertTrue(firstTask.completed);
+    XCTAssertFalse(secondTask.completed);
+    XCTAssertEqual([[self.scheduler statistics] inFlightByteCountForPriority:AWSNetworkingRequestPriorityBulk], 60);
+
+    [self.scheduler releaseTicket:firstTask.result];
+    [self.scheduler releaseTicket:[self resultOfTask:secondTask]];
+
+    // A body larger than the limit goes out once nothing else of its class is in flight.
+    AWSTask *largeTask = [self admitWithPriority:AWSNetworkingRequestPriorityBulk
+                                            host:AWSSchedulerTestHost
+                                       byteCount:1000];
+    XCTAssertTrue(largeTask.completed);
+}
+
+- (void)testHostRequestLimitOnlyHoldsThatHost {
+    self.scheduler.maximumInFlightRequestCountPerHost = 1;
+    AWSTask *firstTask = [self admitWithPriority:AWSNetworkingRequestPriorityInteractive];
+    AWSTask *sameHostTask = [self admitWithPriority:AWSNetworkingRequestPriorityDefault];
+    AWSTask *otherHostTask = [self admitWithPriority:AWSNetworkingRequestPriorityDefault
+                                                host:AWSSchedulerTestOtherHost
+                                           byteCount:0];
+
+    XCTAssertTrue(firstTask.completed);
+    XCTAssertFalse(sameHostTask.completed);
+    XCTAssertTrue(otherHostTask.completed);
+
+    [self.scheduler releaseTicket:firstTask.result];
+    XCTAssertNotNil([self resultOfTask:sameHostTask]);
+}
+
+- (void)testHostByteLimitOnlyHoldsThatHost {
+    self.scheduler.maximumInFlightByteCountPerHost = 100;
+    AWSTask *firstTask = [self admitWithPriority:AWSNetworkingRequestPriorityDefault
+                                            host:AWSSchedulerTestHost
+                                       byteCount:60];
+    AWSTask *sameHostTask = [self admitWithPriority:AWSNetworkingRequestPriorityInteractive
+                                               host:AWSSchedulerTestHost
+                                          byteCount:60];
+    AWSTask *otherHostTask = [self admitWithPriority:AWSNetworkingRequestPriorityInteractive
+                                                host:AWSSchedulerTestOtherHost
+                                           byteCount:60];
+
+    XCTAssertTrue(firstTask.completed);
+    XCTAssertFalse(sameHostTask.completed);
+    XCTAssertTrue(otherHostTask.completed);
+
+    [self.scheduler releaseTicket:firstTask.result];
+    XCTAssertNotNil([self resultOfTask:sameHostTask]);
+}
+
+- (void)testWaitingClassesAreAdmittedByWeight {
+    self.scheduler.maximumInFlightRequestCountPerHost = 1;
+    id ticket = [self resultOfTask:[self admitWithPriority:AWSNetworkingRequestPriorityDefault]];
+
+    NSArray<NSNumber *> *priorities = @[@(AWSNetworkingRequestPriorityDefault),
+                                        @(AWSNetworkingRequestPriorityInteractive),
+                                        @(AWSNetworkingRequestPriorityBulk)];
+    NSMutableDictionary<NSNumber *, NSMutableArray<AWSTask *> *> *pendingTasks = [NSMutableDictionary new];
+    for (NSNumber *priority in priorities) {
+        pendingTasks[priority] = [NSMutableArray new];
+        for (NSUInteger i = 0; i < 13; i++) {
+            [pendingTasks[priority] addObject:[self admitWithPriority:[priority integerValue]]];
+        }
+    }
+
+    // Weights of 8, 4 and 1 share 13 admissions 8, 4 and 1 while all classes are waiting.
+    NSCountedSet<NSNumber *> *admittedPriorities = [NSCountedSet new];
+    for (NSUInteger i = 0; i < 13; i++) {
+        AWSNetworkingRequestSchedulerStatistics *statistics = [self.scheduler statistics];
+        [self.scheduler releaseTicket:ticket];
+        AWSNetworkingRequestSchedulerStatistics *releasedStatistics = [self.scheduler statistics];
+        for (NSNumber *priority in priorities) {
+            AWSNetworkingRequestPriority priorityValue = [priority integerValue];
+            if ([releasedStatistics admittedRequestCountForPriority:priorityValue] > [statistics admittedRequestCountForPriority:priorityValue]) {
+                [admittedPriorities addObject:priority];
+                ticket = [self resultOfTask:[pendingTasks[priority] firstObject]];
+                [pendingTasks[priority] removeObjectAtIndex:0];
+            }
+        }
+    }
+
+    XCTAssertEqual([admittedPriorities countForObject:@(AWSNetworkingRequestPriorityInteractive)], 8);
+    XCTAssertEqual([admittedPriorities countForObject:@(AWSNetworkingRequestPriorityDefault)], 4);
+    XCTAssertEqual([admittedPriorities countForObject:@(AWSNetworkingRequestPriorityBulk)], 1);
+}
+
+- (void)testRaisingALimitAdmitsWaitingRequests {
+    [self.scheduler setMaximumInFlightRequestCount:1
+                                       forPriority:AWSNetworkingRequestPriorityDefault];
+    AWSTask *firstTask = [self admitWithPriority:AWSNetworkingRequestPriorityDefault];
+    AWSTask *secondTask = [self admitWithPriority:AWSNetworkingRequestPriorityDefault];
+    XCTAssertTrue(firstTask.completed);
+    XCTAssertFalse(secondTask.completed);
+
+    [self.scheduler setMaximumInFlightRequestCount:2
+                                       forPriority:AWSNetworkingRequestPriorityDefault];
+    XCTAssertNotNil([self resultOfTask:secondTask]);
+    XCTAssertEqual([[self.scheduler statistics] pendingRequestCountForPriority:AWSNetworkingRequestPriorityDefault], 0);
+}
+
+- (void)testCancelledPendingRequestLeavesTheQueue {
+    [self.scheduler setMaximumInFlightRequestCount:1
+                                       forPriority:AWSNetworkingRequestPriorityDefault];
+    AWSTask *firstTask = [self admitWithPriority:AWSNetworkingRequestPriorityDefault];
+    AWSTask *secondTask = [self admitWithPriority:AWSNetworkingRequestPriorityDefault];
+    XCTAssertFalse(secondTask.completed);
+
+    // Cancelling the request hands it to cancelPendingRequest:.
+    [[self.requests lastObject] cancel];
+    XCTAssertTrue(secondTask.completed);
+    XCTAssertEqual(secondTask.error.code, AWSNetworkingErrorCancelled);
+    XCTAssertEqual([[self.scheduler statistics] pendingRequestCountForPriority:AWSNetworkingRequestPriorityDefault], 0);
+
+    [self.scheduler releaseTicket:firstTask.result];
+    XCTAssertEqual([[self.scheduler statistics] admittedRequestCountForPriority:AWSNetworkingRequestPriorityDefault], 1);
+}
+
+- (void)testSendRequestStaysPendingUnderBackpressure {
+    AWSTestStandInServer *server = [self startServerWithServiceDefinition:[[AWSDynamoDBResources sharedInstance] JSONObject]];
+    server.latency = 0.5;
+    self.scheduler.maximumInFlightRequestCountPerHost = 1;
+    AWSServiceConfiguration *configuration = [server serviceConfiguration];
+    configuration.requestScheduler = self.scheduler;
+    AWSDynamoDB *DynamoDB = [self DynamoDBWithConfiguration:configuration];
+
+    AWSTask *firstTask = [DynamoDB listTables:[AWSDynamoDBListTablesInput new]];
+    AWSTask *secondTask = [DynamoDB listTables:[AWSDynamoDBListTablesInput new]];
+    [NSThread sleepForTimeInterval:0.2];
+
+    XCTAssertFalse(firstTask.completed);
+    XCTAssertFalse(secondTask.completed);
+    XCTAssertEqual(server.requestCount, 1);
+    XCTAssertEqual([[self.scheduler statistics] pendingRequestCountForPriority:AWSNetworkingRequestPriorityDefault], 1);
+
+    [self resultOfTask:firstTask];
+    [self resultOfTask:secondTask];
+    XCTAssertEqual(server.requestCount, 2);
+    XCTAssertEqual([[self.scheduler statistics] queuedRequestCountForPriority:AWSNetworkingRequestPriorityDefault], 1);
+}
+
+@end
@@ -0,0 +1,91 @@
+//
+// Copyright 2010-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <XCTest/XCTest.h>
+#import <awsosx/awsosx.h>
+
+static NSString *const AWSWireLoggerTestSecret = @"correct-horse-battery-staple";
+
+@interface AWSNetworkingWireLogger()
+
+- (NSUInteger)logRequest:(NSURLRequest *)request;
+
+@end
+
+@interface AWSNetworkingWireLoggerTests : XCTestCase
+
+@end
+
+@implementation AWSNetworkingWireLoggerTests
+
+- (NSString *)messageForBody:(NSString *)body
+           maximumBodyLength:(NSUInteger)maximumBodyLength {
+    __block NSString *loggedMessage = nil;
+    AWSNetworkingWireLogger *wireLogger = [AWSNetworkingWireLogger new];
+    wireLogger.maximumBodyLength = maximumBodyLength;
+    wireLogger.logHandler = ^(NSString *message) {
+        loggedMessage = message;
+    };
+
+    NSMutableURLRequest *request = [NSMutableURLRequest requestWithURL:[NSURL URLWithString:@"https://example.com/"]];
+    request.HTTPMethod = @"POST";
+    request.HTTPBody = [body dataUsingEncoding:NSUTF8StringEncoding];
+    [wireLogger logRequest:request];
+    return loggedMessage;
+}
+
+/**
+ Cuts the body after every character of the secret, so the logged prefix ends inside its value.
+ */
+- (void)assertSecretIsRedactedInBody:(NSString *)body {
+    NSUInteger secretStart = [body rangeOfString:AWSWireLoggerTestSecret].location;
+    for (NSUInteger length = secretStart + 1; length <= [body length]; length++) {
+        NSString *message = [self messageForBody:body maximumBodyLength:length];
+        NSString *secretPrefix = [AWSWireLoggerTestSecret substringToIndex:MIN(length - secretStart, [AWSWireLoggerTestSecret length])];
+        XCTAssertFalse([message containsString:secretPrefix], @"%@", message);
+        XCTAssertTrue([message containsString:@"[redacted]"], @"%@", message);
+    }
+}
+
+- (void)testJSONFieldIsRedacted {
+    NSString *body = [NSString stringWithFormat:@"{\"Password\":\"%@\",\"Username\":\"user\"}", AWSWireLoggerTestSecret];
+    NSString *message = [self messageForBody:body maximumBodyLength:4096];
+    XCTAssertTrue([message containsString:@"{\"Password\":\"[redacted]\",\"Username\":\"user\"}"], @"%@", message);
+}
+
+- (void)testXMLFieldIsRedacted {
+    NSString *body = [NSString stringWithFormat:@"<Credentials><SecretAccessKey>%@</SecretAccessKey></Credentials>", AWSWireLoggerTestSecret];
+    NSString *message = [self messageForBody:body maximumBodyLength:4096];
+    XCTAssertTrue([message containsString:@"<SecretAccessKey>[redacted]</SecretAccessKey>"], @"%@", message);
+}
+
+- (void)testTruncatedJSONFieldIsRedacted {
+    [self assertSecretIsRedactedInBody:[NSString stringWithFormat:@"{\"Password\":\"%@\"}", AWSWireLoggerTestSecret]];
+}
+
+- (void)testTruncatedEscapedJSONFieldIsRedacted {
+    NSString *message = [self messageForBody:@"{\"Password\":\"abc\\\"def\"}" maximumBodyLength:18];
+    XCTAssertFalse([message containsString:@"abc"], @"%@", message);
+}
+
+- (void)testTruncatedXMLFieldIsRedacted {
+    [self assertSecretIsRedactedInBody:[NSString stringWithFormat:@"<SecretAccessKey>%@</SecretAccessKey>", AWSWireLoggerTestSecret]];
+}
+
+- (void)testTruncatedQueryFieldIsRedacted {
+    [self assertSecretIsRedactedInBody:[NSString stringWithFormat:@"Action=AssumeRole&SessionToken=%@", AWSWireLoggerTestSecret]];
+}
+
+@end
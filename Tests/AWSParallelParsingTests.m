@@ -0,0 +1,117 @@
+//
+// Copyright 2010-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import "AWSStandInTestCase.h"
+
+static const NSUInteger AWSParallelParsingIterationCount = 200;
+
+/**
+ Parses the same responses on 1 to N threads at once, from the body to the model, to show whether parsing scales with
+ the cores or waits on shared state: the shape indexes, the lazily parsed definitions and the model adapter.
+ */
+@interface AWSParallelParsingTests : AWSStandInTestCase
+
+@end
+
+@implementation AWSParallelParsingTests
+
+- (NSData *)bodyForOperationName:(NSString *)operationName
+               serviceDefinition:(NSDictionary *)serviceDefinition
+                      listLength:(NSUInteger)listLength {
+    AWSTestShapeResponder *responder = [[AWSTestShapeResponder alloc] initWithServiceDefinition:serviceDefinition];
+    responder.listLength = listLength;
+    return [responder responseForOperationName:operationName].body;
+}
+
+- (NSArray<NSNumber *> *)threadCounts {
+    NSUInteger processorCount = [[NSProcessInfo processInfo] activeProcessorCount];
+    NSMutableArray<NSNumber *> *threadCounts = [NSMutableArray new];
+    for (NSUInteger threadCount = 1; threadCount < processorCount; threadCount *= 2) {
+        [threadCounts addObject:@(threadCount)];
+    }
+    [threadCounts addObject:@(processorCount)];
+    return threadCounts;
+}
+
+- (void)measureParsingWithName:(NSString *)name
+                         block:(id (^)(void))block {
+    __block BOOL parsed = YES;
+    double singleThreadCallsPerSecond = 0;
+    for (NSNumber *threadCount in [self threadCounts]) {
+        double callsPerSecond = [AWSTestLoadGenerator callsPerSecondWithThreadCount:[threadCount unsignedIntegerValue]
+                                                                     iterationCount:AWSParallelParsingIterationCount
+                                                                              block:^(NSUInteger thread, NSUInteger iteration) {
+            @autoreleasepool {
+                if (!block()) {
+                    parsed = NO;
+                }
+            }
+        }];
+        if (singleThreadCallsPerSecond == 0) {
+            singleThreadCallsPerSecond = callsPerSecond;
+        }
+        [self logBenchmark:@"%@ on %@ threads: %.0f calls/s, %.2fx one thread",
+         name, threadCount, callsPerSecond, callsPerSecond / singleThreadCallsPerSecond];
+    }
+    XCTAssertTrue(parsed);
+}
+
+- (void)testParallelParsingBenchmark {
+    NSDictionary *S3Definition = [[AWSS3Resources sharedInstance] JSONObject];
+    NSData *listObjectsBody = [self bodyForOperationName:@"ListObjects" serviceDefinition:S3Definition listLength:100];
+    [self measureParsingWithName:@"rest-xml S3 ListObjects of 100 keys"
+                           block:^id {
+        NSDictionary *result = [[AWSXMLParser sharedInstance] dictionaryForXMLData:listObjectsBody
+                                                                        actionName:@"ListObjects"
+                                                             serviceDefinitionRule:S3Definition
+                                                                             error:nil];
+        return [AWSMTLJSONAdapter modelOfClass:[AWSS3ListObjectsOutput class]
+                            fromJSONDictionary:result
+                                         error:nil];
+    }];
+
+    NSDictionary *SQSDefinition = [[AWSSQSResources sharedInstance] JSONObject];
+    NSData *receiveMessageBody = [self bodyForOperationName:@"ReceiveMessage" serviceDefinition:SQSDefinition listLength:10];
+    [self measureParsingWithName:@"query SQS ReceiveMessage of 10 messages"
+                           block:^id {
+        NSDictionary *result = [[AWSXMLParser sharedInstance] dictionaryForXMLData:receiveMessageBody
+                                                                        actionName:@"ReceiveMessage"
+                                                             serviceDefinitionRule:SQSDefinition
+                                                                             error:nil];
+        return [AWSMTLJSONAdapter modelOfClass:[AWSSQSReceiveMessageResult class]
+                            fromJSONDictionary:result
+                                         error:nil];
+    }];
+
+    NSDictionary *DynamoDBDefinition = [[AWSDynamoDBResources sharedInstance] JSONObject];
+    NSData *queryBody = [self bodyForOperationName:@"Query" serviceDefinition:DynamoDBDefinition listLength:25];
+    NSHTTPURLResponse *response = [[NSHTTPURLResponse alloc] initWithURL:[NSURL URLWithString:@"https://dynamodb.us-east-1.amazonaws.com/"]
+                                                              statusCode:200
+                                                             HTTPVersion:@"HTTP/1.1"
+                                                            headerFields:@{@"Content-Type" : @"application/x-amz-json-1.0"}];
+    [self measureParsingWithName:@"json DynamoDB Query of 25 items"
+                           block:^id {
+        NSDictionary *result = [AWSJSONParser dictionaryForJsonData:queryBody
+                                                           response:response
+                                                         actionName:@"Query"
+                                              serviceDefinitionRule:DynamoDBDefinition
+                                                              error:nil];
+        return [AWSMTLJSONAdapter modelOfClass:[AWSDynamoDBQueryOutput class]
+                            fromJSONDictionary:result
+                                         error:nil];
+    }];
+}
+
+@end
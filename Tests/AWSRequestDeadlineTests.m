@@ -0,0 +1,125 @@
+//
+// Copyright 2010-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import "AWSStandInTestCase.h"
+
+static const NSTimeInterval AWSDeadlineTestLatency = 1;
+
+@interface AWSRequestDeadlineTests : AWSStandInTestCase
+
+@property (nonatomic, strong) AWSTestStandInServer *server;
+@property (nonatomic, strong) AWSServiceConfiguration *configuration;
+
+@end
+
+@implementation AWSRequestDeadlineTests
+
+- (void)setUp {
+    [super setUp];
+    self.server = [self startServerWithServiceDefinition:[[AWSDynamoDBResources sharedInstance] JSONObject]];
+    self.configuration = [self.server serviceConfiguration];
+}
+
+- (NSError *)errorOfTask:(AWSTask *)task {
+    [task waitUntilFinished];
+    XCTAssertNil(task.result);
+    return task.error;
+}
+
+- (void)testPassedDeadlineFailsBeforeSending {
+    AWSDynamoDB *DynamoDB = [self DynamoDBWithConfiguration:self.configuration];
+    AWSDynamoDBListTablesInput *request = [AWSDynamoDBListTablesInput new];
+    request.deadline = [NSDate dateWithTimeIntervalSinceNow:-1];
+
+    NSError *error = [self errorOfTask:[DynamoDB listTables:request]];
+    XCTAssertEqualObjects(error.domain, AWSNetworkingErrorDomain);
+    XCTAssertEqual(error.code, AWSNetworkingErrorDeadlineExceeded);
+    XCTAssertEqual(self.server.requestCount, 0);
+}
+
+- (void)testDeadlineCancelsTheRequestInFlight {
+    self.server.latency = AWSDeadlineTestLatency;
+    AWSDynamoDB *DynamoDB = [self DynamoDBWithConfiguration:self.configuration];
+    AWSDynamoDBListTablesInput *request = [AWSDynamoDBListTablesInput new];
+    request.deadline = [NSDate dateWithTimeIntervalSinceNow:AWSDeadlineTestLatency / 5];
+
+    NSTimeInterval startTime = [AWSNetworkingRequestMetrics currentTime];
+    NSError *error = [self errorOfTask:[DynamoDB listTables:request]];
+    XCTAssertLessThan([AWSNetworkingRequestMetrics currentTime] - startTime, AWSDeadlineTestLatency);
+
+    XCTAssertEqualObjects(error.domain, AWSNetworkingErrorDomain);
+    XCTAssertEqual(error.code, AWSNetworkingErrorDeadlineExceeded);
+    // The cancellation that stopped the attempt is kept for diagnosis.
+    XCTAssertNotNil(error.userInfo[NSUnderlyingErrorKey]);
+    XCTAssertEqual(self.server.requestCount, 1);
+}
+
+- (void)testRetryEndingAfterTheDeadlineIsSkipped {
+    // Legacy back-off waits 0.1, 0.2, 0.4 and 0.8 seconds, so the fifth attempt would start after the deadline.
+    self.server.errorRate = 1;
+    self.server.errorStatusCode = 503;
+    self.configuration.maxRetryCount = 5;
+    self.configuration.retryMode = AWSNetworkingRetryModeLegacy;
+    AWSDynamoDB *DynamoDB = [self DynamoDBWithConfiguration:self.configuration];
+    NSTimeInterval timeIntervalToDeadline = 1.2;
+    AWSDynamoDBListTablesInput *request = [AWSDynamoDBListTablesInput new];
+    request.deadline = [NSDate dateWithTimeIntervalSinceNow:timeIntervalToDeadline];
+
+    NSTimeInterval startTime = [AWSNetworkingRequestMetrics currentTime];
+    NSError *error = [self errorOfTask:[DynamoDB listTables:request]];
+
+    // The request gives up when the back-off is due, not when the deadline timer fires.
+    XCTAssertLessThan([AWSNetworkingRequestMetrics currentTime] - startTime, timeIntervalToDeadline);
+    XCTAssertEqual(error.code, AWSNetworkingErrorDeadlineExceeded);
+    NSError *underlyingError = error.userInfo[NSUnderlyingErrorKey];
+    XCTAssertNotNil(underlyingError);
+    XCTAssertNotEqualObjects(underlyingError.domain, AWSNetworkingErrorDomain);
+    XCTAssertEqual(self.server.requestCount, 4);
+}
+
+- (void)testCancelledTokenFailsBeforeSending {
+    AWSDynamoDB *DynamoDB = [self DynamoDBWithConfiguration:self.configuration];
+    AWSCancellationTokenSource *cancellationTokenSource = [AWSCancellationTokenSource cancellationTokenSource];
+    [cancellationTokenSource cancel];
+    AWSDynamoDBListTablesInput *request = [AWSDynamoDBListTablesInput new];
+    request.cancellationToken = cancellationTokenSource.token;
+
+    NSError *error = [self errorOfTask:[DynamoDB listTables:request]];
+    XCTAssertEqualObjects(error.domain, AWSNetworkingErrorDomain);
+    XCTAssertEqual(error.code, AWSNetworkingErrorCancelled);
+    XCTAssertEqual(self.server.requestCount, 0);
+}
+
+- (void)testCancellingTheTokenCancelsTheRequestInFlight {
+    self.server.latency = AWSDeadlineTestLatency;
+    AWSDynamoDB *DynamoDB = [self DynamoDBWithConfiguration:self.configuration];
+    AWSCancellationTokenSource *cancellationTokenSource = [AWSCancellationTokenSource cancellationTokenSource];
+    AWSDynamoDBListTablesInput *request = [AWSDynamoDBListTablesInput new];
+    request.cancellationToken = cancellationTokenSource.token;
+
+    NSTimeInterval startTime = [AWSNetworkingRequestMetrics currentTime];
+    AWSTask *task = [DynamoDB listTables:request];
+    [cancellationTokenSource cancelAfterDelay:(int)(AWSDeadlineTestLatency * 1000 / 5)];
+    NSError *error = [self errorOfTask:task];
+    XCTAssertLessThan([AWSNetworkingRequestMetrics currentTime] - startTime, AWSDeadlineTestLatency);
+
+    XCTAssertTrue(request.isCancelled);
+    XCTAssertEqualObjects(error.domain, AWSNetworkingErrorDomain);
+    XCTAssertEqual(error.code, AWSNetworkingErrorCancelled);
+    XCTAssertNotNil(error.userInfo[NSUnderlyingErrorKey]);
+    XCTAssertEqual(self.server.requestCount, 1);
+}
+
+@end
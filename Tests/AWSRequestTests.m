@@ -0,0 +1,66 @@
+//
+// Copyright 2010-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <XCTest/XCTest.h>
+#import <awsosx/awsosx.h>
+
+@interface AWSRequestTests : XCTestCase
+
+@end
+
+@implementation AWSRequestTests
+
+- (AWSDynamoDBGetItemInput *)getItemInput {
+    AWSDynamoDBAttributeValue *key = [AWSDynamoDBAttributeValue new];
+    key.S = @"key";
+    AWSDynamoDBGetItemInput *request = [AWSDynamoDBGetItemInput new];
+    request.tableName = @"table";
+    request.key = @{@"id" : key};
+    return request;
+}
+
+- (void)testPriorityIsNotAParameter {
+    AWSDynamoDBGetItemInput *request = [self getItemInput];
+    AWSDynamoDBGetItemInput *bulkRequest = [self getItemInput];
+    bulkRequest.priority = AWSNetworkingRequestPriorityBulk;
+
+    XCTAssertNil([bulkRequest dictionaryValue][@"priority"]);
+    XCTAssertEqualObjects([request dictionaryValue], [bulkRequest dictionaryValue]);
+    XCTAssertEqualObjects(request, bulkRequest);
+    XCTAssertEqual([request hash], [bulkRequest hash]);
+}
+
+- (void)testDeadlineAndCancellationTokenAreNotParameters {
+    AWSDynamoDBGetItemInput *request = [self getItemInput];
+    AWSDynamoDBGetItemInput *boundedRequest = [self getItemInput];
+    boundedRequest.deadline = [NSDate dateWithTimeIntervalSinceNow:5];
+    boundedRequest.cancellationToken = [AWSCancellationTokenSource cancellationTokenSource].token;
+
+    NSDictionary *dictionaryValue = [boundedRequest dictionaryValue];
+    XCTAssertNil(dictionaryValue[@"deadline"]);
+    XCTAssertNil(dictionaryValue[@"cancellationToken"]);
+    XCTAssertEqualObjects(request, boundedRequest);
+    XCTAssertEqual([request hash], [boundedRequest hash]);
+
+    // The JSON builder falls back to a slow path for parameters NSJSONSerialization cannot write.
+    AWSDynamoDBListTablesInput *listRequest = [AWSDynamoDBListTablesInput new];
+    listRequest.exclusiveStartTableName = @"table";
+    listRequest.limit = @10;
+    listRequest.deadline = boundedRequest.deadline;
+    listRequest.cancellationToken = boundedRequest.cancellationToken;
+    XCTAssertTrue([NSJSONSerialization isValidJSONObject:[listRequest dictionaryValue]]);
+}
+
+@end
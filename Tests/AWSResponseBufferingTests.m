@@ -0,0 +1,87 @@
+//
+// Copyright 2010-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import "AWSStandInTestCase.h"
+
+/**
+ Set to run the 512 MB bodies, which need more than a gigabyte of memory.
+ */
+static NSString *const AWSBenchmarkLargeEnvironmentKey = @"AWS_BENCHMARK_LARGE";
+
+/**
+ Fetches in-memory S3 objects of 1 MB, 64 MB and 512 MB, once with a `Content-Length` the first 4 MB of the body are
+ preallocated from and once chunked, where the body is kept as a list of chunks until it is read.
+ */
+@interface AWSResponseBufferingTests : AWSStandInTestCase
+
+@end
+
+@implementation AWSResponseBufferingTests
+
+- (void)measureGetObjectWithLength:(unsigned long long)length
+                      requestCount:(NSUInteger)requestCount
+                           chunked:(BOOL)chunked {
+    AWSTestStandInServer *server = [self startServerWithServiceDefinition:[[AWSS3Resources sharedInstance] JSONObject]];
+    ((AWSTestShapeResponder *)server.responder).payloadLength = length;
+    server.sendsChunkedBodies = chunked;
+    AWSS3 *S3 = [self S3WithConfiguration:[server serviceConfiguration]];
+
+    __block BOOL lengthsMatch = YES;
+    uint64_t startFootprint = [AWSTestLoadGenerator physicalFootprint];
+    NSString *name = [NSString stringWithFormat:@"S3 GetObject %llu MB, %@", length / (1024 * 1024), chunked ? @"chunked" : @"Content-Length"];
+    AWSTestLoadReport *report = [AWSTestLoadGenerator runWithName:name
+                                                     requestCount:requestCount
+                                                      concurrency:1
+                                                        operation:^AWSTask *(NSUInteger index) {
+        AWSS3GetObjectRequest *request = [AWSS3GetObjectRequest new];
+        request.bucket = @"bucket";
+        request.key = [NSString stringWithFormat:@"object-%lu", (unsigned long)index];
+        return [[S3 getObject:request] continueWithSuccessBlock:^id(AWSTask<AWSS3GetObjectOutput *> *task) {
+            if ([task.result.body length] != length) {
+                lengthsMatch = NO;
+            }
+            return nil;
+        }];
+    }];
+    uint64_t endFootprint = [AWSTestLoadGenerator physicalFootprint];
+    uint64_t footprintGrowth = endFootprint > startFootprint ? endFootprint - startFootprint : 0;
+
+    [self logBenchmark:@"%@, %.1f bytes allocated per body byte, footprint grew %llu MB",
+     report, report.allocatedBytesPerRequest / length, footprintGrowth / (1024 * 1024)];
+    XCTAssertEqual(report.errorCount, 0);
+    XCTAssertTrue(lengthsMatch);
+}
+
+- (void)test1MBBodies {
+    [self measureGetObjectWithLength:1024 * 1024 requestCount:32 chunked:NO];
+    [self measureGetObjectWithLength:1024 * 1024 requestCount:32 chunked:YES];
+}
+
+- (void)test64MBBodies {
+    [self measureGetObjectWithLength:64 * 1024 * 1024 requestCount:4 chunked:NO];
+    [self measureGetObjectWithLength:64 * 1024 * 1024 requestCount:4 chunked:YES];
+}
+
+- (void)test512MBBodies {
+    if (![[NSProcessInfo processInfo] environment][AWSBenchmarkLargeEnvironmentKey]) {
+        NSLog(@"%@ skipped; set %@ to run it.", self.name, AWSBenchmarkLargeEnvironmentKey);
+        return;
+    }
+
+    [self measureGetObjectWithLength:512ull * 1024 * 1024 requestCount:1 chunked:NO];
+    [self measureGetObjectWithLength:512ull * 1024 * 1024 requestCount:1 chunked:YES];
+}
+
+@end
@@ -0,0 +1,118 @@
+//
+// Copyright 2010-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import "AWSStandInTestCase.h"
+
+static const NSUInteger AWSRetryStormRequestCount = 1000;
+static const NSUInteger AWSRetryStormFailuresPerRequest = 2;
+static const uint32_t AWSRetryStormMaxRetryCount = 3;
+
+/**
+ Drives 1,000 concurrent requests that each get two 503s before they succeed. The session manager waits out the
+ back-off on a dispatch timer; the blocking run reproduces the previous behaviour, which slept on a delegate queue
+ thread for every backing-off request.
+ */
+@interface AWSRetrySchedulingTests : AWSStandInTestCase
+
+@end
+
+@implementation AWSRetrySchedulingTests
+
+- (AWSDynamoDBPutItemInput *)putItemInputWithIndex:(NSUInteger)index {
+    AWSDynamoDBAttributeValue *value = [AWSDynamoDBAttributeValue new];
+    value.S = [NSString stringWithFormat:@"item %lu", (unsigned long)index];
+    AWSDynamoDBPutItemInput *request = [AWSDynamoDBPutItemInput new];
+    request.tableName = @"table";
+    request.item = @{@"id" : value};
+    return request;
+}
+
+- (AWSTestStandInServer *)startStormServer {
+    AWSTestStandInServer *server = [self startServerWithServiceDefinition:[[AWSDynamoDBResources sharedInstance] JSONObject]];
+    server.failuresPerRequest = AWSRetryStormFailuresPerRequest;
+    server.errorStatusCode = 503;
+    return server;
+}
+
+- (void)testRetryStormWithTimerScheduling {
+    AWSTestStandInServer *server = [self startStormServer];
+    AWSServiceConfiguration *configuration = [server serviceConfiguration];
+    configuration.maxRetryCount = AWSRetryStormMaxRetryCount;
+    AWSDynamoDB *DynamoDB = [self DynamoDBWithConfiguration:configuration];
+
+    NSUInteger baselineThreadCount = [AWSTestLoadGenerator threadCount];
+    AWSTestLoadReport *report = [AWSTestLoadGenerator runWithName:@"retry storm, timer back-off"
+                                                     requestCount:AWSRetryStormRequestCount
+                                                      concurrency:AWSRetryStormRequestCount
+                                                        operation:^AWSTask *(NSUInteger index) {
+        return [DynamoDB putItem:[self putItemInputWithIndex:index]];
+    }];
+    [self logBenchmark:@"%@, %lu threads before the run", report, (unsigned long)baselineThreadCount];
+
+    XCTAssertEqual(report.errorCount, 0);
+    XCTAssertEqual(server.injectedErrorCount, AWSRetryStormRequestCount * AWSRetryStormFailuresPerRequest);
+    // Waiting requests hold no thread, so the storm must not grow the process by a thread per request.
+    XCTAssertLessThan(report.peakThreadCount, baselineThreadCount + 128);
+}
+
+- (void)testRetryStormWithBlockingBackOff {
+    AWSTestStandInServer *server = [self startStormServer];
+    AWSServiceConfiguration *configuration = [server serviceConfiguration];
+    configuration.maxRetryCount = 0;
+    AWSDynamoDB *DynamoDB = [self DynamoDBWithConfiguration:configuration];
+
+    AWSURLRequestRetryHandler *retryHandler = [[AWSURLRequestRetryHandler alloc] initWithMaximumRetryCount:AWSRetryStormMaxRetryCount];
+    NSOperationQueue *delegateQueue = [NSOperationQueue new];
+
+    __block AWSTask *(^putItem)(NSUInteger index, uint32_t retryCount);
+    AWSTask *(^blockingPutItem)(NSUInteger, uint32_t) = ^AWSTask *(NSUInteger index, uint32_t retryCount) {
+        return [[DynamoDB putItem:[self putItemInputWithIndex:index]] continueWithBlock:^id(AWSTask *task) {
+            if (!task.error || retryCount >= AWSRetryStormMaxRetryCount) {
+                return task;
+            }
+            AWSTaskCompletionSource *retry = [AWSTaskCompletionSource taskCompletionSource];
+            [delegateQueue addOperationWithBlock:^{
+                [NSThread sleepForTimeInterval:[retryHandler timeIntervalForRetry:retryCount
+                                                                         response:nil
+                                                                             data:nil
+                                                                            error:task.error]];
+                [putItem(index, retryCount + 1) continueWithBlock:^id(AWSTask *retriedTask) {
+                    if (retriedTask.error) {
+                        [retry setError:retriedTask.error];
+                    } else {
+                        [retry setResult:retriedTask.result];
+                    }
+                    return nil;
+                }];
+            }];
+            return retry.task;
+        }];
+    };
+    putItem = blockingPutItem;
+
+    NSUInteger baselineThreadCount = [AWSTestLoadGenerator threadCount];
+    AWSTestLoadReport *report = [AWSTestLoadGenerator runWithName:@"retry storm, blocking back-off"
+                                                     requestCount:AWSRetryStormRequestCount
+                                                      concurrency:AWSRetryStormRequestCount
+                                                        operation:^AWSTask *(NSUInteger index) {
+        return putItem(index, 0);
+    }];
+    [self logBenchmark:@"%@, %lu threads before the run", report, (unsigned long)baselineThreadCount];
+    putItem = nil;
+
+    XCTAssertEqual(report.errorCount, 0);
+}
+
+@end
@@ -0,0 +1,179 @@
+//
+// Copyright 2010-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import "AWSStandInTestCase.h"
+
+static const NSUInteger AWSSerializerBenchmarkRequestCount = 5000;
+
+@interface AWSDynamoDB()
+
+- (instancetype)initWithConfiguration:(AWSServiceConfiguration *)configuration;
+
+@end
+
+@interface AWSSQS()
+
+- (instancetype)initWithConfiguration:(AWSServiceConfiguration *)configuration;
+
+@end
+
+/**
+ Clients that create their serializers for every call, as all clients did before they kept them.
+ */
+@interface AWSUncachedSerializersDynamoDB : AWSDynamoDB
+
+@end
+
+@implementation AWSUncachedSerializersDynamoDB
+
+- (id<AWSURLRequestSerializer>)requestSerializerForOperationName:(NSString *)operationName
+                                                      usingBlock:(id<AWSURLRequestSerializer> (^)(void))block {
+    return block();
+}
+
+- (id<AWSHTTPURLResponseSerializer>)responseSerializerForOperationName:(NSString *)operationName
+                                                            usingBlock:(id<AWSHTTPURLResponseSerializer> (^)(void))block {
+    return block();
+}
+
+@end
+
+@interface AWSUncachedSerializersSQS : AWSSQS
+
+@end
+
+@implementation AWSUncachedSerializersSQS
+
+- (id<AWSURLRequestSerializer>)requestSerializerForOperationName:(NSString *)operationName
+                                                      usingBlock:(id<AWSURLRequestSerializer> (^)(void))block {
+    return block();
+}
+
+- (id<AWSHTTPURLResponseSerializer>)responseSerializerForOperationName:(NSString *)operationName
+                                                            usingBlock:(id<AWSHTTPURLResponseSerializer> (^)(void))block {
+    return block();
+}
+
+@end
+
+/**
+ Service clients keep one request and one response serializer per operation. These benchmarks measure the calls per
+ second of DynamoDB PutItem and SQS SendMessage, and the same calls through clients that create their serializers
+ for every call.
+ */
+@interface AWSSerializerCacheTests : AWSStandInTestCase
+
+@end
+
+@implementation AWSSerializerCacheTests
+
+- (AWSDynamoDBPutItemInput *)putItemInputWithIndex:(NSUInteger)index {
+    AWSDynamoDBAttributeValue *key = [AWSDynamoDBAttributeValue new];
+    key.S = [NSString stringWithFormat:@"item-%lu", (unsigned long)index];
+    AWSDynamoDBAttributeValue *value = [AWSDynamoDBAttributeValue new];
+    value.N = @"42";
+    AWSDynamoDBPutItemInput *request = [AWSDynamoDBPutItemInput new];
+    request.tableName = @"table";
+    request.item = @{@"id" : key, @"value" : value};
+    return request;
+}
+
+- (AWSSQSSendMessageRequest *)sendMessageRequestWithIndex:(NSUInteger)index {
+    AWSSQSSendMessageRequest *request = [AWSSQSSendMessageRequest new];
+    request.queueUrl = @"https://sqs.us-east-1.amazonaws.com/123456789012/queue";
+    request.messageBody = [NSString stringWithFormat:@"message %lu", (unsigned long)index];
+    return request;
+}
+
+- (void)testAdditionalParametersAreFixedAtCreation {
+    NSMutableDictionary *additionalParameters = [NSMutableDictionary dictionaryWithObject:@"added" forKey:@"MessageBody"];
+    AWSQueryStringRequestSerializer *serializer = [[AWSQueryStringRequestSerializer alloc] initWithJSONDefinition:[[AWSSQSResources sharedInstance] JSONObject]
+                                                                                                       actionName:@"SendMessage"
+                                                                                             additionalParameters:additionalParameters];
+    additionalParameters[@"MessageBody"] = @"changed";
+
+    NSMutableURLRequest *request = [NSMutableURLRequest requestWithURL:[NSURL URLWithString:@"https://sqs.us-east-1.amazonaws.com/"]];
+    request.HTTPMethod = @"POST";
+    [[serializer serializeRequest:request
+                          headers:nil
+                       parameters:@{@"QueueUrl" : @"https://sqs.us-east-1.amazonaws.com/123456789012/queue"}] waitUntilFinished];
+    NSString *body = [[NSString alloc] initWithData:request.HTTPBody encoding:NSUTF8StringEncoding];
+    XCTAssertTrue([body containsString:@"MessageBody=added"], @"%@", body);
+}
+
+#pragma mark - Benchmarks
+
+- (void)testPutItemAndSendMessageBenchmark {
+    AWSTestStandInServer *DynamoDBServer = [self startServerWithServiceDefinition:[[AWSDynamoDBResources sharedInstance] JSONObject]];
+    AWSDynamoDB *DynamoDB = [self DynamoDBWithConfiguration:[DynamoDBServer serviceConfiguration]];
+    AWSTestStandInServer *SQSServer = [self startServerWithServiceDefinition:[[AWSSQSResources sharedInstance] JSONObject]];
+    AWSSQS *SQS = [self SQSWithConfiguration:[SQSServer serviceConfiguration]];
+
+    for (NSNumber *concurrency in @[@1, @16]) {
+        AWSTestLoadReport *putItemReport = [AWSTestLoadGenerator runWithName:[NSString stringWithFormat:@"DynamoDB PutItem, %@ at a time", concurrency]
+                                                                requestCount:AWSSerializerBenchmarkRequestCount
+                                                                 concurrency:[concurrency unsignedIntegerValue]
+                                                                   operation:^AWSTask *(NSUInteger index) {
+            return [DynamoDB putItem:[self putItemInputWithIndex:index]];
+        }];
+        [self logBenchmark:@"%@", putItemReport];
+        XCTAssertEqual(putItemReport.errorCount, 0);
+
+        AWSTestLoadReport *sendMessageReport = [AWSTestLoadGenerator runWithName:[NSString stringWithFormat:@"SQS SendMessage, %@ at a time", concurrency]
+                                                                    requestCount:AWSSerializerBenchmarkRequestCount
+                                                                     concurrency:[concurrency unsignedIntegerValue]
+                                                                       operation:^AWSTask *(NSUInteger index) {
+            return [SQS sendMessage:[self sendMessageRequestWithIndex:index]];
+        }];
+        [self logBenchmark:@"%@", sendMessageReport];
+        XCTAssertEqual(sendMessageReport.errorCount, 0);
+    }
+}
+
+- (void)testCachedSerializerBenchmark {
+    AWSTestStandInServer *DynamoDBServer = [self startServerWithServiceDefinition:[[AWSDynamoDBResources sharedInstance] JSONObject]];
+    AWSServiceConfiguration *DynamoDBConfiguration = [DynamoDBServer serviceConfiguration];
+    AWSDynamoDB *DynamoDB = [self DynamoDBWithConfiguration:DynamoDBConfiguration];
+    AWSDynamoDB *uncachedDynamoDB = [[AWSUncachedSerializersDynamoDB alloc] initWithConfiguration:DynamoDBConfiguration];
+    AWSTestStandInServer *SQSServer = [self startServerWithServiceDefinition:[[AWSSQSResources sharedInstance] JSONObject]];
+    AWSServiceConfiguration *SQSConfiguration = [SQSServer serviceConfiguration];
+    AWSSQS *SQS = [self SQSWithConfiguration:SQSConfiguration];
+    AWSSQS *uncachedSQS = [[AWSUncachedSerializersSQS alloc] initWithConfiguration:SQSConfiguration];
+
+    NSDictionary<NSString *, AWSTask *(^)(NSUInteger)> *operations = @{
+        @"DynamoDB PutItem, serializers kept" : ^AWSTask *(NSUInteger index) {
+            return [DynamoDB putItem:[self putItemInputWithIndex:index]];
+        },
+        @"DynamoDB PutItem, serializers created per call" : ^AWSTask *(NSUInteger index) {
+            return [uncachedDynamoDB putItem:[self putItemInputWithIndex:index]];
+        },
+        @"SQS SendMessage, serializers kept" : ^AWSTask *(NSUInteger index) {
+            return [SQS sendMessage:[self sendMessageRequestWithIndex:index]];
+        },
+        @"SQS SendMessage, serializers created per call" : ^AWSTask *(NSUInteger index) {
+            return [uncachedSQS sendMessage:[self sendMessageRequestWithIndex:index]];
+        },
+    };
+    for (NSString *name in [[operations allKeys] sortedArrayUsingSelector:@selector(compare:)]) {
+        AWSTestLoadReport *report = [AWSTestLoadGenerator runWithName:name
+                                                         requestCount:AWSSerializerBenchmarkRequestCount
+                                                          concurrency:1
+                                                            operation:operations[name]];
+        [self logBenchmark:@"%@", report];
+        XCTAssertEqual(report.errorCount, 0);
+    }
+}
+
+@end
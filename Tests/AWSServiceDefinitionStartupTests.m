@@ -0,0 +1,128 @@
+//
+// Copyright 2010-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import "AWSStandInTestCase.h"
+
+static const NSUInteger AWSStartupBenchmarkWarmCallCount = 100;
+
+@interface NSObject (AWSServiceDefinitionStartupTests)
+
+- (NSString *)definitionString;
+
+@end
+
+/**
+ Measures what a client pays for its service definition before its first response: parsing the packed definition, and
+ the first call, which parses the operation and the shapes it uses.
+ */
+@interface AWSServiceDefinitionStartupTests : AWSStandInTestCase
+
+@end
+
+@implementation AWSServiceDefinitionStartupTests
+
+- (NSArray *)sharedResources {
+    return @[[AWSCloudWatchResources sharedInstance],
+             [AWSDynamoDBResources sharedInstance],
+             [AWSKMSResources sharedInstance],
+             [AWSLambdaResources sharedInstance],
+             [AWSS3Resources sharedInstance],
+             [AWSSESResources sharedInstance],
+             [AWSSNSResources sharedInstance],
+             [AWSSQSResources sharedInstance]];
+}
+
+- (void)testLazyDefinitionsMatchTheirJSON {
+    for (id resources in [self sharedResources]) {
+        NSString *definitionString = [resources definitionString];
+        NSDictionary *definition = [NSJSONSerialization JSONObjectWithData:[definitionString dataUsingEncoding:NSUTF8StringEncoding]
+                                                                   options:0
+                                                                     error:nil];
+        AWSLazyJSONDictionary *lazyDefinition = [[AWSLazyJSONDictionary alloc] initWithJSONString:definitionString error:nil];
+        XCTAssertEqualObjects(lazyDefinition, definition, @"%@", NSStringFromClass([resources class]));
+    }
+}
+
+#pragma mark - Benchmarks
+
+- (void)testColdParseBenchmark {
+    for (id resources in [self sharedResources]) {
+        NSString *definitionString = [resources definitionString];
+        NSString *resourcesName = NSStringFromClass([resources class]);
+
+        // All of it, as before the definitions were parsed lazily.
+        __block NSDictionary *definition = nil;
+        NSTimeInterval startTime = [AWSNetworkingRequestMetrics currentTime];
+        AWSTestAllocationCounter *eagerAllocations = [AWSTestAllocationCounter measure:^{
+            definition = [NSJSONSerialization JSONObjectWithData:[definitionString dataUsingEncoding:NSUTF8StringEncoding]
+                                                         options:0
+                                                           error:nil];
+        }];
+        NSTimeInterval eagerDuration = [AWSNetworkingRequestMetrics currentTime] - startTime;
+
+        // Only what the first call of one operation reads.
+        NSString *operationName = [[[definition[@"operations"] allKeys] sortedArrayUsingSelector:@selector(compare:)] firstObject];
+        startTime = [AWSNetworkingRequestMetrics currentTime];
+        AWSTestAllocationCounter *lazyAllocations = [AWSTestAllocationCounter measure:^{
+            AWSLazyJSONDictionary *lazyDefinition = [[AWSLazyJSONDictionary alloc] initWithJSONString:definitionString error:nil];
+            NSDictionary *operation = lazyDefinition[@"operations"][operationName];
+            NSDictionary *shapes = lazyDefinition[@"shapes"];
+            [[AWSJSONShapeIndex shapeIndexForDefinitionRule:shapes] rulesForDictionary:operation[@"input"]];
+            [[AWSJSONShapeIndex shapeIndexForDefinitionRule:shapes] rulesForDictionary:operation[@"output"]];
+        }];
+        NSTimeInterval lazyDuration = [AWSNetworkingRequestMetrics currentTime] - startTime;
+
+        [self logBenchmark:@"%@ (%lu KB): NSJSONSerialization %.2f ms, %llu allocations, %llu KB; lazy with %@ %.2f ms, %llu allocations, %llu KB",
+         resourcesName,
+         (unsigned long)[definitionString length] / 1024,
+         eagerDuration * 1000,
+         eagerAllocations.allocationCount,
+         eagerAllocations.allocatedBytes / 1024,
+         operationName,
+         lazyDuration * 1000,
+         lazyAllocations.allocationCount,
+         lazyAllocations.allocatedBytes / 1024];
+    }
+}
+
+- (void)testFirstCallBenchmark {
+    // The server reads its own copy of the definition, so the client's is parsed only by the client. KMS ListAliases
+    // is not called by any other test; run this test alone for a cold process.
+    AWSLazyJSONDictionary *serverDefinition = [[AWSLazyJSONDictionary alloc] initWithJSONString:[[AWSKMSResources sharedInstance] definitionString]
+                                                                                          error:nil];
+    AWSTestStandInServer *server = [self startServerWithServiceDefinition:serverDefinition];
+    uint64_t startFootprint = [AWSTestLoadGenerator physicalFootprint];
+
+    NSTimeInterval startTime = [AWSNetworkingRequestMetrics currentTime];
+    AWSKMS *KMS = [self KMSWithConfiguration:[server serviceConfiguration]];
+    [self resultOfTask:[KMS listAliases:[AWSKMSListAliasesRequest new]]];
+    NSTimeInterval firstCallLatency = [AWSNetworkingRequestMetrics currentTime] - startTime;
+    uint64_t firstCallFootprint = [AWSTestLoadGenerator physicalFootprint];
+
+    AWSTestLoadReport *report = [AWSTestLoadGenerator runWithName:@"KMS ListAliases after the first call"
+                                                     requestCount:AWSStartupBenchmarkWarmCallCount
+                                                      concurrency:1
+                                                        operation:^AWSTask *(NSUInteger index) {
+        return [KMS listAliases:[AWSKMSListAliasesRequest new]];
+    }];
+
+    [self logBenchmark:@"KMS client creation and first ListAliases %.2f ms, footprint grew %llu KB; %@",
+     firstCallLatency * 1000,
+     (firstCallFootprint > startFootprint ? firstCallFootprint - startFootprint : 0) / 1024,
+     report];
+    XCTAssertEqual(report.errorCount, 0);
+}
+
+@end
@@ -0,0 +1,248 @@
+//
+// Copyright 2010-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import "AWSStandInTestCase.h"
+
+static const NSUInteger AWSStandInLoadRequestCount = 2000;
+static const NSUInteger AWSStandInLoadConcurrency = 16;
+
+@interface AWSStandInServerTests : AWSStandInTestCase
+
+@end
+
+@implementation AWSStandInServerTests
+
+#pragma mark - Protocols
+
+- (void)testQueryResponsesFollowTheOutputShape {
+    AWSTestStandInServer *server = [self startServerWithServiceDefinition:[[AWSSQSResources sharedInstance] JSONObject]];
+    ((AWSTestShapeResponder *)server.responder).listLength = 10;
+    AWSSQS *SQS = [self SQSWithConfiguration:[server serviceConfiguration]];
+
+    AWSSQSReceiveMessageRequest *request = [AWSSQSReceiveMessageRequest new];
+    request.queueUrl = [[server.URL URLByAppendingPathComponent:@"123456789012/queue"] absoluteString];
+    request.maxNumberOfMessages = @10;
+    AWSSQSReceiveMessageResult *result = [self resultOfTask:[SQS receiveMessage:request]];
+
+    XCTAssertEqual([result.messages count], 10);
+    XCTAssertEqualObjects(result.messages[0].messageId, @"MessageId-0");
+    XCTAssertEqualObjects(result.messages[9].body, @"Body-9");
+}
+
+- (void)testQueryOperationsWithoutOutputSucceed {
+    AWSTestStandInServer *server = [self startServerWithServiceDefinition:[[AWSCloudWatchResources sharedInstance] JSONObject]];
+    AWSCloudWatch *CloudWatch = [self CloudWatchWithConfiguration:[server serviceConfiguration]];
+
+    AWSCloudWatchMetricDatum *datum = [AWSCloudWatchMetricDatum new];
+    datum.metricName = @"Latency";
+    datum.value = @12.5;
+    AWSCloudWatchPutMetricDataInput *request = [AWSCloudWatchPutMetricDataInput new];
+    request.namespace = @"StandIn";
+    request.metricData = @[datum];
+    [self resultOfTask:[CloudWatch putMetricData:request]];
+
+    XCTAssertEqual(server.requestCount, 1);
+}
+
+- (void)testJSONResponsesFollowTheOutputShape {
+    AWSTestStandInServer *server = [self startServerWithServiceDefinition:[[AWSDynamoDBResources sharedInstance] JSONObject]];
+    AWSTestShapeResponder *responder = (AWSTestShapeResponder *)server.responder;
+    responder.listLength = 5;
+    responder.mapLength = 4;
+    AWSDynamoDB *DynamoDB = [self DynamoDBWithConfiguration:[server serviceConfiguration]];
+
+    AWSDynamoDBListTablesOutput *tables = [self resultOfTask:[DynamoDB listTables:[AWSDynamoDBListTablesInput new]]];
+    XCTAssertEqual([tables.tableNames count], 5);
+
+    AWSDynamoDBAttributeValue *key = [AWSDynamoDBAttributeValue new];
+    key.S = @"key";
+    AWSDynamoDBGetItemInput *request = [AWSDynamoDBGetItemInput new];
+    request.tableName = @"table";
+    request.key = @{@"id" : key};
+    AWSDynamoDBGetItemOutput *item = [self resultOfTask:[DynamoDB getItem:request]];
+    XCTAssertEqual([item.item count], 4);
+    XCTAssertEqualObjects(item.item[@"key-0"].S, @"S-0");
+
+    AWSTestStandInServer *KMSServer = [self startServerWithServiceDefinition:[[AWSKMSResources sharedInstance] JSONObject]];
+    AWSKMS *KMS = [self KMSWithConfiguration:[KMSServer serviceConfiguration]];
+    AWSKMSListKeysResponse *keys = [self resultOfTask:[KMS listKeys:[AWSKMSListKeysRequest new]]];
+    XCTAssertEqual([keys.keys count], 3);
+}
+
+- (void)testRestJSONResponsesFollowTheOutputShape {
+    AWSTestStandInServer *server = [self startServerWithServiceDefinition:[[AWSLambdaResources sharedInstance] JSONObject]];
+    AWSLambda *Lambda = [self LambdaWithConfiguration:[server serviceConfiguration]];
+
+    AWSLambdaListFunctionsResponse *functions = [self resultOfTask:[Lambda listFunctions:[AWSLambdaListFunctionsRequest new]]];
+    XCTAssertEqual([functions.functions count], 3);
+}
+
+- (void)testRestXMLResponsesFollowTheOutputShape {
+    AWSTestStandInServer *server = [self startServerWithServiceDefinition:[[AWSS3Resources sharedInstance] JSONObject]];
+    AWSTestShapeResponder *responder = (AWSTestShapeResponder *)server.responder;
+    responder.listLength = 100;
+    responder.payloadLength = 1024 * 1024;
+    AWSS3 *S3 = [self S3WithConfiguration:[server serviceConfiguration]];
+
+    AWSS3ListObjectsRequest *listRequest = [AWSS3ListObjectsRequest new];
+    listRequest.bucket = @"bucket";
+    AWSS3ListObjectsOutput *objects = [self resultOfTask:[S3 listObjects:listRequest]];
+    XCTAssertEqual([objects.contents count], 100);
+    XCTAssertEqualObjects(objects.contents[42].key, @"Key-42");
+
+    AWSS3GetObjectRequest *getRequest = [AWSS3GetObjectRequest new];
+    getRequest.bucket = @"bucket";
+    getRequest.key = @"path/to/object";
+    AWSS3GetObjectOutput *object = [self resultOfTask:[S3 getObject:getRequest]];
+    XCTAssertEqual([object.body length], 1024 * 1024);
+}
+
+#pragma mark - Injection
+
+- (void)testInjectedErrorsReachTheCaller {
+    AWSTestStandInServer *server = [self startServerWithServiceDefinition:[[AWSSNSResources sharedInstance] JSONObject]];
+    server.errorRate = 1;
+    server.errorStatusCode = 400;
+    server.errorCode = @"InvalidParameter";
+    AWSServiceConfiguration *configuration = [server serviceConfiguration];
+    configuration.maxRetryCount = 0;
+    AWSSNS *SNS = [self SNSWithConfiguration:configuration];
+
+    AWSSNSPublishInput *request = [AWSSNSPublishInput new];
+    request.topicArn = @"arn:aws:sns:us-east-1:123456789012:topic";
+    request.message = @"message";
+    AWSTask *task = [SNS publish:request];
+    [task waitUntilFinished];
+
+    XCTAssertNotNil(task.error);
+    XCTAssertEqual(server.injectedErrorCount, 1);
+}
+
+- (void)testFailuresPerRequestAreRetried {
+    AWSTestStandInServer *server = [self startServerWithServiceDefinition:[[AWSSNSResources sharedInstance] JSONObject]];
+    server.failuresPerRequest = 2;
+    AWSServiceConfiguration *configuration = [server serviceConfiguration];
+    configuration.maxRetryCount = 3;
+    AWSSNS *SNS = [self SNSWithConfiguration:configuration];
+
+    AWSSNSPublishInput *request = [AWSSNSPublishInput new];
+    request.topicArn = @"arn:aws:sns:us-east-1:123456789012:topic";
+    request.message = @"message";
+    AWSSNSPublishResponse *response = [self resultOfTask:[SNS publish:request]];
+
+    XCTAssertEqualObjects(response.messageId, @"MessageId-0");
+    XCTAssertEqual(server.requestCount, 3);
+    XCTAssertEqual(server.injectedErrorCount, 2);
+}
+
+- (void)testLatencyIsInjected {
+    AWSTestStandInServer *server = [self startServerWithServiceDefinition:[[AWSDynamoDBResources sharedInstance] JSONObject]];
+    server.latency = 0.2;
+    AWSDynamoDB *DynamoDB = [self DynamoDBWithConfiguration:[server serviceConfiguration]];
+
+    NSTimeInterval startTime = [AWSNetworkingRequestMetrics currentTime];
+    [self resultOfTask:[DynamoDB listTables:[AWSDynamoDBListTablesInput new]]];
+    XCTAssertGreaterThanOrEqual([AWSNetworkingRequestMetrics currentTime] - startTime, 0.2);
+}
+
+#pragma mark - Load
+
+- (void)testLoadQuery {
+    AWSTestStandInServer *server = [self startServerWithServiceDefinition:[[AWSSQSResources sharedInstance] JSONObject]];
+    AWSSQS *SQS = [self SQSWithConfiguration:[server serviceConfiguration]];
+    NSString *queueUrl = [[server.URL URLByAppendingPathComponent:@"123456789012/queue"] absoluteString];
+
+    AWSTestLoadReport *report = [AWSTestLoadGenerator runWithName:@"query SQS SendMessage"
+                                                     requestCount:AWSStandInLoadRequestCount
+                                                      concurrency:AWSStandInLoadConcurrency
+                                                        operation:^AWSTask *(NSUInteger index) {
+        AWSSQSSendMessageRequest *request = [AWSSQSSendMessageRequest new];
+        request.queueUrl = queueUrl;
+        request.messageBody = [NSString stringWithFormat:@"message %lu", (unsigned long)index];
+        return [SQS sendMessage:request];
+    }];
+    [self logBenchmark:@"%@", report];
+    XCTAssertEqual(report.errorCount, 0);
+}
+
+- (void)testLoadJSON {
+    AWSTestStandInServer *server = [self startServerWithServiceDefinition:[[AWSDynamoDBResources sharedInstance] JSONObject]];
+    AWSDynamoDB *DynamoDB = [self DynamoDBWithConfiguration:[server serviceConfiguration]];
+
+    AWSTestLoadReport *report = [AWSTestLoadGenerator runWithName:@"json DynamoDB PutItem"
+                                                     requestCount:AWSStandInLoadRequestCount
+                                                      concurrency:AWSStandInLoadConcurrency
+                                                        operation:^AWSTask *(NSUInteger index) {
+        AWSDynamoDBAttributeValue *value = [AWSDynamoDBAttributeValue new];
+        value.S = [NSString stringWithFormat:@"item %lu", (unsigned long)index];
+        AWSDynamoDBPutItemInput *request = [AWSDynamoDBPutItemInput new];
+        request.tableName = @"table";
+        request.item = @{@"id" : value};
+        return [DynamoDB putItem:request];
+    }];
+    [self logBenchmark:@"%@", report];
+    XCTAssertEqual(report.errorCount, 0);
+}
+
+- (void)testLoadRestJSON {
+    AWSTestStandInServer *server = [self startServerWithServiceDefinition:[[AWSLambdaResources sharedInstance] JSONObject]];
+    AWSLambda *Lambda = [self LambdaWithConfiguration:[server serviceConfiguration]];
+
+    AWSTestLoadReport *report = [AWSTestLoadGenerator runWithName:@"rest-json Lambda ListFunctions"
+                                                     requestCount:AWSStandInLoadRequestCount
+                                                      concurrency:AWSStandInLoadConcurrency
+                                                        operation:^AWSTask *(NSUInteger index) {
+        return [Lambda listFunctions:[AWSLambdaListFunctionsRequest new]];
+    }];
+    [self logBenchmark:@"%@", report];
+    XCTAssertEqual(report.errorCount, 0);
+}
+
+- (void)testLoadRestXML {
+    AWSTestStandInServer *server = [self startServerWithServiceDefinition:[[AWSS3Resources sharedInstance] JSONObject]];
+    ((AWSTestShapeResponder *)server.responder).listLength = 20;
+    AWSS3 *S3 = [self S3WithConfiguration:[server serviceConfiguration]];
+
+    AWSTestLoadReport *report = [AWSTestLoadGenerator runWithName:@"rest-xml S3 ListObjects"
+                                                     requestCount:AWSStandInLoadRequestCount
+                                                      concurrency:AWSStandInLoadConcurrency
+                                                        operation:^AWSTask *(NSUInteger index) {
+        AWSS3ListObjectsRequest *request = [AWSS3ListObjectsRequest new];
+        request.bucket = @"bucket";
+        request.prefix = [NSString stringWithFormat:@"%lu/", (unsigned long)index];
+        return [S3 listObjects:request];
+    }];
+    [self logBenchmark:@"%@", report];
+    XCTAssertEqual(report.errorCount, 0);
+}
+
+- (void)testLoadWithLatencyAndErrors {
+    AWSTestStandInServer *server = [self startServerWithServiceDefinition:[[AWSDynamoDBResources sharedInstance] JSONObject]];
+    server.latency = 0.005;
+    server.latencyJitter = 0.01;
+    server.errorRate = 0.05;
+    AWSDynamoDB *DynamoDB = [self DynamoDBWithConfiguration:[server serviceConfiguration]];
+
+    AWSTestLoadReport *report = [AWSTestLoadGenerator runWithName:@"json DynamoDB ListTables, 5-15 ms and 5% 503s"
+                                                     requestCount:AWSStandInLoadRequestCount
+                                                      concurrency:AWSStandInLoadConcurrency * 4
+                                                        operation:^AWSTask *(NSUInteger index) {
+        return [DynamoDB listTables:[AWSDynamoDBListTablesInput new]];
+    }];
+    [self logBenchmark:@"%@, %lu injected errors", report, (unsigned long)server.injectedErrorCount];
+    XCTAssertGreaterThan(server.injectedErrorCount, 0);
+}
+
+@end
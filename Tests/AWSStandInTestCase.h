@@ -0,0 +1,56 @@
+//
+// Copyright 2010-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <XCTest/XCTest.h>
+#import <awsosx/awsosx.h>
+#import "AWSTestStandInServer.h"
+#import "AWSTestShapeResponder.h"
+#import "AWSTestLoadGenerator.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ Starts stand-in servers and registers service clients against them. Servers are stopped and clients removed when
+ the test ends.
+ */
+@interface AWSStandInTestCase : XCTestCase
+
+- (AWSTestStandInServer *)startServerWithServiceDefinition:(NSDictionary *)serviceDefinition;
+- (AWSTestStandInServer *)startServerWithResponder:(id<AWSTestStandInResponder>)responder;
+
+/**
+ The configurations returned by `-[AWSTestStandInServer serviceConfiguration]` may be changed before they are passed.
+ */
+- (AWSSQS *)SQSWithConfiguration:(AWSServiceConfiguration *)configuration;
+- (AWSSNS *)SNSWithConfiguration:(AWSServiceConfiguration *)configuration;
+- (AWSCloudWatch *)CloudWatchWithConfiguration:(AWSServiceConfiguration *)configuration;
+- (AWSS3 *)S3WithConfiguration:(AWSServiceConfiguration *)configuration;
+- (AWSDynamoDB *)DynamoDBWithConfiguration:(AWSServiceConfiguration *)configuration;
+- (AWSKMS *)KMSWithConfiguration:(AWSServiceConfiguration *)configuration;
+- (AWSLambda *)LambdaWithConfiguration:(AWSServiceConfiguration *)configuration;
+
+/**
+ Waits for the task, fails the test when it has an error, and returns its result.
+ */
+- (nullable id)resultOfTask:(AWSTask *)task;
+
+/**
+ Logs a benchmark result in a form that is easy to find in the test log.
+ */
+- (void)logBenchmark:(NSString *)format, ... NS_FORMAT_FUNCTION(1,2);
+
+@end
+
+NS_ASSUME_NONNULL_END
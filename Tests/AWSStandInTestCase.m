@@ -0,0 +1,115 @@
+//
+// Copyright 2010-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import "AWSStandInTestCase.h"
+
+@implementation AWSStandInTestCase
+
+- (AWSTestStandInServer *)startServerWithServiceDefinition:(NSDictionary *)serviceDefinition {
+    return [self startServerWithResponder:[[AWSTestShapeResponder alloc] initWithServiceDefinition:serviceDefinition]];
+}
+
+- (AWSTestStandInServer *)startServerWithResponder:(id<AWSTestStandInResponder>)responder {
+    AWSTestStandInServer *server = [[AWSTestStandInServer alloc] initWithResponder:responder];
+    NSError *error = nil;
+    XCTAssertTrue([server start:&error], @"The stand-in server did not start: %@", error);
+    [self addTeardownBlock:^{
+        [server stop];
+    }];
+    return server;
+}
+
+- (NSString *)registrationKey {
+    return [NSString stringWithFormat:@"%@-%@", NSStringFromClass([self class]), [[NSUUID UUID] UUIDString]];
+}
+
+- (AWSSQS *)SQSWithConfiguration:(AWSServiceConfiguration *)configuration {
+    NSString *key = [self registrationKey];
+    [AWSSQS registerSQSWithConfiguration:configuration forKey:key];
+    [self addTeardownBlock:^{
+        [AWSSQS removeSQSForKey:key];
+    }];
+    return [AWSSQS SQSForKey:key];
+}
+
+- (AWSSNS *)SNSWithConfiguration:(AWSServiceConfiguration *)configuration {
+    NSString *key = [self registrationKey];
+    [AWSSNS registerSNSWithConfiguration:configuration forKey:key];
+    [self addTeardownBlock:^{
+        [AWSSNS removeSNSForKey:key];
+    }];
+    return [AWSSNS SNSForKey:key];
+}
+
+- (AWSCloudWatch *)CloudWatchWithConfiguration:(AWSServiceConfiguration *)configuration {
+    NSString *key = [self registrationKey];
+    [AWSCloudWatch registerCloudWatchWithConfiguration:configuration forKey:key];
+    [self addTeardownBlock:^{
+        [AWSCloudWatch removeCloudWatchForKey:key];
+    }];
+    return [AWSCloudWatch CloudWatchForKey:key];
+}
+
+- (AWSS3 *)S3WithConfiguration:(AWSServiceConfiguration *)configuration {
+    NSString *key = [self registrationKey];
+    [AWSS3 registerS3WithConfiguration:configuration forKey:key];
+    [self addTeardownBlock:^{
+        [AWSS3 removeS3ForKey:key];
+    }];
+    return [AWSS3 S3ForKey:key];
+}
+
+- (AWSDynamoDB *)DynamoDBWithConfiguration:(AWSServiceConfiguration *)configuration {
+    NSString *key = [self registrationKey];
+    [AWSDynamoDB registerDynamoDBWithConfiguration:configuration forKey:key];
+    [self addTeardownBlock:^{
+        [AWSDynamoDB removeDynamoDBForKey:key];
+    }];
+    return [AWSDynamoDB DynamoDBForKey:key];
+}
+
+- (AWSKMS *)KMSWithConfiguration:(AWSServiceConfiguration *)configuration {
+    NSString *key = [self registrationKey];
+    [AWSKMS registerKMSWithConfiguration:configuration forKey:key];
+    [self addTeardownBlock:^{
+        [AWSKMS removeKMSForKey:key];
+    }];
+    return [AWSKMS KMSForKey:key];
+}
+
+- (AWSLambda *)LambdaWithConfiguration:(AWSServiceConfiguration *)configuration {
+    NSString *key = [self registrationKey];
+    [AWSLambda registerLambdaWithConfiguration:configuration forKey:key];
+    [self addTeardownBlock:^{
+        [AWSLambda removeLambdaForKey:key];
+    }];
+    return [AWSLambda LambdaForKey:key];
+}
+
+- (id)resultOfTask:(AWSTask *)task {
+    [task waitUntilFinished];
+    XCTAssertNil(task.error, @"The call failed: %@", task.error);
+    return task.result;
+}
+
+- (void)logBenchmark:(NSString *)format, ... {
+    va_list arguments;
+    va_start(arguments, format);
+    NSString *message = [[NSString alloc] initWithFormat:format arguments:arguments];
+    va_end(arguments);
+    NSLog(@"[benchmark] %@ %@", self.name, message);
+}
+
+@end
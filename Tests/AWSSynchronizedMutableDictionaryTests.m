@@ -0,0 +1,171 @@
+//
+// Copyright 2010-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <XCTest/XCTest.h>
+#import <awsosx/awsosx.h>
+#import "AWSTestLoadGenerator.h"
+
+static const NSUInteger AWSDictionaryBenchmarkKeyCount = 1024;
+static const NSUInteger AWSDictionaryBenchmarkIterationCount = 100000;
+static const NSUInteger AWSDictionaryBenchmarkWriteInterval = 10;
+
+/**
+ The dictionary as it was before: every call goes through `dispatch_sync` on one serial queue.
+ */
+@interface AWSSerialQueueMutableDictionary : NSObject
+
+- (id)objectForKey:(id)aKey;
+- (void)setObject:(id)anObject forKey:(id <NSCopying>)aKey;
+
+@end
+
+@implementation AWSSerialQueueMutableDictionary {
+    NSMutableDictionary *_dictionary;
+    dispatch_queue_t _queue;
+}
+
+- (instancetype)init {
+    if (self = [super init]) {
+        _dictionary = [NSMutableDictionary new];
+        _queue = dispatch_queue_create("com.amazonaws.AWSSerialQueueMutableDictionary", DISPATCH_QUEUE_SERIAL);
+    }
+
+    return self;
+}
+
+- (id)objectForKey:(id)aKey {
+    __block id returnObject = nil;
+    dispatch_sync(_queue, ^{
+        returnObject = [_dictionary objectForKey:aKey];
+    });
+    return returnObject;
+}
+
+- (void)setObject:(id)anObject forKey:(id <NSCopying>)aKey {
+    dispatch_sync(_queue, ^{
+        [_dictionary setObject:anObject forKey:aKey];
+    });
+}
+
+@end
+
+@interface AWSSynchronizedMutableDictionaryTests : XCTestCase
+
+@end
+
+@implementation AWSSynchronizedMutableDictionaryTests
+
+- (void)testRemoveObjectRemovesOnlyThatObject {
+    AWSSynchronizedMutableDictionary *dictionary = [AWSSynchronizedMutableDictionary new];
+    NSObject *object = [NSObject new];
+    NSObject *otherObject = [NSObject new];
+    [dictionary setObject:object forKey:@"a"];
+    [dictionary setObject:otherObject forKey:@"b"];
+
+    [dictionary removeObject:object];
+    XCTAssertNil([dictionary objectForKey:@"a"]);
+    XCTAssertEqual([dictionary objectForKey:@"b"], otherObject);
+    XCTAssertEqualObjects([dictionary allKeys], @[@"b"]);
+
+    // Replacing or removing the key forgets the object, so removing it later does nothing.
+    [dictionary setObject:object forKey:@"b"];
+    [dictionary removeObject:otherObject];
+    XCTAssertEqual([dictionary objectForKey:@"b"], object);
+    [dictionary removeObjectForKey:@"b"];
+    [dictionary removeObject:object];
+    XCTAssertEqual([[dictionary allKeys] count], 0);
+}
+
+- (void)testConcurrentReadsAndWrites {
+    AWSSynchronizedMutableDictionary *dictionary = [AWSSynchronizedMutableDictionary new];
+    dispatch_apply(16, dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0), ^(size_t thread) {
+        for (NSUInteger i = 0; i < 10000; i++) {
+            NSNumber *key = @((thread * 10000 + i) % AWSDictionaryBenchmarkKeyCount);
+            if (i % 3 == 0) {
+                [dictionary setObject:key forKey:key];
+            } else if (i % 3 == 1) {
+                id object = [dictionary objectForKey:key];
+                XCTAssertTrue(object == nil || [object isEqual:key]);
+            } else {
+                [dictionary removeObjectForKey:key];
+            }
+        }
+    });
+}
+
+#pragma mark - Benchmarks
+
+- (void)testContentionBenchmark {
+    NSMutableArray<NSNumber *> *keys = [NSMutableArray arrayWithCapacity:AWSDictionaryBenchmarkKeyCount];
+    for (NSUInteger i = 0; i < AWSDictionaryBenchmarkKeyCount; i++) {
+        [keys addObject:@(i)];
+    }
+
+    for (NSUInteger threadCount = 1; threadCount <= 64; threadCount *= 2) {
+        AWSSynchronizedMutableDictionary *dictionary = [AWSSynchronizedMutableDictionary new];
+        AWSSerialQueueMutableDictionary *serialDictionary = [AWSSerialQueueMutableDictionary new];
+        for (NSNumber *key in keys) {
+            [dictionary setObject:key forKey:key];
+            [serialDictionary setObject:key forKey:key];
+        }
+
+        // One write for every nine reads, as in the task lookups of the session manager.
+        NSUInteger iterationCount = AWSDictionaryBenchmarkIterationCount / threadCount;
+        double callsPerSecond = [AWSTestLoadGenerator callsPerSecondWithThreadCount:threadCount
+                                                                     iterationCount:iterationCount
+                                                                              block:^(NSUInteger thread, NSUInteger iteration) {
+            NSNumber *key = keys[(thread * 7919 + iteration) % AWSDictionaryBenchmarkKeyCount];
+            if (iteration % AWSDictionaryBenchmarkWriteInterval == 0) {
+                [dictionary setObject:key forKey:key];
+            } else {
+                [dictionary objectForKey:key];
+            }
+        }];
+        double serialCallsPerSecond = [AWSTestLoadGenerator callsPerSecondWithThreadCount:threadCount
+                                                                           iterationCount:iterationCount
+                                                                                    block:^(NSUInteger thread, NSUInteger iteration) {
+            NSNumber *key = keys[(thread * 7919 + iteration) % AWSDictionaryBenchmarkKeyCount];
+            if (iteration % AWSDictionaryBenchmarkWriteInterval == 0) {
+                [serialDictionary setObject:key forKey:key];
+            } else {
+                [serialDictionary objectForKey:key];
+            }
+        }];
+
+        NSLog(@"[benchmark] %@ %2lu threads: %.0f calls/s, serial queue %.0f calls/s (%.2fx)",
+              self.name, (unsigned long)threadCount, callsPerSecond, serialCallsPerSecond, callsPerSecond / serialCallsPerSecond);
+    }
+}
+
+- (void)testRemoveObjectBenchmark {
+    AWSSynchronizedMutableDictionary *dictionary = [AWSSynchronizedMutableDictionary new];
+    NSMutableArray *objects = [NSMutableArray arrayWithCapacity:10000];
+    for (NSUInteger i = 0; i < 10000; i++) {
+        NSObject *object = [NSObject new];
+        [objects addObject:object];
+        [dictionary setObject:object forKey:@(i)];
+    }
+
+    NSTimeInterval startTime = [AWSNetworkingRequestMetrics currentTime];
+    for (NSObject *object in objects) {
+        [dictionary removeObject:object];
+    }
+    NSTimeInterval duration = [AWSNetworkingRequestMetrics currentTime] - startTime;
+
+    NSLog(@"[benchmark] %@ removed 10000 objects in %.3f ms", self.name, duration * 1000);
+    XCTAssertEqual([[dictionary allKeys] count], 0);
+}
+
+@end
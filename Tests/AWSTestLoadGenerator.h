@@ -0,0 +1,93 @@
+//
+// Copyright 2010-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <Foundation/Foundation.h>
+#import <awsosx/awsosx.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ Counts heap allocations of the whole process through `malloc_logger`, so it also sees allocations made by Foundation
+ and CFNetwork on behalf of the code being measured. Counting is process-wide: measure one thing at a time.
+ */
+@interface AWSTestAllocationCounter : NSObject
+
+@property (nonatomic, assign, readonly) uint64_t allocationCount;
+@property (nonatomic, assign, readonly) uint64_t allocatedBytes;
+
++ (instancetype)start;
+- (void)stop;
+
+/**
+ Runs the block and returns the allocations it made.
+ */
++ (instancetype)measure:(void (NS_NOESCAPE ^)(void))block;
+
+@end
+
+/**
+ The result of one load run. The CPU time is the time of the whole process, which includes the stand-in server.
+ */
+@interface AWSTestLoadReport : NSObject
+
+@property (nonatomic, strong, readonly) NSString *name;
+@property (nonatomic, assign, readonly) NSUInteger requestCount;
+@property (nonatomic, assign, readonly) NSUInteger errorCount;
+@property (nonatomic, assign, readonly) NSUInteger concurrency;
+@property (nonatomic, assign, readonly) NSTimeInterval duration;
+@property (nonatomic, assign, readonly) double requestsPerSecond;
+@property (nonatomic, assign, readonly) NSTimeInterval p50Latency;
+@property (nonatomic, assign, readonly) NSTimeInterval p90Latency;
+@property (nonatomic, assign, readonly) NSTimeInterval p99Latency;
+@property (nonatomic, assign, readonly) NSTimeInterval maximumLatency;
+@property (nonatomic, assign, readonly) double allocationsPerRequest;
+@property (nonatomic, assign, readonly) double allocatedBytesPerRequest;
+@property (nonatomic, assign, readonly) NSTimeInterval CPUTimePerRequest;
+@property (nonatomic, assign, readonly) NSUInteger peakThreadCount;
+
+@end
+
+/**
+ Issues `requestCount` calls, at most `concurrency` at a time, and measures them. The operation is called with the
+ index of the call and returns the task of the call; a task that ends with an error counts as an error.
+ */
+@interface AWSTestLoadGenerator : NSObject
+
++ (AWSTestLoadReport *)runWithName:(NSString *)name
+                      requestCount:(NSUInteger)requestCount
+                       concurrency:(NSUInteger)concurrency
+                         operation:(AWSTask * (^)(NSUInteger index))operation;
+
+/**
+ Calls the block `iterationCount` times on each of `threadCount` threads at once and returns the calls per second of
+ all threads together.
+ */
++ (double)callsPerSecondWithThreadCount:(NSUInteger)threadCount
+                         iterationCount:(NSUInteger)iterationCount
+                                  block:(void (^)(NSUInteger thread, NSUInteger iteration))block;
+
+/**
+ The threads of the process now.
+ */
++ (NSUInteger)threadCount;
+
+/**
+ The physical footprint of the process, in bytes, as the memory gauge of Xcode reports it.
+ */
++ (uint64_t)physicalFootprint;
+
+@end
+
+NS_ASSUME_NONNULL_END
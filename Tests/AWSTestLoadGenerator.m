@@ -0,0 +1,286 @@
+//
+// Copyright 2010-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import "AWSTestLoadGenerator.h"
+#import <mach/mach.h>
+#import <stdatomic.h>
+#import <sys/resource.h>
+
+#pragma mark - AWSTestAllocationCounter
+
+// The hook libmalloc calls for every allocation and deallocation; it is what malloc stack logging installs.
+typedef void (AWSTestMallocLogger)(uint32_t type, uintptr_t arg1, uintptr_t arg2, uintptr_t arg3, uintptr_t result, uint32_t numberOfHotFramesToSkip);
+extern AWSTestMallocLogger *malloc_logger;
+
+static const uint32_t AWSTestMallocLogTypeAllocate = 2;
+static const uint32_t AWSTestMallocLogTypeDeallocate = 4;
+
+static _Atomic(uint64_t) AWSTestAllocationCount;
+static _Atomic(uint64_t) AWSTestAllocatedBytes;
+static AWSTestMallocLogger *AWSTestPreviousMallocLogger = NULL;
+static NSUInteger AWSTestActiveAllocationCounterCount = 0;
+
+static void AWSTestCountAllocation(uint32_t type, uintptr_t arg1, uintptr_t arg2, uintptr_t arg3, uintptr_t result, uint32_t numberOfHotFramesToSkip) {
+    if (type & AWSTestMallocLogTypeAllocate) {
+        // A reallocation passes the new size in `arg3`, an allocation in `arg2`.
+        atomic_fetch_add_explicit(&AWSTestAllocationCount, 1, memory_order_relaxed);
+        atomic_fetch_add_explicit(&AWSTestAllocatedBytes, (type & AWSTestMallocLogTypeDeallocate) ? arg3 : arg2, memory_order_relaxed);
+    }
+    if (AWSTestPreviousMallocLogger) {
+        AWSTestPreviousMallocLogger(type, arg1, arg2, arg3, result, numberOfHotFramesToSkip + 1);
+    }
+}
+
+@interface AWSTestAllocationCounter()
+
+@property (nonatomic, assign) uint64_t allocationCount;
+@property (nonatomic, assign) uint64_t allocatedBytes;
+@property (nonatomic, assign) BOOL running;
+
+@end
+
+@implementation AWSTestAllocationCounter
+
++ (instancetype)start {
+    AWSTestAllocationCounter *counter = [self new];
+    @synchronized([AWSTestAllocationCounter class]) {
+        if (AWSTestActiveAllocationCounterCount++ == 0) {
+            AWSTestPreviousMallocLogger = malloc_logger;
+            malloc_logger = AWSTestCountAllocation;
+        }
+    }
+    counter.running = YES;
+    counter.allocationCount = atomic_load_explicit(&AWSTestAllocationCount, memory_order_relaxed);
+    counter.allocatedBytes = atomic_load_explicit(&AWSTestAllocatedBytes, memory_order_relaxed);
+    return counter;
+}
+
+- (void)stop {
+    if (!self.running) {
+        return;
+    }
+    self.allocationCount = atomic_load_explicit(&AWSTestAllocationCount, memory_order_relaxed) - self.allocationCount;
+    self.allocatedBytes = atomic_load_explicit(&AWSTestAllocatedBytes, memory_order_relaxed) - self.allocatedBytes;
+    self.running = NO;
+    @synchronized([AWSTestAllocationCounter class]) {
+        if (--AWSTestActiveAllocationCounterCount == 0) {
+            malloc_logger = AWSTestPreviousMallocLogger;
+            AWSTestPreviousMallocLogger = NULL;
+        }
+    }
+}
+
++ (instancetype)measure:(void (NS_NOESCAPE ^)(void))block {
+    AWSTestAllocationCounter *counter = [self start];
+    block();
+    [counter stop];
+    return counter;
+}
+
+@end
+
+#pragma mark - AWSTestLoadReport
+
+@interface AWSTestLoadReport()
+
+@property (nonatomic, strong) NSString *name;
+@property (nonatomic, assign) NSUInteger requestCount;
+@property (nonatomic, assign) NSUInteger errorCount;
+@property (nonatomic, assign) NSUInteger concurrency;
+@property (nonatomic, assign) NSTimeInterval duration;
+@property (nonatomic, assign) double requestsPerSecond;
+@property (nonatomic, assign) NSTimeInterval p50Latency;
+@property (nonatomic, assign) NSTimeInterval p90Latency;
+@property (nonatomic, assign) NSTimeInterval p99Latency;
+@property (nonatomic, assign) NSTimeInterval maximumLatency;
+@property (nonatomic, assign) double allocationsPerRequest;
+@property (nonatomic, assign) double allocatedBytesPerRequest;
+@property (nonatomic, assign) NSTimeInterval CPUTimePerRequest;
+@property (nonatomic, assign) NSUInteger peakThreadCount;
+
+@end
+
+@implementation AWSTestLoadReport
+
+- (NSString *)description {
+    return [NSString stringWithFormat:@"%@: %lu requests (%lu failed) at concurrency %lu in %.3f s, %.0f req/s, latency p50 %.2f ms p90 %.2f ms p99 %.2f ms max %.2f ms, %.0f allocations (%.0f bytes) and %.1f us CPU per request, %lu threads at peak",
+            self.name,
+            (unsigned long)self.requestCount,
+            (unsigned long)self.errorCount,
+            (unsigned long)self.concurrency,
+            self.duration,
+            self.requestsPerSecond,
+            self.p50Latency * 1000,
+            self.p90Latency * 1000,
+            self.p99Latency * 1000,
+            self.maximumLatency * 1000,
+            self.allocationsPerRequest,
+            self.allocatedBytesPerRequest,
+            self.CPUTimePerRequest * 1000000,
+            (unsigned long)self.peakThreadCount];
+}
+
+@end
+
+#pragma mark - AWSTestLoadGenerator
+
+static int AWSTestCompareLatencies(const void *a, const void *b) {
+    double left = *(const double *)a;
+    double right = *(const double *)b;
+    return left < right ? -1 : (left > right ? 1 : 0);
+}
+
+static NSTimeInterval AWSTestPercentile(const double *sortedLatencies, NSUInteger count, double percentile) {
+    if (count == 0) {
+        return 0;
+    }
+    NSUInteger index = (NSUInteger)ceil(percentile * count);
+    return sortedLatencies[MIN(MAX(index, 1), count) - 1];
+}
+
+static NSTimeInterval AWSTestCPUTime(void) {
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_utime.tv_sec + usage.ru_stime.tv_sec + (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1000000.0;
+}
+
+@implementation AWSTestLoadGenerator
+
++ (AWSTestLoadReport *)runWithName:(NSString *)name
+                      requestCount:(NSUInteger)requestCount
+                       concurrency:(NSUInteger)concurrency
+                         operation:(AWSTask * (^)(NSUInteger index))operation {
+    // Every call writes only its own slot, so the results need no lock.
+    double *latencies = calloc(MAX(requestCount, 1), sizeof(double));
+    BOOL *failures = calloc(MAX(requestCount, 1), sizeof(BOOL));
+    dispatch_semaphore_t slots = dispatch_semaphore_create(MAX(concurrency, 1));
+    dispatch_group_t group = dispatch_group_create();
+
+    __block NSUInteger peakThreadCount = [self threadCount];
+    dispatch_queue_t samplerQueue = dispatch_queue_create("com.amazonaws.AWSTestLoadGenerator.sampler", DISPATCH_QUEUE_SERIAL);
+    dispatch_source_t sampler = dispatch_source_create(DISPATCH_SOURCE_TYPE_TIMER, 0, 0, samplerQueue);
+    dispatch_source_set_timer(sampler, DISPATCH_TIME_NOW, 10 * NSEC_PER_MSEC, NSEC_PER_MSEC);
+    dispatch_source_set_event_handler(sampler, ^{
+        peakThreadCount = MAX(peakThreadCount, [AWSTestLoadGenerator threadCount]);
+    });
+    dispatch_resume(sampler);
+
+    NSTimeInterval startCPUTime = AWSTestCPUTime();
+    AWSTestAllocationCounter *allocationCounter = [AWSTestAllocationCounter start];
+    NSTimeInterval startTime = [AWSNetworkingRequestMetrics currentTime];
+
+    for (NSUInteger i = 0; i < requestCount; i++) {
+        dispatch_semaphore_wait(slots, DISPATCH_TIME_FOREVER);
+        dispatch_group_enter(group);
+        NSTimeInterval callStartTime = [AWSNetworkingRequestMetrics currentTime];
+        [operation(i) continueWithBlock:^id(AWSTask *task) {
+            latencies[i] = [AWSNetworkingRequestMetrics currentTime] - callStartTime;
+            failures[i] = task.isFaulted || task.isCancelled;
+            dispatch_semaphore_signal(slots);
+            dispatch_group_leave(group);
+            return nil;
+        }];
+    }
+    dispatch_group_wait(group, DISPATCH_TIME_FOREVER);
+
+    NSTimeInterval duration = [AWSNetworkingRequestMetrics currentTime] - startTime;
+    [allocationCounter stop];
+    NSTimeInterval CPUTime = AWSTestCPUTime() - startCPUTime;
+    dispatch_source_cancel(sampler);
+    dispatch_sync(samplerQueue, ^{});
+
+    NSUInteger errorCount = 0;
+    for (NSUInteger i = 0; i < requestCount; i++) {
+        errorCount += failures[i] ? 1 : 0;
+    }
+    qsort(latencies, requestCount, sizeof(double), AWSTestCompareLatencies);
+
+    AWSTestLoadReport *report = [AWSTestLoadReport new];
+    report.name = name;
+    report.requestCount = requestCount;
+    report.errorCount = errorCount;
+    report.concurrency = concurrency;
+    report.duration = duration;
+    report.requestsPerSecond = duration > 0 ? requestCount / duration : 0;
+    report.p50Latency = AWSTestPercentile(latencies, requestCount, 0.5);
+    report.p90Latency = AWSTestPercentile(latencies, requestCount, 0.9);
+    report.p99Latency = AWSTestPercentile(latencies, requestCount, 0.99);
+    report.maximumLatency = requestCount > 0 ? latencies[requestCount - 1] : 0;
+    report.allocationsPerRequest = requestCount > 0 ? (double)allocationCounter.allocationCount / requestCount : 0;
+    report.allocatedBytesPerRequest = requestCount > 0 ? (double)allocationCounter.allocatedBytes / requestCount : 0;
+    report.CPUTimePerRequest = requestCount > 0 ? CPUTime / requestCount : 0;
+    report.peakThreadCount = peakThreadCount;
+
+    free(latencies);
+    free(failures);
+    return report;
+}
+
++ (double)callsPerSecondWithThreadCount:(NSUInteger)threadCount
+                         iterationCount:(NSUInteger)iterationCount
+                                  block:(void (^)(NSUInteger thread, NSUInteger iteration))block {
+    dispatch_group_t group = dispatch_group_create();
+    dispatch_semaphore_t ready = dispatch_semaphore_create(0);
+    dispatch_semaphore_t go = dispatch_semaphore_create(0);
+    for (NSUInteger thread = 0; thread < threadCount; thread++) {
+        dispatch_group_enter(group);
+        [NSThread detachNewThreadWithBlock:^{
+            dispatch_semaphore_signal(ready);
+            dispatch_semaphore_wait(go, DISPATCH_TIME_FOREVER);
+            for (NSUInteger iteration = 0; iteration < iterationCount; iteration++) {
+                @autoreleasepool {
+                    block(thread, iteration);
+                }
+            }
+            dispatch_group_leave(group);
+        }];
+    }
+    for (NSUInteger thread = 0; thread < threadCount; thread++) {
+        dispatch_semaphore_wait(ready, DISPATCH_TIME_FOREVER);
+    }
+
+    NSTimeInterval startTime = [AWSNetworkingRequestMetrics currentTime];
+    for (NSUInteger thread = 0; thread < threadCount; thread++) {
+        dispatch_semaphore_signal(go);
+    }
+    dispatch_group_wait(group, DISPATCH_TIME_FOREVER);
+    NSTimeInterval duration = [AWSNetworkingRequestMetrics currentTime] - startTime;
+
+    return duration > 0 ? threadCount * iterationCount / duration : 0;
+}
+
++ (NSUInteger)threadCount {
+    thread_act_array_t threads = NULL;
+    mach_msg_type_number_t count = 0;
+    if (task_threads(mach_task_self(), &threads, &count) != KERN_SUCCESS) {
+        return 0;
+    }
+    for (mach_msg_type_number_t i = 0; i < count; i++) {
+        mach_port_deallocate(mach_task_self(), threads[i]);
+    }
+    vm_deallocate(mach_task_self(), (vm_address_t)threads, count * sizeof(thread_act_t));
+    return count;
+}
+
++ (uint64_t)physicalFootprint {
+    task_vm_info_data_t info;
+    mach_msg_type_number_t count = TASK_VM_INFO_COUNT;
+    if (task_info(mach_task_self(), TASK_VM_INFO, (task_info_t)&info, &count) != KERN_SUCCESS) {
+        return 0;
+    }
+    return info.phys_footprint;
+}
+
+@end
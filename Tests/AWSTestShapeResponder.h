@@ -0,0 +1,57 @@
+//
+// Copyright 2010-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <Foundation/Foundation.h>
+#import "AWSTestStandInServer.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ Answers the operations of one service definition with responses synthesised from their output shapes, in the wire
+ format of the definition's protocol: `query`, `json`, `rest-json` or `rest-xml`. Every member of the output is filled
+ in, lists and maps get `listLength` and `mapLength` entries, and streaming payloads are `payloadLength` bytes long.
+ Responses are built once per operation and reused.
+ */
+@interface AWSTestShapeResponder : NSObject <AWSTestStandInResponder>
+
+@property (nonatomic, strong, readonly) NSDictionary *serviceDefinition;
+
+/**
+ The default value is `3`.
+ */
+@property (nonatomic, assign) NSUInteger listLength;
+
+/**
+ The default value is `2`.
+ */
+@property (nonatomic, assign) NSUInteger mapLength;
+
+/**
+ The default value is 1 KB.
+ */
+@property (nonatomic, assign) unsigned long long payloadLength;
+
+- (instancetype)initWithServiceDefinition:(NSDictionary *)serviceDefinition;
+
+- (nullable NSString *)operationNameForRequest:(AWSTestStandInRequest *)request;
+
+/**
+ The successful response of an operation. Tests decode the body directly to measure the parsers without the network.
+ */
+- (AWSTestStandInResponse *)responseForOperationName:(NSString *)operationName;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,582 @@
+//
+// Copyright 2010-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import "AWSTestShapeResponder.h"
+
+static NSString *const AWSTestShapeResponderTimestamp = @"2020-01-01T00:00:00.000Z";
+static NSString *const AWSTestShapeResponderHeaderTimestamp = @"Wed, 01 Jan 2020 00:00:00 GMT";
+static const double AWSTestShapeResponderEpochTimestamp = 1577836800;
+static const NSUInteger AWSTestShapeResponderMaximumDepth = 8;
+static const NSUInteger AWSTestShapeResponderPayloadPatternLength = 64 * 1024;
+
+static NSString *AWSTestXMLEscapedString(NSString *string) {
+    if ([string rangeOfCharacterFromSet:[NSCharacterSet characterSetWithCharactersInString:@"&<>\""]].location == NSNotFound) {
+        return string;
+    }
+    NSMutableString *escaped = [string mutableCopy];
+    [escaped replaceOccurrencesOfString:@"&" withString:@"&amp;" options:0 range:NSMakeRange(0, [escaped length])];
+    [escaped replaceOccurrencesOfString:@"<" withString:@"&lt;" options:0 range:NSMakeRange(0, [escaped length])];
+    [escaped replaceOccurrencesOfString:@">" withString:@"&gt;" options:0 range:NSMakeRange(0, [escaped length])];
+    [escaped replaceOccurrencesOfString:@"\"" withString:@"&quot;" options:0 range:NSMakeRange(0, [escaped length])];
+    return escaped;
+}
+
+#pragma mark - AWSTestShapeRoute
+
+/**
+ The HTTP binding of a rest-json or rest-xml operation. Routes with more literal characters win, so `/{Bucket}?acl`
+ is preferred to `/{Bucket}` when the query names match.
+ */
+@interface AWSTestShapeRoute : NSObject
+
+@property (nonatomic, strong) NSString *operationName;
+@property (nonatomic, strong) NSString *HTTPMethod;
+@property (nonatomic, strong) NSRegularExpression *pathExpression;
+// Query values are `NSNull` when any value matches.
+@property (nonatomic, strong) NSDictionary<NSString *, id> *queryLiterals;
+@property (nonatomic, assign) NSUInteger score;
+
+@end
+
+@implementation AWSTestShapeRoute
+@end
+
+#pragma mark - AWSTestShapeResponder
+
+@interface AWSTestShapeResponder()
+
+@property (nonatomic, strong) NSDictionary *serviceDefinition;
+@property (nonatomic, strong) NSString *protocol;
+@property (nonatomic, strong) NSDictionary *shapes;
+@property (nonatomic, strong) NSDictionary *operations;
+@property (nonatomic, strong) NSArray<AWSTestShapeRoute *> *routes;
+@property (nonatomic, strong) NSMutableDictionary<NSString *, AWSTestStandInResponse *> *responses;
+
+@end
+
+@implementation AWSTestShapeResponder
+
+- (instancetype)initWithServiceDefinition:(NSDictionary *)serviceDefinition {
+    if (self = [super init]) {
+        _serviceDefinition = serviceDefinition;
+        _protocol = serviceDefinition[@"metadata"][@"protocol"];
+        _shapes = serviceDefinition[@"shapes"];
+        _operations = serviceDefinition[@"operations"];
+        _responses = [NSMutableDictionary new];
+        _listLength = 3;
+        _mapLength = 2;
+        _payloadLength = 1024;
+        if ([_protocol hasPrefix:@"rest-"]) {
+            _routes = [self routesForOperations:_operations];
+        }
+    }
+    return self;
+}
+
+- (void)setListLength:(NSUInteger)listLength {
+    @synchronized(self.responses) {
+        _listLength = listLength;
+        [self.responses removeAllObjects];
+    }
+}
+
+- (void)setMapLength:(NSUInteger)mapLength {
+    @synchronized(self.responses) {
+        _mapLength = mapLength;
+        [self.responses removeAllObjects];
+    }
+}
+
+- (void)setPayloadLength:(unsigned long long)payloadLength {
+    @synchronized(self.responses) {
+        _payloadLength = payloadLength;
+        [self.responses removeAllObjects];
+    }
+}
+
+#pragma mark Routing
+
+- (NSArray<AWSTestShapeRoute *> *)routesForOperations:(NSDictionary *)operations {
+    NSRegularExpression *labelExpression = [NSRegularExpression regularExpressionWithPattern:@"\\{([^}]+)\\}"
+                                                                                     options:0
+                                                                                       error:NULL];
+    NSMutableArray<AWSTestShapeRoute *> *routes = [NSMutableArray new];
+    for (NSString *operationName in operations) {
+        NSDictionary *HTTP = operations[operationName][@"http"];
+        NSString *requestUri = HTTP[@"requestUri"] ?: @"/";
+        NSRange queryStart = [requestUri rangeOfString:@"?"];
+        NSString *pathTemplate = queryStart.location == NSNotFound ? requestUri : [requestUri substringToIndex:queryStart.location];
+
+        NSMutableString *pattern = [NSMutableString stringWithString:@"^"];
+        __block NSUInteger location = 0;
+        __block NSUInteger literalLength = 0;
+        [labelExpression enumerateMatchesInString:pathTemplate options:0 range:NSMakeRange(0, [pathTemplate length]) usingBlock:^(NSTextCheckingResult *result, NSMatchingFlags flags, BOOL *stop) {
+            NSString *literal = [pathTemplate substringWithRange:NSMakeRange(location, result.range.location - location)];
+            [pattern appendString:[NSRegularExpression escapedPatternForString:literal]];
+            literalLength += [literal length];
+            [pattern appendString:[[pathTemplate substringWithRange:[result rangeAtIndex:1]] hasSuffix:@"+"] ? @".+" : @"[^/]+"];
+            location = NSMaxRange(result.range);
+        }];
+        NSString *literal = [pathTemplate substringFromIndex:location];
+        [pattern appendString:[NSRegularExpression escapedPatternForString:literal]];
+        literalLength += [literal length];
+        [pattern appendString:@"/?$"];
+
+        NSMutableDictionary<NSString *, id> *queryLiterals = [NSMutableDictionary new];
+        if (queryStart.location != NSNotFound) {
+            for (NSString *pair in [[requestUri substringFromIndex:NSMaxRange(queryStart)] componentsSeparatedByString:@"&"]) {
+                NSRange separator = [pair rangeOfString:@"="];
+                if (separator.location == NSNotFound) {
+                    queryLiterals[pair] = [NSNull null];
+                } else {
+                    queryLiterals[[pair substringToIndex:separator.location]] = [pair substringFromIndex:NSMaxRange(separator)];
+                }
+            }
+        }
+
+        AWSTestShapeRoute *route = [AWSTestShapeRoute new];
+        route.operationName = operationName;
+        route.HTTPMethod = HTTP[@"method"] ?: @"POST";
+        route.pathExpression = [NSRegularExpression regularExpressionWithPattern:pattern options:0 error:NULL];
+        route.queryLiterals = queryLiterals;
+        route.score = literalLength + 1000 * [queryLiterals count];
+        [routes addObject:route];
+    }
+    return routes;
+}
+
+- (NSString *)operationNameForRequest:(AWSTestStandInRequest *)request {
+    if ([self.protocol isEqualToString:@"query"] || [self.protocol isEqualToString:@"ec2"]) {
+        return [request formParameters][@"Action"];
+    }
+    if ([self.protocol isEqualToString:@"json"]) {
+        NSString *target = [request valueForHeader:@"X-Amz-Target"];
+        NSRange separator = [target rangeOfString:@"." options:NSBackwardsSearch];
+        return separator.location == NSNotFound ? nil : [target substringFromIndex:NSMaxRange(separator)];
+    }
+
+    NSMutableDictionary<NSString *, NSString *> *query = [NSMutableDictionary new];
+    for (NSString *pair in [request.query componentsSeparatedByString:@"&"]) {
+        NSRange separator = [pair rangeOfString:@"="];
+        if (separator.location == NSNotFound) {
+            query[pair] = @"";
+        } else {
+            query[[pair substringToIndex:separator.location]] = [[pair substringFromIndex:NSMaxRange(separator)] stringByRemovingPercentEncoding] ?: @"";
+        }
+    }
+
+    AWSTestShapeRoute *bestRoute = nil;
+    for (AWSTestShapeRoute *route in self.routes) {
+        if (![route.HTTPMethod isEqualToString:request.HTTPMethod]
+            || (bestRoute && route.score <= bestRoute.score)
+            || ![route.pathExpression firstMatchInString:request.path options:0 range:NSMakeRange(0, [request.path length])]) {
+            continue;
+        }
+        __block BOOL matches = YES;
+        [route.queryLiterals enumerateKeysAndObjectsUsingBlock:^(NSString *name, id value, BOOL *stop) {
+            if (!query[name] || (value != [NSNull null] && ![query[name] isEqualToString:value])) {
+                matches = NO;
+                *stop = YES;
+            }
+        }];
+        if (matches) {
+            bestRoute = route;
+        }
+    }
+    return bestRoute.operationName;
+}
+
+#pragma mark Responses
+
+- (AWSTestStandInResponse *)responseForRequest:(AWSTestStandInRequest *)request {
+    NSString *operationName = [self operationNameForRequest:request];
+    if (!operationName || !self.operations[operationName]) {
+        return [self errorResponseForRequest:request
+                                  statusCode:400
+                                        code:@"InvalidAction"
+                                     message:[NSString stringWithFormat:@"No operation matches %@ %@.", request.HTTPMethod, request.path]];
+    }
+    return [self responseForOperationName:operationName];
+}
+
+- (AWSTestStandInResponse *)responseForOperationName:(NSString *)operationName {
+    @synchronized(self.responses) {
+        AWSTestStandInResponse *response = self.responses[operationName];
+        if (!response) {
+            response = [self synthesizedResponseForOperationName:operationName];
+            self.responses[operationName] = response;
+        }
+        return response;
+    }
+}
+
+- (AWSTestStandInResponse *)synthesizedResponseForOperationName:(NSString *)operationName {
+    NSDictionary *operation = self.operations[operationName];
+    NSDictionary *outputRef = operation[@"output"];
+    NSDictionary *output = [self shapeForRef:outputRef];
+    NSString *requestId = [[NSUUID UUID] UUIDString];
+
+    AWSTestStandInResponse *response = [AWSTestStandInResponse responseWithStatusCode:200
+                                                                              headers:@{@"x-amzn-RequestId" : requestId,
+                                                                                        @"x-amz-request-id" : requestId}
+                                                                                 body:nil];
+
+    if ([self.protocol isEqualToString:@"query"] || [self.protocol isEqualToString:@"ec2"]) {
+        NSString *namespace = self.serviceDefinition[@"metadata"][@"xmlNamespace"];
+        NSMutableString *XML = [NSMutableString stringWithString:@"<?xml version=\"1.0\"?>"];
+        if (namespace) {
+            [XML appendFormat:@"<%@Response xmlns=\"%@\">", operationName, namespace];
+        } else {
+            [XML appendFormat:@"<%@Response>", operationName];
+        }
+        if (outputRef) {
+            NSString *resultWrapper = outputRef[@"resultWrapper"] ?: [operationName stringByAppendingString:@"Result"];
+            [XML appendFormat:@"<%@>", resultWrapper];
+            [self appendXMLMembersOfShape:output index:0 depth:1 path:[NSMutableArray arrayWithObject:outputRef[@"shape"] ?: @""] toString:XML];
+            [XML appendFormat:@"</%@>", resultWrapper];
+        }
+        [XML appendFormat:@"<ResponseMetadata><RequestId>%@</RequestId></ResponseMetadata></%@Response>", requestId, operationName];
+        response.headers[@"Content-Type"] = @"text/xml";
+        response.body = [XML dataUsingEncoding:NSUTF8StringEncoding];
+        return response;
+    }
+
+    if ([self.protocol isEqualToString:@"json"]) {
+        NSDictionary *JSONObject = [self JSONValueForRef:outputRef name:operationName index:0 depth:0 path:[NSMutableArray new]];
+        response.headers[@"Content-Type"] = [NSString stringWithFormat:@"application/x-amz-json-%@", self.serviceDefinition[@"metadata"][@"jsonVersion"] ?: @"1.0"];
+        response.body = [NSJSONSerialization dataWithJSONObject:JSONObject ?: @{} options:0 error:NULL];
+        return response;
+    }
+
+    BOOL isXML = [self.protocol isEqualToString:@"rest-xml"];
+    [self addHeadersOfShape:output toHeaders:response.headers];
+
+    NSString *payloadName = output[@"payload"];
+    if (payloadName) {
+        NSDictionary *payloadRef = output[@"members"][payloadName];
+        NSDictionary *payload = [self shapeForRef:payloadRef];
+        NSString *type = payload[@"type"];
+        if ([type isEqualToString:@"blob"] || [type isEqualToString:@"string"]) {
+            response.headers[@"Content-Type"] = response.headers[@"Content-Type"] ?: @"application/octet-stream";
+            [self setPayloadOfResponse:response];
+        } else if (isXML) {
+            NSMutableString *XML = [NSMutableString stringWithString:@"<?xml version=\"1.0\" encoding=\"UTF-8\"?>"];
+            [self appendXMLForRef:payloadRef
+                             name:payloadRef[@"locationName"] ?: payload[@"locationName"] ?: payloadName
+                            index:0
+                            depth:0
+                             path:[NSMutableArray new]
+                         toString:XML];
+            response.headers[@"Content-Type"] = @"application/xml";
+            response.body = [XML dataUsingEncoding:NSUTF8StringEncoding];
+        } else {
+            id JSONObject = [self JSONValueForRef:payloadRef name:payloadName index:0 depth:0 path:[NSMutableArray new]];
+            response.headers[@"Content-Type"] = @"application/json";
+            response.body = [NSJSONSerialization dataWithJSONObject:JSONObject ?: @{} options:0 error:NULL];
+        }
+        return response;
+    }
+
+    if (![self shapeHasBodyMembers:output]) {
+        return response;
+    }
+    if (isXML) {
+        NSMutableString *XML = [NSMutableString stringWithString:@"<?xml version=\"1.0\" encoding=\"UTF-8\"?>"];
+        NSString *rootName = output[@"locationName"] ?: [operationName stringByAppendingString:@"Result"];
+        NSString *namespace = output[@"xmlNamespace"][@"uri"] ?: @"http://s3.amazonaws.com/doc/2006-03-01/";
+        [XML appendFormat:@"<%@ xmlns=\"%@\">", rootName, namespace];
+        [self appendXMLMembersOfShape:output index:0 depth:1 path:[NSMutableArray arrayWithObject:outputRef[@"shape"] ?: @""] toString:XML];
+        [XML appendFormat:@"</%@>", rootName];
+        response.headers[@"Content-Type"] = @"application/xml";
+        response.body = [XML dataUsingEncoding:NSUTF8StringEncoding];
+    } else {
+        NSDictionary *JSONObject = [self JSONValueForRef:outputRef name:operationName index:0 depth:0 path:[NSMutableArray new]];
+        response.headers[@"Content-Type"] = @"application/json";
+        response.body = [NSJSONSerialization dataWithJSONObject:JSONObject ?: @{} options:0 error:NULL];
+    }
+    return response;
+}
+
+- (void)setPayloadOfResponse:(AWSTestStandInResponse *)response {
+    NSUInteger patternLength = (NSUInteger)MIN(self.payloadLength, (unsigned long long)AWSTestShapeResponderPayloadPatternLength);
+    NSMutableData *pattern = [NSMutableData dataWithLength:patternLength];
+    uint8_t *bytes = [pattern mutableBytes];
+    for (NSUInteger i = 0; i < patternLength; i++) {
+        bytes[i] = "0123456789abcdef"[i % 16];
+    }
+    response.body = pattern;
+    response.bodyLength = self.payloadLength > patternLength ? self.payloadLength : 0;
+}
+
+- (AWSTestStandInResponse *)errorResponseForRequest:(AWSTestStandInRequest *)request
+                                         statusCode:(NSInteger)statusCode
+                                               code:(NSString *)code
+                                            message:(NSString *)message {
+    NSString *requestId = [[NSUUID UUID] UUIDString];
+    AWSTestStandInResponse *response = [AWSTestStandInResponse responseWithStatusCode:statusCode
+                                                                              headers:@{@"x-amzn-RequestId" : requestId,
+                                                                                        @"x-amz-request-id" : requestId}
+                                                                                 body:nil];
+
+    if ([self.protocol isEqualToString:@"query"] || [self.protocol isEqualToString:@"ec2"]) {
+        NSString *namespace = self.serviceDefinition[@"metadata"][@"xmlNamespace"];
+        NSString *XML = [NSString stringWithFormat:@"<?xml version=\"1.0\"?><ErrorResponse%@><Error><Type>%@</Type><Code>%@</Code><Message>%@</Message></Error><RequestId>%@</RequestId></ErrorResponse>",
+                         namespace ? [NSString stringWithFormat:@" xmlns=\"%@\"", namespace] : @"",
+                         statusCode >= 500 ? @"Receiver" : @"Sender",
+                         AWSTestXMLEscapedString(code),
+                         AWSTestXMLEscapedString(message),
+                         requestId];
+        response.headers[@"Content-Type"] = @"text/xml";
+        response.body = [XML dataUsingEncoding:NSUTF8StringEncoding];
+    } else if ([self.protocol isEqualToString:@"rest-xml"]) {
+        NSString *XML = [NSString stringWithFormat:@"<?xml version=\"1.0\" encoding=\"UTF-8\"?><Error><Code>%@</Code><Message>%@</Message><RequestId>%@</RequestId></Error>",
+                         AWSTestXMLEscapedString(code),
+                         AWSTestXMLEscapedString(message),
+                         requestId];
+        response.headers[@"Content-Type"] = @"application/xml";
+        response.body = [XML dataUsingEncoding:NSUTF8StringEncoding];
+    } else if ([self.protocol isEqualToString:@"json"]) {
+        response.headers[@"x-amzn-ErrorType"] = code;
+        response.headers[@"Content-Type"] = [NSString stringWithFormat:@"application/x-amz-json-%@", self.serviceDefinition[@"metadata"][@"jsonVersion"] ?: @"1.0"];
+        response.body = [NSJSONSerialization dataWithJSONObject:@{@"__type" : code, @"message" : message} options:0 error:NULL];
+    } else {
+        response.headers[@"x-amzn-ErrorType"] = code;
+        response.headers[@"Content-Type"] = @"application/json";
+        response.body = [NSJSONSerialization dataWithJSONObject:@{@"Type" : statusCode >= 500 ? @"Service" : @"User", @"message" : message} options:0 error:NULL];
+    }
+    return response;
+}
+
+#pragma mark Shapes
+
+- (NSDictionary *)shapeForRef:(NSDictionary *)ref {
+    NSDictionary *shape = ref[@"shape"] ? self.shapes[ref[@"shape"]] : nil;
+    return shape ?: ref ?: @{};
+}
+
+- (BOOL)shapeHasBodyMembers:(NSDictionary *)shape {
+    for (NSString *memberName in shape[@"members"]) {
+        if (!shape[@"members"][memberName][@"location"]) {
+            return YES;
+        }
+    }
+    return NO;
+}
+
+- (NSString *)textForRef:(NSDictionary *)ref
+                    name:(NSString *)name
+                   index:(NSUInteger)index
+                isHeader:(BOOL)isHeader {
+    NSDictionary *shape = [self shapeForRef:ref];
+    NSString *type = shape[@"type"];
+    if ([type isEqualToString:@"string"]) {
+        NSArray *enumValues = shape[@"enum"];
+        if ([enumValues count] > 0) {
+            return enumValues[index % [enumValues count]];
+        }
+        return [NSString stringWithFormat:@"%@-%lu", name, (unsigned long)index];
+    }
+    if ([type isEqualToString:@"integer"] || [type isEqualToString:@"long"]) {
+        return [NSString stringWithFormat:@"%lu", (unsigned long)index + 1];
+    }
+    if ([type isEqualToString:@"float"] || [type isEqualToString:@"double"]) {
+        return @"1.5";
+    }
+    if ([type isEqualToString:@"boolean"]) {
+        return @"true";
+    }
+    if ([type isEqualToString:@"timestamp"]) {
+        return isHeader ? AWSTestShapeResponderHeaderTimestamp : AWSTestShapeResponderTimestamp;
+    }
+    if ([type isEqualToString:@"blob"]) {
+        NSData *data = [[NSString stringWithFormat:@"%@-%lu", name, (unsigned long)index] dataUsingEncoding:NSUTF8StringEncoding];
+        return [data base64EncodedStringWithOptions:0];
+    }
+    return @"c";
+}
+
+- (void)addHeadersOfShape:(NSDictionary *)shape
+                toHeaders:(NSMutableDictionary<NSString *, NSString *> *)headers {
+    static NSSet<NSString *> *framingHeaders = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        framingHeaders = [NSSet setWithArray:@[@"content-length", @"content-encoding", @"transfer-encoding", @"connection"]];
+    });
+
+    NSDictionary *members = shape[@"members"];
+    for (NSString *memberName in members) {
+        NSDictionary *memberRef = members[memberName];
+        NSString *location = memberRef[@"location"];
+        NSString *locationName = memberRef[@"locationName"] ?: memberName;
+        if ([location isEqualToString:@"header"]) {
+            if (![framingHeaders containsObject:[locationName lowercaseString]]) {
+                headers[locationName] = [self textForRef:memberRef name:memberName index:0 isHeader:YES];
+            }
+        } else if ([location isEqualToString:@"headers"]) {
+            NSDictionary *map = [self shapeForRef:memberRef];
+            for (NSUInteger i = 0; i < self.mapLength; i++) {
+                NSString *key = [self textForRef:map[@"key"] name:@"key" index:i isHeader:YES];
+                headers[[locationName stringByAppendingString:key]] = [self textForRef:map[@"value"] name:@"value" index:i isHeader:YES];
+            }
+        }
+    }
+}
+
+#pragma mark XML
+
+- (void)appendXMLMembersOfShape:(NSDictionary *)shape
+                          index:(NSUInteger)index
+                          depth:(NSUInteger)depth
+                           path:(NSMutableArray<NSString *> *)path
+                       toString:(NSMutableString *)XML {
+    NSDictionary *members = shape[@"members"];
+    for (NSString *memberName in members) {
+        NSDictionary *memberRef = members[memberName];
+        if (memberRef[@"location"]) {
+            continue;
+        }
+        [self appendXMLForRef:memberRef
+                         name:memberRef[@"locationName"] ?: memberName
+                        index:index
+                        depth:depth
+                         path:path
+                     toString:XML];
+    }
+}
+
+- (void)appendXMLForRef:(NSDictionary *)ref
+                   name:(NSString *)name
+                  index:(NSUInteger)index
+                  depth:(NSUInteger)depth
+                   path:(NSMutableArray<NSString *> *)path
+               toString:(NSMutableString *)XML {
+    NSDictionary *shape = [self shapeForRef:ref];
+    NSString *type = shape[@"type"];
+
+    if ([type isEqualToString:@"structure"]) {
+        NSString *shapeName = ref[@"shape"] ?: @"";
+        if (depth > AWSTestShapeResponderMaximumDepth || [path containsObject:shapeName]) {
+            return;
+        }
+        [path addObject:shapeName];
+        [XML appendFormat:@"<%@>", name];
+        [self appendXMLMembersOfShape:shape index:index depth:depth + 1 path:path toString:XML];
+        [XML appendFormat:@"</%@>", name];
+        [path removeLastObject];
+    } else if ([type isEqualToString:@"list"]) {
+        NSDictionary *memberRef = shape[@"member"] ?: @{};
+        if ([ref[@"flattened"] boolValue] || [shape[@"flattened"] boolValue]) {
+            NSString *memberName = memberRef[@"locationName"] ?: name;
+            for (NSUInteger i = 0; i < self.listLength; i++) {
+                [self appendXMLForRef:memberRef name:memberName index:i depth:depth + 1 path:path toString:XML];
+            }
+        } else {
+            NSString *memberName = memberRef[@"locationName"] ?: @"member";
+            [XML appendFormat:@"<%@>", name];
+            for (NSUInteger i = 0; i < self.listLength; i++) {
+                [self appendXMLForRef:memberRef name:memberName index:i depth:depth + 1 path:path toString:XML];
+            }
+            [XML appendFormat:@"</%@>", name];
+        }
+    } else if ([type isEqualToString:@"map"]) {
+        NSDictionary *keyRef = shape[@"key"] ?: @{};
+        NSDictionary *valueRef = shape[@"value"] ?: @{};
+        NSString *keyName = keyRef[@"locationName"] ?: @"key";
+        NSString *valueName = valueRef[@"locationName"] ?: @"value";
+        BOOL flattened = [ref[@"flattened"] boolValue] || [shape[@"flattened"] boolValue];
+        if (!flattened) {
+            [XML appendFormat:@"<%@>", name];
+        }
+        for (NSUInteger i = 0; i < self.mapLength; i++) {
+            [XML appendFormat:@"<%@>", flattened ? name : @"entry"];
+            [self appendXMLForRef:keyRef name:keyName index:i depth:depth + 1 path:path toString:XML];
+            [self appendXMLForRef:valueRef name:valueName index:i depth:depth + 1 path:path toString:XML];
+            [XML appendFormat:@"</%@>", flattened ? name : @"entry"];
+        }
+        if (!flattened) {
+            [XML appendFormat:@"</%@>", name];
+        }
+    } else {
+        [XML appendFormat:@"<%@>%@</%@>", name, AWSTestXMLEscapedString([self textForRef:ref name:name index:index isHeader:NO]), name];
+    }
+}
+
+#pragma mark JSON
+
+- (id)JSONValueForRef:(NSDictionary *)ref
+                 name:(NSString *)name
+                index:(NSUInteger)index
+                depth:(NSUInteger)depth
+                 path:(NSMutableArray<NSString *> *)path {
+    NSDictionary *shape = [self shapeForRef:ref];
+    NSString *type = shape[@"type"];
+
+    if ([type isEqualToString:@"structure"]) {
+        NSString *shapeName = ref[@"shape"] ?: @"";
+        if (depth > AWSTestShapeResponderMaximumDepth || [path containsObject:shapeName]) {
+            return nil;
+        }
+        [path addObject:shapeName];
+        NSMutableDictionary *object = [NSMutableDictionary new];
+        NSDictionary *members = shape[@"members"];
+        for (NSString *memberName in members) {
+            NSDictionary *memberRef = members[memberName];
+            if (memberRef[@"location"]) {
+                continue;
+            }
+            id value = [self JSONValueForRef:memberRef name:memberName index:index depth:depth + 1 path:path];
+            if (value) {
+                object[memberRef[@"locationName"] ?: memberName] = value;
+            }
+        }
+        [path removeLastObject];
+        return object;
+    }
+    if ([type isEqualToString:@"list"]) {
+        NSMutableArray *array = [NSMutableArray new];
+        for (NSUInteger i = 0; i < self.listLength; i++) {
+            id value = [self JSONValueForRef:shape[@"member"] name:name index:i depth:depth + 1 path:path];
+            if (value) {
+                [array addObject:value];
+            }
+        }
+        return array;
+    }
+    if ([type isEqualToString:@"map"]) {
+        NSMutableDictionary *map = [NSMutableDictionary new];
+        for (NSUInteger i = 0; i < self.mapLength; i++) {
+            id value = [self JSONValueForRef:shape[@"value"] name:@"value" index:i depth:depth + 1 path:path];
+            if (value) {
+                map[[self textForRef:shape[@"key"] name:@"key" index:i isHeader:NO]] = value;
+            }
+        }
+        return map;
+    }
+    if ([type isEqualToString:@"integer"] || [type isEqualToString:@"long"]) {
+        return @(index + 1);
+    }
+    if ([type isEqualToString:@"float"] || [type isEqualToString:@"double"]) {
+        return @1.5;
+    }
+    if ([type isEqualToString:@"boolean"]) {
+        return @YES;
+    }
+    if ([type isEqualToString:@"timestamp"]) {
+        return @(AWSTestShapeResponderEpochTimestamp);
+    }
+    return [self textForRef:ref name:name index:index isHeader:NO];
+}
+
+@end
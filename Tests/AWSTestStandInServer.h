@@ -0,0 +1,152 @@
+//
+// Copyright 2010-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+@class AWSServiceConfiguration;
+
+/**
+ A request received by `AWSTestStandInServer`. Header names are lowercased.
+ */
+@interface AWSTestStandInRequest : NSObject
+
+@property (nonatomic, strong, readonly) NSString *HTTPMethod;
+@property (nonatomic, strong, readonly) NSString *path;
+@property (nonatomic, strong, readonly, nullable) NSString *query;
+@property (nonatomic, strong, readonly) NSDictionary<NSString *, NSString *> *headers;
+/**
+ `nil` when the body was longer than the server buffers; `bodyLength` still counts it.
+ */
+@property (nonatomic, strong, readonly, nullable) NSData *body;
+@property (nonatomic, assign, readonly) unsigned long long bodyLength;
+
+- (nullable NSString *)valueForHeader:(NSString *)name;
+
+/**
+ The decoded parameters of a form-encoded body, or of the query string when there is no such body.
+ */
+- (NSDictionary<NSString *, NSString *> *)formParameters;
+
+@end
+
+@interface AWSTestStandInResponse : NSObject
+
+@property (nonatomic, assign) NSInteger statusCode;
+@property (nonatomic, strong) NSMutableDictionary<NSString *, NSString *> *headers;
+@property (nonatomic, strong, nullable) NSData *body;
+/**
+ When non-zero, `body` is repeated until this many bytes are sent, so large payloads are streamed without being held.
+ */
+@property (nonatomic, assign) unsigned long long bodyLength;
+
++ (instancetype)responseWithStatusCode:(NSInteger)statusCode
+                               headers:(nullable NSDictionary<NSString *, NSString *> *)headers
+                                  body:(nullable NSData *)body;
+
+@end
+
+@protocol AWSTestStandInResponder <NSObject>
+
+- (AWSTestStandInResponse *)responseForRequest:(AWSTestStandInRequest *)request;
+
+- (AWSTestStandInResponse *)errorResponseForRequest:(AWSTestStandInRequest *)request
+                                         statusCode:(NSInteger)statusCode
+                                               code:(NSString *)code
+                                            message:(NSString *)message;
+
+@end
+
+/**
+ An HTTP/1.1 server on the loopback interface that answers service clients in process. Every connection is served
+ on its own serial queue, so responses to different connections are produced concurrently. Latency and errors are
+ injected before the responder is asked for a response.
+ */
+@interface AWSTestStandInServer : NSObject
+
+@property (nonatomic, strong, readonly) id<AWSTestStandInResponder> responder;
+@property (nonatomic, assign, readonly) uint16_t port;
+/**
+ `http://127.0.0.1:<port>`; `nil` until the server started.
+ */
+@property (nonatomic, strong, readonly, nullable) NSURL *URL;
+
+/**
+ Answers a request before the injection and the responder when it returns a response.
+ */
+@property (atomic, copy, nullable) AWSTestStandInResponse * _Nullable (^requestHandler)(AWSTestStandInRequest *request);
+
+/**
+ The delay before every response is sent. The default value is `0`.
+ */
+@property (atomic, assign) NSTimeInterval latency;
+
+/**
+ A uniformly distributed delay added to `latency`. The default value is `0`.
+ */
+@property (atomic, assign) NSTimeInterval latencyJitter;
+
+/**
+ The fraction of requests answered with an injected error. The default value is `0`.
+ */
+@property (atomic, assign) double errorRate;
+
+/**
+ The number of times each distinct request, identified by its method, target and body, is answered with an injected
+ error before it succeeds. Retries of one call are the same request, so this exercises the retry path
+ deterministically. The default value is `0`.
+ */
+@property (atomic, assign) NSUInteger failuresPerRequest;
+
+/**
+ The status of injected errors. The default value is `503`.
+ */
+@property (atomic, assign) NSInteger errorStatusCode;
+
+/**
+ The error code of injected errors. The default value is `ServiceUnavailable`.
+ */
+@property (atomic, copy) NSString *errorCode;
+
+/**
+ Sends streamed bodies with chunked transfer encoding instead of a `Content-Length`, so clients cannot know their
+ length up front. The default value is `NO`.
+ */
+@property (atomic, assign) BOOL sendsChunkedBodies;
+
+@property (atomic, assign, readonly) NSUInteger requestCount;
+@property (atomic, assign, readonly) NSUInteger injectedErrorCount;
+@property (atomic, assign, readonly) NSUInteger connectionCount;
+
+- (instancetype)initWithResponder:(id<AWSTestStandInResponder>)responder;
+
+/**
+ Serves a service definition, such as `[[AWSSQSResources sharedInstance] JSONObject]`, with an `AWSTestShapeResponder`.
+ */
+- (instancetype)initWithServiceDefinition:(NSDictionary *)serviceDefinition;
+
+- (BOOL)start:(NSError *__autoreleasing *)error;
+- (void)stop;
+- (void)resetCounters;
+
+/**
+ A configuration pointing at the server, with static credentials and its own endpoint, ready to register a client.
+ */
+- (AWSServiceConfiguration *)serviceConfiguration;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,659 @@
+//
+// Copyright 2010-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import "AWSTestStandInServer.h"
+#import "AWSTestShapeResponder.h"
+#import <awsosx/awsosx.h>
+#import <sys/socket.h>
+#import <netinet/in.h>
+#import <netinet/tcp.h>
+#import <arpa/inet.h>
+#import <fcntl.h>
+#import <unistd.h>
+
+static NSString *const AWSTestStandInServerErrorDomain = @"com.amazonaws.AWSTestStandInServerErrorDomain";
+static const unsigned long long AWSTestStandInMaximumBufferedBodyLength = 16 * 1024 * 1024;
+static const NSUInteger AWSTestStandInStreamChunkLength = 256 * 1024;
+
+#pragma mark - AWSTestStandInRequest
+
+@interface AWSTestStandInRequest()
+
+@property (nonatomic, strong) NSString *HTTPMethod;
+@property (nonatomic, strong) NSString *path;
+@property (nonatomic, strong) NSString *query;
+@property (nonatomic, strong) NSDictionary<NSString *, NSString *> *headers;
+@property (nonatomic, strong) NSData *body;
+@property (nonatomic, assign) unsigned long long bodyLength;
+
+- (NSString *)fingerprint;
+
+@end
+
+@implementation AWSTestStandInRequest
+
+- (NSString *)valueForHeader:(NSString *)name {
+    return self.headers[[name lowercaseString]];
+}
+
+- (NSDictionary<NSString *, NSString *> *)formParameters {
+    NSString *form = self.query;
+    if ([[self valueForHeader:@"Content-Type"] hasPrefix:@"application/x-www-form-urlencoded"] && self.body) {
+        form = [[NSString alloc] initWithData:self.body encoding:NSUTF8StringEncoding];
+    }
+
+    NSMutableDictionary<NSString *, NSString *> *parameters = [NSMutableDictionary new];
+    for (NSString *pair in [form componentsSeparatedByString:@"&"]) {
+        if ([pair length] == 0) {
+            continue;
+        }
+        NSRange separator = [pair rangeOfString:@"="];
+        NSString *name = separator.location == NSNotFound ? pair : [pair substringToIndex:separator.location];
+        NSString *value = separator.location == NSNotFound ? @"" : [pair substringFromIndex:NSMaxRange(separator)];
+        name = [[name stringByReplacingOccurrencesOfString:@"+" withString:@" "] stringByRemovingPercentEncoding] ?: name;
+        value = [[value stringByReplacingOccurrencesOfString:@"+" withString:@" "] stringByRemovingPercentEncoding] ?: value;
+        parameters[name] = value;
+    }
+    return parameters;
+}
+
+- (NSString *)fingerprint {
+    return [NSString stringWithFormat:@"%@ %@?%@ %lu %llu", self.HTTPMethod, self.path, self.query ?: @"", (unsigned long)[self.body hash], self.bodyLength];
+}
+
+@end
+
+#pragma mark - AWSTestStandInResponse
+
+@implementation AWSTestStandInResponse
+
++ (instancetype)responseWithStatusCode:(NSInteger)statusCode
+                               headers:(NSDictionary<NSString *, NSString *> *)headers
+                                  body:(NSData *)body {
+    AWSTestStandInResponse *response = [self new];
+    response.statusCode = statusCode;
+    response.headers = headers ? [headers mutableCopy] : [NSMutableDictionary new];
+    response.body = body;
+    return response;
+}
+
+@end
+
+#pragma mark - AWSTestStandInServer
+
+@class AWSTestStandInConnection;
+
+@interface AWSTestStandInServer()
+
+@property (nonatomic, strong) id<AWSTestStandInResponder> responder;
+@property (nonatomic, assign) uint16_t port;
+@property (nonatomic, strong) NSURL *URL;
+@property (nonatomic, strong) dispatch_source_t acceptSource;
+@property (nonatomic, strong) NSMutableSet<AWSTestStandInConnection *> *connections;
+@property (nonatomic, strong) NSMutableDictionary<NSString *, NSNumber *> *attemptCounts;
+@property (atomic, assign) NSUInteger requestCount;
+@property (atomic, assign) NSUInteger injectedErrorCount;
+@property (atomic, assign) NSUInteger connectionCount;
+
+- (AWSTestStandInResponse *)responseForRequest:(AWSTestStandInRequest *)request;
+- (NSTimeInterval)responseDelay;
+- (void)connectionDidClose:(AWSTestStandInConnection *)connection;
+
+@end
+
+#pragma mark - AWSTestStandInConnection
+
+/**
+ One keep-alive connection. Requests are read and answered in order on the connection's serial queue.
+ */
+@interface AWSTestStandInConnection : NSObject
+
+- (instancetype)initWithSocket:(int)socket
+                        server:(AWSTestStandInServer *)server;
+- (void)open;
+- (void)close;
+
+@end
+
+@implementation AWSTestStandInConnection {
+    int _socket;
+    __weak AWSTestStandInServer *_server;
+    dispatch_queue_t _queue;
+    dispatch_io_t _channel;
+    NSMutableData *_buffer;
+    // The request whose head was read and whose body is still arriving.
+    AWSTestStandInRequest *_request;
+    // `nil` while a body too long to buffer is discarded.
+    NSMutableData *_body;
+    BOOL _chunked;
+    unsigned long long _bodyRemaining;
+    BOOL _busy;
+    BOOL _closed;
+    BOOL _closesAfterResponse;
+}
+
+- (instancetype)initWithSocket:(int)socket
+                        server:(AWSTestStandInServer *)server {
+    if (self = [super init]) {
+        _socket = socket;
+        _server = server;
+        _queue = dispatch_queue_create("com.amazonaws.AWSTestStandInConnection", DISPATCH_QUEUE_SERIAL);
+        _buffer = [NSMutableData new];
+    }
+    return self;
+}
+
+- (void)open {
+    int socket = _socket;
+    _channel = dispatch_io_create(DISPATCH_IO_STREAM, socket, _queue, ^(int error) {
+        close(socket);
+    });
+    dispatch_io_set_low_water(_channel, 1);
+    dispatch_io_read(_channel, 0, SIZE_MAX, _queue, ^(bool done, dispatch_data_t data, int error) {
+        if (data && dispatch_data_get_size(data) > 0) {
+            dispatch_data_apply(data, ^bool(dispatch_data_t region, size_t offset, const void *bytes, size_t size) {
+                [self->_buffer appendBytes:bytes length:size];
+                return true;
+            });
+            [self processBuffer];
+        }
+        if (done) {
+            [self close];
+        }
+    });
+}
+
+- (void)close {
+    dispatch_async(_queue, ^{
+        if (self->_closed) {
+            return;
+        }
+        self->_closed = YES;
+        dispatch_io_close(self->_channel, DISPATCH_IO_STOP);
+        [self->_server connectionDidClose:self];
+    });
+}
+
+#pragma mark Reading
+
+- (void)consumeBytes:(NSUInteger)length {
+    [_buffer replaceBytesInRange:NSMakeRange(0, length) withBytes:NULL length:0];
+}
+
+- (BOOL)readHead {
+    static NSData *terminator = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        terminator = [NSData dataWithBytes:"\r\n\r\n" length:4];
+    });
+
+    NSRange end = [_buffer rangeOfData:terminator options:0 range:NSMakeRange(0, [_buffer length])];
+    if (end.location == NSNotFound) {
+        return NO;
+    }
+    NSString *head = [[NSString alloc] initWithBytes:[_buffer bytes] length:end.location encoding:NSISOLatin1StringEncoding];
+    [self consumeBytes:NSMaxRange(end)];
+
+    NSArray<NSString *> *lines = [head componentsSeparatedByString:@"\r\n"];
+    NSArray<NSString *> *requestLine = [[lines firstObject] componentsSeparatedByString:@" "];
+    if ([requestLine count] < 2) {
+        _closesAfterResponse = YES;
+        return NO;
+    }
+
+    AWSTestStandInRequest *request = [AWSTestStandInRequest new];
+    request.HTTPMethod = requestLine[0];
+    NSString *target = requestLine[1];
+    NSRange queryStart = [target rangeOfString:@"?"];
+    if (queryStart.location == NSNotFound) {
+        request.path = target;
+    } else {
+        request.path = [target substringToIndex:queryStart.location];
+        request.query = [target substringFromIndex:NSMaxRange(queryStart)];
+    }
+    NSMutableDictionary<NSString *, NSString *> *headers = [NSMutableDictionary new];
+    for (NSUInteger i = 1; i < [lines count]; i++) {
+        NSRange colon = [lines[i] rangeOfString:@":"];
+        if (colon.location == NSNotFound) {
+            continue;
+        }
+        NSString *name = [[lines[i] substringToIndex:colon.location] lowercaseString];
+        NSString *value = [[lines[i] substringFromIndex:NSMaxRange(colon)] stringByTrimmingCharactersInSet:[NSCharacterSet whitespaceCharacterSet]];
+        headers[name] = headers[name] ? [NSString stringWithFormat:@"%@, %@", headers[name], value] : value;
+    }
+    request.headers = headers;
+
+    NSString *transferEncoding = [request valueForHeader:@"Transfer-Encoding"];
+    _chunked = transferEncoding && [transferEncoding rangeOfString:@"chunked" options:NSCaseInsensitiveSearch].location != NSNotFound;
+    _bodyRemaining = _chunked ? 0 : strtoull([[request valueForHeader:@"Content-Length"] UTF8String] ?: "0", NULL, 10);
+    request.bodyLength = _bodyRemaining;
+    _body = nil;
+    if (!_chunked && _bodyRemaining <= AWSTestStandInMaximumBufferedBodyLength) {
+        _body = [NSMutableData dataWithCapacity:(NSUInteger)_bodyRemaining];
+    }
+    if ([@"close" caseInsensitiveCompare:[request valueForHeader:@"Connection"] ?: @""] == NSOrderedSame) {
+        _closesAfterResponse = YES;
+    }
+    if ([@"100-continue" caseInsensitiveCompare:[request valueForHeader:@"Expect"] ?: @""] == NSOrderedSame
+        && (_chunked || _bodyRemaining > 0)
+        && [_buffer length] == 0) {
+        [self writeData:[@"HTTP/1.1 100 Continue\r\n\r\n" dataUsingEncoding:NSASCIIStringEncoding]
+             completion:nil];
+    }
+
+    _request = request;
+    return YES;
+}
+
+- (BOOL)readBody {
+    if (!_chunked) {
+        NSUInteger length = (NSUInteger)MIN((unsigned long long)[_buffer length], _bodyRemaining);
+        if (length > 0) {
+            [_body appendBytes:[_buffer bytes] length:length];
+            [self consumeBytes:length];
+            _bodyRemaining -= length;
+        }
+        if (_bodyRemaining > 0) {
+            return NO;
+        }
+        _request.body = _body;
+        _body = nil;
+        return YES;
+    }
+
+    // Chunks are only consumed once the whole body arrived.
+    const char *bytes = [_buffer bytes];
+    NSUInteger length = [_buffer length];
+    NSUInteger position = 0;
+    NSMutableData *body = [NSMutableData new];
+    while (YES) {
+        const char *lineEnd = memmem(bytes + position, length - position, "\r\n", 2);
+        if (!lineEnd) {
+            return NO;
+        }
+        unsigned long long chunkLength = strtoull(bytes + position, NULL, 16);
+        position = lineEnd - bytes + 2;
+        if (chunkLength == 0) {
+            if (length - position >= 2 && memcmp(bytes + position, "\r\n", 2) == 0) {
+                position += 2;
+                break;
+            }
+            const char *trailerEnd = memmem(bytes + position, length - position, "\r\n\r\n", 4);
+            if (!trailerEnd) {
+                return NO;
+            }
+            position = trailerEnd - bytes + 4;
+            break;
+        }
+        if (length - position < chunkLength + 2) {
+            return NO;
+        }
+        [body appendBytes:bytes + position length:(NSUInteger)chunkLength];
+        position += (NSUInteger)chunkLength + 2;
+    }
+
+    [self consumeBytes:position];
+    _request.body = body;
+    _request.bodyLength = [body length];
+    return YES;
+}
+
+- (void)processBuffer {
+    while (!_busy && !_closed) {
+        if (!_request && ![self readHead]) {
+            if (_closesAfterResponse) {
+                [self close];
+            }
+            return;
+        }
+        if (![self readBody]) {
+            return;
+        }
+
+        AWSTestStandInRequest *request = _request;
+        _request = nil;
+        _busy = YES;
+        NSString *contentEncoding = [request valueForHeader:@"Content-Encoding"];
+        if (contentEncoding && [contentEncoding rangeOfString:@"gzip"].location != NSNotFound && request.body) {
+            request.body = [request.body awsgzip_gunzippedData];
+        }
+        [self respondToRequest:request];
+    }
+}
+
+#pragma mark Writing
+
+- (void)respondToRequest:(AWSTestStandInRequest *)request {
+    AWSTestStandInServer *server = _server;
+    if (!server) {
+        [self close];
+        return;
+    }
+
+    AWSTestStandInResponse *response = [server responseForRequest:request];
+    NSTimeInterval delay = [server responseDelay];
+    if (delay > 0) {
+        dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(delay * NSEC_PER_SEC)), _queue, ^{
+            [self writeResponse:response];
+        });
+    } else {
+        [self writeResponse:response];
+    }
+}
+
+- (void)writeResponse:(AWSTestStandInResponse *)response {
+    if (_closed) {
+        return;
+    }
+
+    BOOL streamsBody = response.bodyLength > 0 && [response.body length] > 0;
+    BOOL chunked = streamsBody && _server.sendsChunkedBodies;
+    unsigned long long contentLength = streamsBody ? response.bodyLength : [response.body length];
+    NSMutableString *head = [NSMutableString stringWithFormat:@"HTTP/1.1 %ld %@\r\n",
+                             (long)response.statusCode,
+                             [NSHTTPURLResponse localizedStringForStatusCode:response.statusCode]];
+    [response.headers enumerateKeysAndObjectsUsingBlock:^(NSString *name, NSString *value, BOOL *stop) {
+        if ([name caseInsensitiveCompare:@"Content-Length"] != NSOrderedSame) {
+            [head appendFormat:@"%@: %@\r\n", name, value];
+        }
+    }];
+    if (chunked) {
+        [head appendString:@"Transfer-Encoding: chunked\r\n\r\n"];
+    } else {
+        [head appendFormat:@"Content-Length: %llu\r\n\r\n", contentLength];
+    }
+
+    void (^completion)(BOOL) = ^(BOOL success) {
+        self->_busy = NO;
+        if (!success || self->_closesAfterResponse) {
+            [self close];
+        } else {
+            [self processBuffer];
+        }
+    };
+
+    NSData *headData = [head dataUsingEncoding:NSISOLatin1StringEncoding];
+    if (!streamsBody) {
+        NSMutableData *data = [headData mutableCopy];
+        if (response.body) {
+            [data appendData:response.body];
+        }
+        [self writeData:data completion:completion];
+        return;
+    }
+
+    // The pattern is repeated into one reusable chunk, and the chunk is written until the length is reached.
+    NSMutableData *chunk = [NSMutableData dataWithCapacity:AWSTestStandInStreamChunkLength];
+    while ([chunk length] + [response.body length] <= AWSTestStandInStreamChunkLength || [chunk length] == 0) {
+        [chunk appendData:response.body];
+    }
+    dispatch_data_t chunkData = dispatch_data_create([chunk bytes], [chunk length], NULL, DISPATCH_DATA_DESTRUCTOR_DEFAULT);
+    [self writeData:headData completion:^(BOOL success) {
+        if (!success) {
+            completion(NO);
+            return;
+        }
+        [self writeChunk:chunkData
+               remaining:contentLength
+                 chunked:chunked
+              completion:completion];
+    }];
+}
+
+- (void)writeChunk:(dispatch_data_t)chunk
+         remaining:(unsigned long long)remaining
+           chunked:(BOOL)chunked
+        completion:(void (^)(BOOL success))completion {
+    if (remaining == 0) {
+        if (chunked) {
+            [self writeData:[@"0\r\n\r\n" dataUsingEncoding:NSASCIIStringEncoding] completion:completion];
+        } else {
+            completion(YES);
+        }
+        return;
+    }
+    size_t chunkLength = dispatch_data_get_size(chunk);
+    dispatch_data_t piece = remaining >= chunkLength ? chunk : dispatch_data_create_subrange(chunk, 0, (size_t)remaining);
+    size_t pieceLength = dispatch_data_get_size(piece);
+    if (chunked) {
+        NSData *prefix = [[NSString stringWithFormat:@"%zx\r\n", pieceLength] dataUsingEncoding:NSASCIIStringEncoding];
+        dispatch_data_t prefixData = dispatch_data_create([prefix bytes], [prefix length], NULL, DISPATCH_DATA_DESTRUCTOR_DEFAULT);
+        dispatch_data_t suffixData = dispatch_data_create("\r\n", 2, NULL, DISPATCH_DATA_DESTRUCTOR_DEFAULT);
+        piece = dispatch_data_create_concat(dispatch_data_create_concat(prefixData, piece), suffixData);
+    }
+    dispatch_io_write(_channel, 0, piece, _queue, ^(bool done, dispatch_data_t data, int error) {
+        if (!done) {
+            return;
+        }
+        if (error) {
+            completion(NO);
+            return;
+        }
+        [self writeChunk:chunk
+               remaining:remaining - pieceLength
+                 chunked:chunked
+              completion:completion];
+    });
+}
+
+- (void)writeData:(NSData *)data
+       completion:(void (^)(BOOL success))completion {
+    if (_closed) {
+        return;
+    }
+    NSData *retainedData = [data copy];
+    dispatch_data_t dispatchData = dispatch_data_create([retainedData bytes], [retainedData length], _queue, ^{
+        (void)retainedData;
+    });
+    dispatch_io_write(_channel, 0, dispatchData, _queue, ^(bool done, dispatch_data_t remaining, int error) {
+        if (done && completion) {
+            completion(error == 0);
+        }
+    });
+}
+
+@end
+
+@implementation AWSTestStandInServer {
+    int _listenSocket;
+}
+
+- (instancetype)initWithResponder:(id<AWSTestStandInResponder>)responder {
+    if (self = [super init]) {
+        _responder = responder;
+        _listenSocket = -1;
+        _connections = [NSMutableSet new];
+        _attemptCounts = [NSMutableDictionary new];
+        _errorStatusCode = 503;
+        _errorCode = @"ServiceUnavailable";
+    }
+    return self;
+}
+
+- (instancetype)initWithServiceDefinition:(NSDictionary *)serviceDefinition {
+    return [self initWithResponder:[[AWSTestShapeResponder alloc] initWithServiceDefinition:serviceDefinition]];
+}
+
+- (void)dealloc {
+    [self stop];
+}
+
+- (BOOL)failWithDescription:(NSString *)description
+                      error:(NSError *__autoreleasing *)error {
+    if (error) {
+        *error = [NSError errorWithDomain:AWSTestStandInServerErrorDomain
+                                     code:errno
+                                 userInfo:@{NSLocalizedDescriptionKey : [NSString stringWithFormat:@"%@: %s", description, strerror(errno)]}];
+    }
+    if (_listenSocket >= 0) {
+        close(_listenSocket);
+        _listenSocket = -1;
+    }
+    return NO;
+}
+
+- (BOOL)start:(NSError *__autoreleasing *)error {
+    _listenSocket = socket(AF_INET, SOCK_STREAM, 0);
+    if (_listenSocket < 0) {
+        return [self failWithDescription:@"socket" error:error];
+    }
+    int one = 1;
+    setsockopt(_listenSocket, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+
+    struct sockaddr_in address = {0};
+    address.sin_len = sizeof(address);
+    address.sin_family = AF_INET;
+    address.sin_port = 0;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    if (bind(_listenSocket, (struct sockaddr *)&address, sizeof(address)) != 0) {
+        return [self failWithDescription:@"bind" error:error];
+    }
+    if (listen(_listenSocket, SOMAXCONN) != 0) {
+        return [self failWithDescription:@"listen" error:error];
+    }
+    socklen_t addressLength = sizeof(address);
+    if (getsockname(_listenSocket, (struct sockaddr *)&address, &addressLength) != 0) {
+        return [self failWithDescription:@"getsockname" error:error];
+    }
+    fcntl(_listenSocket, F_SETFL, O_NONBLOCK);
+
+    self.port = ntohs(address.sin_port);
+    self.URL = [NSURL URLWithString:[NSString stringWithFormat:@"http://127.0.0.1:%u", self.port]];
+
+    int listenSocket = _listenSocket;
+    __weak AWSTestStandInServer *weakSelf = self;
+    self.acceptSource = dispatch_source_create(DISPATCH_SOURCE_TYPE_READ,
+                                               listenSocket,
+                                               0,
+                                               dispatch_queue_create("com.amazonaws.AWSTestStandInServer", DISPATCH_QUEUE_SERIAL));
+    dispatch_source_set_event_handler(self.acceptSource, ^{
+        int connectionSocket = -1;
+        while ((connectionSocket = accept(listenSocket, NULL, NULL)) >= 0) {
+            int on = 1;
+            setsockopt(connectionSocket, SOL_SOCKET, SO_NOSIGPIPE, &on, sizeof(on));
+            setsockopt(connectionSocket, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+            [weakSelf openConnectionWithSocket:connectionSocket];
+        }
+    });
+    dispatch_source_set_cancel_handler(self.acceptSource, ^{
+        close(listenSocket);
+    });
+    dispatch_resume(self.acceptSource);
+
+    return YES;
+}
+
+- (void)openConnectionWithSocket:(int)connectionSocket {
+    AWSTestStandInConnection *connection = [[AWSTestStandInConnection alloc] initWithSocket:connectionSocket
+                                                                                     server:self];
+    @synchronized(self.connections) {
+        [self.connections addObject:connection];
+    }
+    @synchronized(self) {
+        self.connectionCount++;
+    }
+    [connection open];
+}
+
+- (void)connectionDidClose:(AWSTestStandInConnection *)connection {
+    @synchronized(self.connections) {
+        [self.connections removeObject:connection];
+    }
+}
+
+- (void)stop {
+    if (self.acceptSource) {
+        dispatch_source_cancel(self.acceptSource);
+        self.acceptSource = nil;
+        _listenSocket = -1;
+    }
+    NSArray<AWSTestStandInConnection *> *connections = nil;
+    @synchronized(self.connections) {
+        connections = [self.connections allObjects];
+    }
+    for (AWSTestStandInConnection *connection in connections) {
+        [connection close];
+    }
+}
+
+- (void)resetCounters {
+    @synchronized(self) {
+        self.requestCount = 0;
+        self.injectedErrorCount = 0;
+        self.connectionCount = 0;
+    }
+    @synchronized(self.attemptCounts) {
+        [self.attemptCounts removeAllObjects];
+    }
+}
+
+#pragma mark Responses
+
+- (BOOL)shouldInjectErrorForRequest:(AWSTestStandInRequest *)request {
+    NSUInteger failuresPerRequest = self.failuresPerRequest;
+    if (failuresPerRequest > 0) {
+        NSString *fingerprint = [request fingerprint];
+        @synchronized(self.attemptCounts) {
+            NSUInteger attempts = [self.attemptCounts[fingerprint] unsignedIntegerValue];
+            self.attemptCounts[fingerprint] = @(attempts + 1);
+            if (attempts < failuresPerRequest) {
+                return YES;
+            }
+        }
+    }
+
+    double errorRate = self.errorRate;
+    return errorRate > 0 && arc4random_uniform(1000000) < (uint32_t)(errorRate * 1000000);
+}
+
+- (AWSTestStandInResponse *)responseForRequest:(AWSTestStandInRequest *)request {
+    @synchronized(self) {
+        self.requestCount++;
+    }
+
+    AWSTestStandInResponse *(^requestHandler)(AWSTestStandInRequest *) = self.requestHandler;
+    AWSTestStandInResponse *response = requestHandler ? requestHandler(request) : nil;
+    if (response) {
+        return response;
+    }
+
+    if ([self shouldInjectErrorForRequest:request]) {
+        @synchronized(self) {
+            self.injectedErrorCount++;
+        }
+        return [self.responder errorResponseForRequest:request
+                                            statusCode:self.errorStatusCode
+                                                  code:self.errorCode
+                                               message:@"Injected by AWSTestStandInServer."];
+    }
+    return [self.responder responseForRequest:request];
+}
+
+- (NSTimeInterval)responseDelay {
+    NSTimeInterval latencyJitter = self.latencyJitter;
+    return self.latency + (latencyJitter > 0 ? latencyJitter * arc4random_uniform(1000001) / 1000000.0 : 0);
+}
+
+#pragma mark Clients
+
+- (AWSServiceConfiguration *)serviceConfiguration {
+    AWSStaticCredentialsProvider *credentialsProvider = [[AWSStaticCredentialsProvider alloc] initWithAccessKey:@"AKIDSTANDIN"
+                                                                                                      secretKey:@"standin-secret-key"];
+    return [[AWSServiceConfiguration alloc] initWithRegion:AWSRegionUSEast1
+                                                  endpoint:[[AWSEndpoint alloc] initWithURL:self.URL]
+                                       credentialsProvider:credentialsProvider];
+}
+
+@end
@@ -0,0 +1,76 @@
+//
+// Copyright 2010-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <XCTest/XCTest.h>
+#import <awsosx/awsosx.h>
+
+@interface AWSURLRequestRetryHandlerTests : XCTestCase
+
+@property (nonatomic, strong) AWSURLRequestRetryHandler *retryHandler;
+
+@end
+
+@implementation AWSURLRequestRetryHandlerTests
+
+- (void)setUp {
+    [super setUp];
+    self.retryHandler = [[AWSURLRequestRetryHandler alloc] initWithMaximumRetryCount:3
+                                                                           retryMode:AWSNetworkingRetryModeStandard];
+}
+
+- (NSHTTPURLResponse *)responseWithStatusCode:(NSInteger)statusCode {
+    return [[NSHTTPURLResponse alloc] initWithURL:[NSURL URLWithString:@"https://s3.amazonaws.com/bucket"]
+                                       statusCode:statusCode
+                                      HTTPVersion:@"HTTP/1.1"
+                                     headerFields:nil];
+}
+
+- (void)testS3SlowDownIsThrottling {
+    NSError *error = [NSError errorWithDomain:AWSS3ErrorDomain
+                                         code:AWSS3ErrorUnknown
+                                     userInfo:@{@"Code" : @"SlowDown", @"Message" : @"Please reduce your request rate."}];
+    XCTAssertTrue([self.retryHandler isThrottlingError:error response:[self responseWithStatusCode:503]]);
+}
+
+- (void)testServiceUnavailableIsNotThrottling {
+    NSError *error = [NSError errorWithDomain:AWSSQSErrorDomain
+                                         code:AWSSQSErrorUnknown
+                                     userInfo:@{@"Code" : @"ServiceUnavailable"}];
+    XCTAssertFalse([self.retryHandler isThrottlingError:error response:[self responseWithStatusCode:503]]);
+    XCTAssertFalse([self.retryHandler isThrottlingError:nil response:[self responseWithStatusCode:503]]);
+}
+
+- (void)testThrottlingCodesOfEveryProtocolAreThrottling {
+    NSError *JSONError = [NSError errorWithDomain:AWSDynamoDBErrorDomain
+                                             code:AWSDynamoDBErrorProvisionedThroughputExceeded
+                                         userInfo:@{@"__type" : @"com.amazonaws.dynamodb.v20120810#ProvisionedThroughputExceededException"}];
+    XCTAssertTrue([self.retryHandler isThrottlingError:JSONError response:[self responseWithStatusCode:400]]);
+
+    NSError *RESTJSONError = [NSError errorWithDomain:AWSLambdaErrorDomain
+                                                 code:AWSLambdaErrorTooManyRequests
+                                             userInfo:@{NSLocalizedFailureReasonErrorKey : @"TooManyRequestsException:http://internal.amazon.com/coral/"}];
+    XCTAssertTrue([self.retryHandler isThrottlingError:RESTJSONError response:[self responseWithStatusCode:429]]);
+
+    NSError *queryError = [NSError errorWithDomain:AWSServiceErrorDomain
+                                              code:AWSServiceErrorThrottling
+                                          userInfo:@{@"Code" : @"Throttling"}];
+    XCTAssertTrue([self.retryHandler isThrottlingError:queryError response:[self responseWithStatusCode:400]]);
+}
+
+- (void)testTooManyRequestsStatusIsThrottling {
+    XCTAssertTrue([self.retryHandler isThrottlingError:nil response:[self responseWithStatusCode:429]]);
+}
+
+@end
@@ -0,0 +1,86 @@
+//
+// Copyright 2010-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import "AWSStandInTestCase.h"
+
+static const NSUInteger AWSSessionPoolBenchmarkClientCount = 8;
+
+@interface AWSURLSessionPoolTests : AWSStandInTestCase
+
+@end
+
+@implementation AWSURLSessionPoolTests
+
+- (void)testSlowCallbacksOfOneClientDoNotBlockAnother {
+    AWSTestStandInServer *server = [self startServerWithServiceDefinition:[[AWSS3Resources sharedInstance] JSONObject]];
+    AWSS3 *blockedS3 = [self S3WithConfiguration:[server serviceConfiguration]];
+    AWSS3 *S3 = [self S3WithConfiguration:[server serviceConfiguration]];
+    NSUInteger sessionsReused = [[AWSURLSessionPool defaultSessionPool] statistics].sessionsReused;
+    XCTAssertGreaterThan(sessionsReused, 0);
+
+    dispatch_semaphore_t blocked = dispatch_semaphore_create(0);
+    dispatch_semaphore_t release = dispatch_semaphore_create(0);
+    AWSS3GetObjectRequest *blockedRequest = [AWSS3GetObjectRequest new];
+    blockedRequest.bucket = @"bucket";
+    blockedRequest.key = @"blocked";
+    __block BOOL isBlocked = NO;
+    blockedRequest.downloadProgress = ^(int64_t bytesWritten, int64_t totalBytesWritten, int64_t totalBytesExpectedToWrite) {
+        if (!isBlocked) {
+            isBlocked = YES;
+            dispatch_semaphore_signal(blocked);
+            dispatch_semaphore_wait(release, DISPATCH_TIME_FOREVER);
+        }
+    };
+    AWSTask *blockedTask = [blockedS3 getObject:blockedRequest];
+    XCTAssertEqual(dispatch_semaphore_wait(blocked, dispatch_time(DISPATCH_TIME_NOW, 10 * NSEC_PER_SEC)), 0);
+
+    AWSS3ListObjectsRequest *request = [AWSS3ListObjectsRequest new];
+    request.bucket = @"bucket";
+    XCTestExpectation *listed = [self expectationWithDescription:@"ListObjects completed"];
+    AWSTask *task = [[S3 listObjects:request] continueWithBlock:^id(AWSTask *listTask) {
+        [listed fulfill];
+        return listTask;
+    }];
+    // Before the session queue only routed callbacks, this waited for the blocked client.
+    [self waitForExpectations:@[listed] timeout:10];
+
+    dispatch_semaphore_signal(release);
+    [self resultOfTask:blockedTask];
+    [self resultOfTask:task];
+}
+
+#pragma mark - Benchmarks
+
+- (void)testClientsSharingASessionBenchmark {
+    AWSTestStandInServer *server = [self startServerWithServiceDefinition:[[AWSS3Resources sharedInstance] JSONObject]];
+    ((AWSTestShapeResponder *)server.responder).listLength = 200;
+    NSMutableArray<AWSS3 *> *clients = [NSMutableArray new];
+    for (NSUInteger i = 0; i < AWSSessionPoolBenchmarkClientCount; i++) {
+        [clients addObject:[self S3WithConfiguration:[server serviceConfiguration]]];
+    }
+
+    AWSTestLoadReport *report = [AWSTestLoadGenerator runWithName:@"8 S3 clients on one pooled session, ListObjects of 200 keys"
+                                                     requestCount:2000
+                                                      concurrency:32
+                                                        operation:^AWSTask *(NSUInteger index) {
+        AWSS3ListObjectsRequest *request = [AWSS3ListObjectsRequest new];
+        request.bucket = @"bucket";
+        return [clients[index % AWSSessionPoolBenchmarkClientCount] listObjects:request];
+    }];
+    [self logBenchmark:@"%@, %@", report, [[AWSURLSessionPool defaultSessionPool] statistics]];
+    XCTAssertEqual(report.errorCount, 0);
+}
+
+@end
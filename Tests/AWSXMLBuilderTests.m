@@ -0,0 +1,103 @@
+//
+// Copyright 2010-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <XCTest/XCTest.h>
+#import <awsosx/awsosx.h>
+#import "AWSTestLoadGenerator.h"
+
+static const NSUInteger AWSXMLBuilderBenchmarkObjectCount = 1000;
+static const NSUInteger AWSXMLBuilderBenchmarkIterationCount = 100;
+
+@interface AWSXMLBuilderTests : XCTestCase
+
+@end
+
+@implementation AWSXMLBuilderTests
+
+- (NSDictionary *)deleteObjectsParametersWithObjectCount:(NSUInteger)objectCount {
+    NSMutableArray *objects = [NSMutableArray new];
+    for (NSUInteger i = 0; i < objectCount; i++) {
+        [objects addObject:@{@"Key" : [NSString stringWithFormat:@"photos/2020/%lu & thumbnails <%lu>.jpg", (unsigned long)i, (unsigned long)i],
+                             @"VersionId" : @"3HL4kqtJlcpXroDTDmJ+rmSpXd3dIbrHY"}];
+    }
+    return @{@"Bucket" : @"bucket",
+             @"Delete" : @{@"Objects" : objects,
+                           @"Quiet" : @YES}};
+}
+
+- (void)testBodyIsTheUTF8OfTheString {
+    NSDictionary *definition = [[AWSS3Resources sharedInstance] JSONObject];
+    NSMutableDictionary *parameters = [[self deleteObjectsParametersWithObjectCount:2] mutableCopy];
+    parameters[@"Delete"] = @{@"Objects" : @[@{@"Key" : @"café \U0001F600 <&>\"'"}]};
+
+    NSData *data = [AWSXMLBuilder xmlDataForDictionary:parameters
+                                            actionName:@"DeleteObjects"
+                                 serviceDefinitionRule:definition
+                                                 error:nil];
+    NSString *string = [AWSXMLBuilder xmlStringForDictionary:parameters
+                                                  actionName:@"DeleteObjects"
+                                       serviceDefinitionRule:definition
+                                                       error:nil];
+    XCTAssertEqualObjects(data, [string dataUsingEncoding:NSUTF8StringEncoding]);
+    XCTAssertTrue([string containsString:@"café \U0001F600 &lt;&amp;&gt;"], @"%@", string);
+}
+
+#pragma mark - Benchmarks
+
+- (void)testDeleteObjectsBodyBenchmark {
+    NSDictionary *definition = [[AWSS3Resources sharedInstance] JSONObject];
+    NSDictionary *parameters = [self deleteObjectsParametersWithObjectCount:AWSXMLBuilderBenchmarkObjectCount];
+    __block NSUInteger bodyLength = 0;
+
+    // The string and its UTF-8 copy, as the body was built before it was written as bytes.
+    NSTimeInterval startTime = [AWSNetworkingRequestMetrics currentTime];
+    AWSTestAllocationCounter *stringAllocations = [AWSTestAllocationCounter measure:^{
+        for (NSUInteger i = 0; i < AWSXMLBuilderBenchmarkIterationCount; i++) {
+            @autoreleasepool {
+                NSString *string = [AWSXMLBuilder xmlStringForDictionary:parameters
+                                                              actionName:@"DeleteObjects"
+                                                   serviceDefinitionRule:definition
+                                                                   error:nil];
+                bodyLength = [[string dataUsingEncoding:NSUTF8StringEncoding] length];
+            }
+        }
+    }];
+    NSTimeInterval stringDuration = [AWSNetworkingRequestMetrics currentTime] - startTime;
+
+    startTime = [AWSNetworkingRequestMetrics currentTime];
+    AWSTestAllocationCounter *dataAllocations = [AWSTestAllocationCounter measure:^{
+        for (NSUInteger i = 0; i < AWSXMLBuilderBenchmarkIterationCount; i++) {
+            @autoreleasepool {
+                [AWSXMLBuilder xmlDataForDictionary:parameters
+                                         actionName:@"DeleteObjects"
+                              serviceDefinitionRule:definition
+                                              error:nil];
+            }
+        }
+    }];
+    NSTimeInterval dataDuration = [AWSNetworkingRequestMetrics currentTime] - startTime;
+
+    NSLog(@"[benchmark] %@ S3 DeleteObjects of %lu keys (%lu KB): string and UTF-8 copy %.3f ms, %llu KB allocated; UTF-8 bytes %.3f ms, %llu KB allocated",
+          self.name,
+          (unsigned long)AWSXMLBuilderBenchmarkObjectCount,
+          (unsigned long)bodyLength / 1024,
+          stringDuration * 1000 / AWSXMLBuilderBenchmarkIterationCount,
+          stringAllocations.allocatedBytes / AWSXMLBuilderBenchmarkIterationCount / 1024,
+          dataDuration * 1000 / AWSXMLBuilderBenchmarkIterationCount,
+          dataAllocations.allocatedBytes / AWSXMLBuilderBenchmarkIterationCount / 1024);
+    XCTAssertLessThan(dataAllocations.allocatedBytes, stringAllocations.allocatedBytes);
+}
+
+@end
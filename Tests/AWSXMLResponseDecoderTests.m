@@ -0,0 +1,177 @@
+//
+// Copyright 2010-2020 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import "AWSStandInTestCase.h"
+
+static const NSUInteger AWSXMLDecoderBenchmarkIterationCount = 200;
+
+/**
+ Decodes the responses of the stand-in server directly with `AWSXMLParser`, without the network.
+ */
+@interface AWSXMLResponseDecoderTests : AWSStandInTestCase
+
+@end
+
+@implementation AWSXMLResponseDecoderTests
+
+- (NSData *)bodyForOperationName:(NSString *)operationName
+               serviceDefinition:(NSDictionary *)serviceDefinition
+                      listLength:(NSUInteger)listLength {
+    AWSTestShapeResponder *responder = [[AWSTestShapeResponder alloc] initWithServiceDefinition:serviceDefinition];
+    responder.listLength = listLength;
+    return [responder responseForOperationName:operationName].body;
+}
+
+- (NSMutableDictionary *)dictionaryForData:(NSData *)data
+                             operationName:(NSString *)operationName
+                         serviceDefinition:(NSDictionary *)serviceDefinition {
+    NSError *error = nil;
+    NSMutableDictionary *result = [[AWSXMLParser sharedInstance] dictionaryForXMLData:data
+                                                                           actionName:operationName
+                                                                serviceDefinitionRule:serviceDefinition
+                                                                                error:&error];
+    XCTAssertNil(error);
+    return result;
+}
+
+- (void)testListObjectsWith1000Keys {
+    NSDictionary *serviceDefinition = [[AWSS3Resources sharedInstance] JSONObject];
+    NSData *body = [self bodyForOperationName:@"ListObjects" serviceDefinition:serviceDefinition listLength:1000];
+    NSDictionary *result = [self dictionaryForData:body operationName:@"ListObjects" serviceDefinition:serviceDefinition];
+
+    NSArray *contents = result[@"Contents"];
+    XCTAssertEqual([contents count], 1000);
+    XCTAssertTrue([[contents firstObject][@"Key"] isKindOfClass:[NSString class]]);
+    XCTAssertTrue([[contents firstObject][@"Size"] isKindOfClass:[NSNumber class]]);
+
+    AWSS3ListObjectsOutput *output = [AWSMTLJSONAdapter modelOfClass:[AWSS3ListObjectsOutput class]
+                                                  fromJSONDictionary:result
+                                                               error:nil];
+    XCTAssertEqual([output.contents count], 1000);
+}
+
+- (void)testReceiveMessageWith10Messages {
+    NSDictionary *serviceDefinition = [[AWSSQSResources sharedInstance] JSONObject];
+    NSData *body = [self bodyForOperationName:@"ReceiveMessage" serviceDefinition:serviceDefinition listLength:10];
+    NSDictionary *result = [self dictionaryForData:body operationName:@"ReceiveMessage" serviceDefinition:serviceDefinition];
+
+    NSArray *messages = result[@"Messages"];
+    XCTAssertEqual([messages count], 10);
+    XCTAssertTrue([[messages firstObject][@"Body"] isKindOfClass:[NSString class]]);
+
+    AWSSQSReceiveMessageResult *output = [AWSMTLJSONAdapter modelOfClass:[AWSSQSReceiveMessageResult class]
+                                                      fromJSONDictionary:result
+                                                                   error:nil];
+    XCTAssertEqual([output.messages count], 10);
+}
+
+- (void)testEmptyNumericElementsAreDropped {
+    NSData *body = [@"<ListBucketResult><Name>bucket</Name><MaxKeys></MaxKeys><KeyCount/><IsTruncated>false</IsTruncated></ListBucketResult>" dataUsingEncoding:NSUTF8StringEncoding];
+    NSDictionary *result = [self dictionaryForData:body
+                                     operationName:@"ListObjectsV2"
+                                 serviceDefinition:[[AWSS3Resources sharedInstance] JSONObject]];
+
+    XCTAssertEqualObjects(result[@"Name"], @"bucket");
+    XCTAssertEqualObjects(result[@"IsTruncated"], @NO);
+    XCTAssertNil(result[@"MaxKeys"]);
+    XCTAssertNil(result[@"KeyCount"]);
+}
+
+- (void)testStreamingPayloadsStopAtOtherRoots {
+    NSMutableString *XMLString = [NSMutableString stringWithString:@"<Photos>"];
+    for (NSUInteger i = 0; i < 10000; i++) {
+        [XMLString appendFormat:@"<Photo>photo-%lu</Photo>", (unsigned long)i];
+    }
+    [XMLString appendString:@"</Photos>"];
+    NSData *body = [XMLString dataUsingEncoding:NSUTF8StringEncoding];
+
+    __block NSDictionary *result = nil;
+    AWSTestAllocationCounter *allocations = [AWSTestAllocationCounter measure:^{
+        result = [self dictionaryForData:body
+                           operationName:@"GetObject"
+                       serviceDefinition:[[AWSS3Resources sharedInstance] JSONObject]];
+    }];
+
+    XCTAssertEqualObjects(result, @{@"Body" : body});
+    // Far fewer than one per element: parsing stopped at the root.
+    XCTAssertLessThan(allocations.allocationCount, 1000);
+}
+
+- (void)testStreamingPayloadsDecodeErrors {
+    NSData *body = [@"<Error><Code>NoSuchKey</Code><Message>The specified key does not exist.</Message></Error>" dataUsingEncoding:NSUTF8StringEncoding];
+    NSDictionary *result = [self dictionaryForData:body
+                                     operationName:@"GetObject"
+                                 serviceDefinition:[[AWSS3Resources sharedInstance] JSONObject]];
+
+    XCTAssertEqualObjects(result[@"Error"][@"Code"], @"NoSuchKey");
+}
+
+#pragma mark - Benchmarks
+
+- (void)measureDecodingWithName:(NSString *)name
+                           data:(NSData *)data
+                  operationName:(NSString *)operationName
+              serviceDefinition:(NSDictionary *)serviceDefinition {
+    // The first of the three passes this replaced: the untyped tree, before it was walked again with the shape.
+    NSTimeInterval startTime = [AWSNetworkingRequestMetrics currentTime];
+    AWSTestAllocationCounter *treeAllocations = [AWSTestAllocationCounter measure:^{
+        for (NSUInteger i = 0; i < AWSXMLDecoderBenchmarkIterationCount; i++) {
+            @autoreleasepool {
+                [[AWSXMLDictionaryParser sharedInstance] dictionaryWithData:data];
+            }
+        }
+    }];
+    NSTimeInterval treeDuration = [AWSNetworkingRequestMetrics currentTime] - startTime;
+
+    startTime = [AWSNetworkingRequestMetrics currentTime];
+    AWSTestAllocationCounter *decoderAllocations = [AWSTestAllocationCounter measure:^{
+        for (NSUInteger i = 0; i < AWSXMLDecoderBenchmarkIterationCount; i++) {
+            @autoreleasepool {
+                [[AWSXMLParser sharedInstance] dictionaryForXMLData:data
+                                                         actionName:operationName
+                                              serviceDefinitionRule:serviceDefinition
+                                                              error:nil];
+            }
+        }
+    }];
+    NSTimeInterval decoderDuration = [AWSNetworkingRequestMetrics currentTime] - startTime;
+
+    [self logBenchmark:@"%@ (%lu KB): AWSXMLDictionaryParser %.3f ms, %llu allocations, %llu KB; decoder %.3f ms, %llu allocations, %llu KB",
+     name,
+     (unsigned long)[data length] / 1024,
+     treeDuration * 1000 / AWSXMLDecoderBenchmarkIterationCount,
+     treeAllocations.allocationCount / AWSXMLDecoderBenchmarkIterationCount,
+     treeAllocations.allocatedBytes / AWSXMLDecoderBenchmarkIterationCount / 1024,
+     decoderDuration * 1000 / AWSXMLDecoderBenchmarkIterationCount,
+     decoderAllocations.allocationCount / AWSXMLDecoderBenchmarkIterationCount,
+     decoderAllocations.allocatedBytes / AWSXMLDecoderBenchmarkIterationCount / 1024];
+    XCTAssertLessThan(decoderAllocations.allocationCount, treeAllocations.allocationCount);
+}
+
+- (void)testDecodingAllocationsBenchmark {
+    NSDictionary *S3Definition = [[AWSS3Resources sharedInstance] JSONObject];
+    [self measureDecodingWithName:@"S3 ListObjects of 1000 keys"
+                             data:[self bodyForOperationName:@"ListObjects" serviceDefinition:S3Definition listLength:1000]
+                    operationName:@"ListObjects"
+                serviceDefinition:S3Definition];
+
+    NSDictionary *SQSDefinition = [[AWSSQSResources sharedInstance] JSONObject];
+    [self measureDecodingWithName:@"SQS ReceiveMessage of 10 messages"
+                             data:[self bodyForOperationName:@"ReceiveMessage" serviceDefinition:SQSDefinition listLength:10]
+                    operationName:@"ReceiveMessage"
+                serviceDefinition:SQSDefinition];
+}
+
+@end
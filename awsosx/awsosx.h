@@ -29,11 +29,20 @@
 #import <awsosx/AWSNetworking.h>
 #import <awsosx/AWSNetworkingHelpers.h>
 #import <awsosx/AWSURLSessionManager.h>
+#import <awsosx/AWSURLSessionPool.h>
+#import <awsosx/AWSNetworkingMetrics.h>
+#import <awsosx/AWSNetworkingHedgingPolicy.h>
+#import <awsosx/AWSNetworkingCircuitBreaker.h>
+#import <awsosx/AWSNetworkingRequestCoalescer.h>
+#import <awsosx/AWSNetworkingRequestScheduler.h>
+#import <awsosx/AWSNetworkingWireLogger.h>
+#import <awsosx/AWSNetworkingRequestCompressionInterceptor.h>
 #import <awsosx/AWSValidation.h>
 #import <awsosx/AWSURLRequestSerialization.h>
 #import <awsosx/AWSURLResponseSerialization.h>
 #import <awsosx/AWSURLRequestRetryHandler.h>
 #import <awsosx/AWSSerialization.h>
+#import <awsosx/AWSLazyJSONDictionary.h>
 #import <awsosx/AWSGZIP.h>
 #import <awsosx/AWSCancellationTokenSource.h>
 #import <awsosx/AWSExecutor.h>
@@ -83,6 +92,7 @@
 #import <awsosx/AWSModel.h>
 #import <awsosx/AWSCategory.h>
 #import <awsosx/AWSSynchronizedMutableDictionary.h>
+#import <awsosx/AWSEncoding.h>
 #import <awsosx/AWSKSReachability.h>
 #import <awsosx/AWSSNSModel.h>
 #import <awsosx/AWSSNS.h>
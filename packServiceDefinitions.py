@@ -0,0 +1,112 @@
+import glob
+import json
+import re
+import sys
+
+# This script is used to pack the service definitions of the *Resources.m files after they
+# have been copied from the AWS iOS SDK. Run it at the root of the project after
+# updateAWSFromRespoitory.py.
+#
+# The documentation of the operations and shapes is removed, as the SDK never reads it, and the
+# JSON is written without indentation with one operation or shape per line. The definitions are
+# read in place by AWSLazyJSONDictionary, which parses each operation and shape on first use.
+# Non-ASCII characters are escaped so that the string literals stay ASCII and can be read
+# without being copied.
+#
+# Usage: python3 packServiceDefinitions.py [path/to/AWSXResources.m ...]
+
+DOCUMENTATION_KEYS = ('documentation', 'documentationUrl')
+
+# Objects whose keys are names chosen by the service, not traits of the definition.
+NAMED_OBJECTS = ('operations', 'shapes', 'members', 'authorizers')
+
+DEFINITION_PATTERN = re.compile(r'(- \(NSString \*\)definitionString \{\n    return @")(.*?)(";\n\})', re.S)
+
+PARSE_PATTERN = re.compile(r'_definitionDictionary = \[NSJSONSerialization JSONObjectWithData:\[\[self definitionString\] dataUsingEncoding:NSUTF8StringEncoding\]\n'
+                           r' *options:kNilOptions\n'
+                           r' *error:&error\];')
+
+PARSE_REPLACEMENT = ('_definitionDictionary = [[AWSLazyJSONDictionary alloc] initWithJSONString:[self definitionString]\n'
+                     '                                                                            error:&error];')
+
+LAZY_IMPORT = '#import "AWSLazyJSONDictionary.h"\n'
+
+
+def unescape_literal(literal):
+    text = literal.replace('\\\n', '')
+    result = []
+    index = 0
+    while index < len(text):
+        if text[index] == '\\':
+            result.append({'"': '"', '\\': '\\', 'n': '\n', 't': '\t'}[text[index + 1]])
+            index += 2
+        else:
+            result.append(text[index])
+            index += 1
+    return ''.join(result)
+
+
+def escape_literal(text):
+    return text.replace('\\', '\\\\').replace('"', '\\"')
+
+
+def strip_documentation(value, parent_key=None):
+    if isinstance(value, dict):
+        stripped = {}
+        for key, child in value.items():
+            if parent_key not in NAMED_OBJECTS and key in DOCUMENTATION_KEYS and isinstance(child, str):
+                continue
+            stripped[key] = strip_documentation(child, key)
+        return stripped
+    if isinstance(value, list):
+        return [strip_documentation(child, parent_key) for child in value]
+    return value
+
+
+def compact(value):
+    return json.dumps(value, separators=(',', ':'), ensure_ascii=True)
+
+
+def pack_definition(definition):
+    lines = ['{']
+    top_level = list(definition.items())
+    for top_index, (key, value) in enumerate(top_level):
+        top_separator = ',' if top_index < len(top_level) - 1 else ''
+        if key in ('operations', 'shapes') and isinstance(value, dict) and value:
+            lines.append('{}:{{'.format(compact(key)))
+            entries = list(value.items())
+            for index, (name, entry) in enumerate(entries):
+                separator = ',' if index < len(entries) - 1 else ''
+                lines.append('{}:{}{}'.format(compact(name), compact(entry), separator))
+            lines.append('}' + top_separator)
+        else:
+            lines.append('{}:{}{}'.format(compact(key), compact(value), top_separator))
+    lines.append('}')
+    return '\\\n'.join(escape_literal(line) for line in lines)
+
+
+def pack_file(path):
+    with open(path) as f:
+        source = f.read()
+
+    match = DEFINITION_PATTERN.search(source)
+    if not match:
+        print('{}: no definitionString found'.format(path))
+        return
+
+    definition = json.loads(unescape_literal(match.group(2)))
+    packed = pack_definition(strip_documentation(definition))
+    source = source[:match.start(2)] + packed + source[match.end(2):]
+
+    source = PARSE_PATTERN.sub(PARSE_REPLACEMENT, source)
+    if LAZY_IMPORT not in source:
+        source = source.replace('#import "AWSCocoaLumberjack.h"\n', '#import "AWSCocoaLumberjack.h"\n' + LAZY_IMPORT, 1)
+
+    with open(path, 'w') as f:
+        f.write(source)
+    print('{}: {} bytes'.format(path, len(packed)))
+
+
+paths = sys.argv[1:] or sorted(glob.glob('./**/*Resources.m', recursive=True))
+for path in paths:
+    pack_file(path)